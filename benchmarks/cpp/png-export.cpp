@@ -0,0 +1,146 @@
+// reaktplot - a modern C++ scientific plotting library powered by plotly
+// https://github.com/reaktplot/reaktplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2022-2023 Allan Leal
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+// NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+// Benchmark the time and memory taken to export figures to PNG files with the native renderer.
+//
+// Usage: benchmark-png-export [--figures N] [--points N] [--target MS]
+//
+// A figure of 800x500 pixels with a title, two lines of N points (1000 by default), and a legend is rendered N times
+// (100 by default) to a PNG image in memory with `writePng`. The mean time per figure, split into rasterization (`render`
+// on a PngCanvas) and encoding (`encodePng`, with the filter of each row chosen and compressed by zlib with Z_RLE), and
+// the growth of the peak resident memory of the process are reported. The benchmark exits with an error if the mean
+// time exceeds the target (25 ms per figure by default).
+//
+// The default target is set for the slowest machine this benchmark runs on: a single 2.1 GHz Xeon vCPU, on which a
+// build at -O2 takes 17.7 to 20.6 ms per figure (6 to 9 ms to rasterize, 8 to 12.5 ms to encode, of which 2.5 to 4.5 ms
+// to filter the rows and 3 to 4.5 ms in zlib). The goal of 10 ms per figure is checked on faster hardware with --target 10.
+
+// C++ includes
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#ifndef _WIN32
+#include <sys/resource.h>
+#endif
+
+// reaktplot includes
+#include <reaktplot/Figure.hpp>
+#include <reaktplot/Png.hpp>
+#include <reaktplot/Renderer.hpp>
+using namespace reaktplot;
+
+/// The most time that exporting a figure to a PNG image may take on average on the reference machine (in ms).
+const auto TARGET = 25.0;
+
+/// Return the peak resident memory of the process so far (in MB), or zero where this is not available.
+auto peakrss() -> double
+{
+#ifndef _WIN32
+    rusage usage = {};
+    getrusage(RUSAGE_SELF, &usage);
+#ifdef __APPLE__
+    return usage.ru_maxrss / 1048576.0; // in bytes on macOS
+#else
+    return usage.ru_maxrss / 1024.0; // in KB on Linux
+#endif
+#else
+    return 0.0;
+#endif
+}
+
+/// Return the value of a command-line option or a default value if it is not given.
+auto option(int argc, char** argv, const char* name, double fallback) -> double
+{
+    for(int i = 1; i + 1 < argc; ++i)
+        if(std::strcmp(argv[i], name) == 0)
+            return std::atof(argv[i + 1]);
+    return fallback;
+}
+
+int main(int argc, char** argv)
+{
+    auto const figures = static_cast<long>(option(argc, argv, "--figures", 100));
+    auto const points = static_cast<long>(option(argc, argv, "--points", 1000));
+    auto const target = option(argc, argv, "--target", TARGET);
+
+    std::vector<double> x(points), y1(points), y2(points);
+    for(long i = 0; i < points; ++i)
+    {
+        x[i] = 10.0 * i / (points - 1);
+        y1[i] = std::sin(x[i]);
+        y2[i] = std::cos(x[i]);
+    }
+
+    Figure fig;
+    fig.title("BENCHMARK");
+    fig.xaxisTitle("x");
+    fig.yaxisTitle("y");
+    fig.drawLine(x, y1, "sin(x)");
+    fig.drawLine(x, y2, "cos(x)");
+
+    std::size_t bytes = 0;
+    auto const render = [&]
+    {
+        std::ostringstream out;
+        writePng(out, fig.specs(), 800, 500);
+        bytes = out.str().size();
+    };
+
+    render(); // the first figure loads the font and warms up the caches, so it is not measured
+
+    auto const before = peakrss();
+    auto const begin = std::chrono::steady_clock::now();
+    for(long i = 0; i < figures; ++i)
+        render();
+    auto const elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - begin).count();
+    auto const growth = peakrss() - before;
+
+    // The same figures again, rasterized and encoded separately to see where the time goes
+    double rasterizing = 0.0, encoding = 0.0;
+    for(long i = 0; i < figures; ++i)
+    {
+        PngCanvas canvas;
+        auto const start = std::chrono::steady_clock::now();
+        reaktplot::render(canvas, fig.specs(), 800, 500);
+        auto const rendered = std::chrono::steady_clock::now();
+        std::ostringstream out;
+        encodePng(out, canvas.pixels(), canvas.width(), canvas.height());
+        rasterizing += std::chrono::duration<double, std::milli>(rendered - start).count();
+        encoding += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - rendered).count();
+    }
+
+    std::cout << std::setw(8) << "figures" << std::setw(8) << "points" << std::setw(12) << "time (ms)" << std::setw(15) << "render (ms)" << std::setw(15) << "encode (ms)" << std::setw(11) << "file (KB)" << std::setw(22) << "peak rss growth (MB)" << std::setw(15) << "peak rss (MB)" << std::endl;
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << std::setw(8) << figures << std::setw(8) << points << std::setw(12) << elapsed / figures << std::setw(15) << rasterizing / figures << std::setw(15) << encoding / figures << std::setw(11) << bytes / 1024.0 << std::setw(22) << growth << std::setw(15) << peakrss() << std::endl;
+
+    if(elapsed / figures > target)
+    {
+        std::cerr << "Exporting a figure to PNG took more than the target of " << target << " ms on average." << std::endl;
+        return EXIT_FAILURE;
+    }
+}
@@ -0,0 +1,72 @@
+# reaktplot - a modern C++ scientific plotting library powered by plotly
+# https://github.com/reaktplot/reaktplot
+#
+# Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+#
+# Copyright (c) 2022-2023 Allan Leal
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+# associated documentation files (the "Software"), to deal in the Software without restriction,
+# including without limitation the rights to use, copy, modify, merge, publish, distribute,
+# sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in all copies or
+# substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+# NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+# NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+# DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+"""
+Benchmark the construction of figures with many traces in regular and fast modes.
+
+Usage: python benchmarks/python/figure-construction.py [--render]
+
+The time measured covers drawing all traces, setting a few layout properties, and building the final plotly figure
+(`Figure.todict`). With `--render`, the time of saving the figure to an SVG file is also reported. The time per trace
+in regular mode should stay roughly constant as the number of traces grows, since traces are added to the plotly
+figure in a single batch.
+"""
+
+import sys
+import time
+
+import numpy as np
+
+from reaktplot import Figure, LineSpecs
+
+
+def construct(numtraces: int, fast: bool) -> Figure:
+    x = np.linspace(0.0, 1.0, 20)
+    fig = Figure(fast=fast)
+    fig.title("BENCHMARK")
+    fig.xaxisTitle("x")
+    fig.yaxisTitle("y")
+    for i in range(numtraces):
+        fig.drawLine(x, x * i, f"line-{i}", LineSpecs().width(2))
+    fig.todict()
+    return fig
+
+
+def measure(fn) -> float:
+    begin = time.perf_counter()
+    fn()
+    return time.perf_counter() - begin
+
+
+if __name__ == "__main__":
+    render = "--render" in sys.argv[1:]
+
+    print(f"{'traces':>8} {'regular (s)':>12} {'fast (s)':>12} {'speedup':>8} {'regular/trace (ms)':>19}")
+
+    for numtraces in [1, 100, 5_000, 10_000]:
+        regular = measure(lambda: construct(numtraces, fast=False))
+        fast = measure(lambda: construct(numtraces, fast=True))
+        print(f"{numtraces:>8} {regular:>12.4f} {fast:>12.4f} {regular / fast:>8.1f} {1e3 * regular / numtraces:>19.4f}")
+
+        if render:
+            fig = construct(numtraces, fast=True)
+            print(f"{'':>8} save to svg (fast): {measure(lambda: fig.save('benchmark-figure-construction.svg')):.4f} s")
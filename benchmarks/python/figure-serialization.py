@@ -0,0 +1,102 @@
+# reaktplot - a modern C++ scientific plotting library powered by plotly
+# https://github.com/reaktplot/reaktplot
+#
+# Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+#
+# Copyright (c) 2022-2023 Allan Leal
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+# associated documentation files (the "Software"), to deal in the Software without restriction,
+# including without limitation the rights to use, copy, modify, merge, publish, distribute,
+# sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in all copies or
+# substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+# NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+# NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+# DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+"""
+Benchmark the memory used to serialize large figures to JSON files.
+
+Usage: python benchmarks/python/figure-serialization.py [--points N] [--plotly]
+
+A figure with a single line of N points (10^7 by default, so 160 MB of data) is saved to a JSON file with
+`Figure.save`, which streams the data arrays to the file in chunks (see `writeJson`). How much the peak resident memory
+of the process while saving exceeds the resident memory before saving is reported and checked against a budget of
+64 MB, independent of N, and the benchmark exits with an error if the budget is exceeded. The peak is reset before each
+measurement (Linux only), since the peak reached while building the figure would otherwise hide that of the save. With `--plotly`, the figure is then also saved with
+`plotly.io.write_json`, which builds the whole JSON string in memory, for comparison.
+"""
+
+import gc
+import os
+import sys
+import time
+
+import numpy as np
+import plotly.io as pio
+
+from reaktplot import Figure
+
+
+# The most memory that saving a figure may use beyond the figure itself, whatever its size (in MB).
+BUDGET = 64
+
+
+def rss(field: str) -> float:
+    """Return the current (`VmRSS`) or peak (`VmHWM`) resident memory of the process (in MB)."""
+    with open("/proc/self/status") as status:
+        for line in status:
+            if line.startswith(field + ":"):
+                return int(line.split()[1]) / 2**10  # in KB
+    raise RuntimeError(f"Could not find {field} in /proc/self/status.")
+
+
+def measure(fn) -> tuple:
+    """Return the time taken by a function (in s) and how much its peak resident memory exceeded that before it (in MB)."""
+    gc.collect()
+    with open("/proc/self/clear_refs", "w") as refs:
+        refs.write("5")  # reset the peak resident memory to the current one
+    before = rss("VmRSS")
+    begin = time.perf_counter()
+    fn()
+    return time.perf_counter() - begin, rss("VmHWM") - before
+
+
+if __name__ == "__main__":
+    if not os.path.exists("/proc/self/clear_refs"):
+        sys.exit("This benchmark measures the peak resident memory through /proc and runs on Linux only.")
+
+    args = sys.argv[1:]
+    points = int(float(args[args.index("--points") + 1])) if "--points" in args else 10**7
+
+    x = np.linspace(0.0, 1.0, points)
+    y = np.sin(x)
+
+    fig = Figure(fast=True)
+    fig.title("BENCHMARK")
+    fig.drawLine(x, y, "sin")
+    fig.todict()  # built before measuring, since the figure itself is not part of the overhead
+
+    file = "benchmark-figure-serialization.json"
+
+    print(f"{'points':>12} {'data (MB)':>10} {'writer':>8} {'time (s)':>9} {'file (MB)':>10} {'peak rss growth (MB)':>21}")
+
+    elapsed, growth = measure(lambda: fig.save(file))
+    print(f"{points:>12} {2 * x.nbytes / 2**20:>10.1f} {'reaktplot':>8} {elapsed:>9.2f} {os.path.getsize(file) / 2**20:>10.1f} {growth:>21.1f}")
+
+    exceeded = growth > BUDGET
+
+    if "--plotly" in args:
+        elapsed, growth = measure(lambda: pio.write_json(fig.todict(), file, validate=False))
+        print(f"{points:>12} {2 * x.nbytes / 2**20:>10.1f} {'plotly':>8} {elapsed:>9.2f} {os.path.getsize(file) / 2**20:>10.1f} {growth:>21.1f}")
+
+    os.remove(file)
+
+    if exceeded:
+        sys.exit(f"Saving the figure raised the peak resident memory by more than the budget of {BUDGET} MB.")
@@ -20,8 +20,6 @@
 // DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
-#include <sstream>
-
 // reaktplot includes
 #include <reaktplot/reaktplot.hpp>
 using namespace reaktplot;
@@ -49,32 +47,31 @@ int main(int argc, char** argv)
         { NaN, NaN, NaN, NaN, NaN }
     };
 
-    auto counter = 0;
+    Figure fig; // a single animated figure, whose layout and coordinates are shared by all frames
 
-    for(auto i = 0; i < 5; ++i)
-    {
-        for(auto j = 0; j < 5; ++j)
-        {
-            Figure fig;
+    fig.title("CONTOUR PLOT");
 
-            fig.title("CONTOUR PLOT");
+    fig.xaxisShowGrid(false);
+    fig.yaxisShowGrid(false);
 
-            fig.xaxisShowGrid(false);
-            fig.yaxisShowGrid(false);
+    fig.xaxisTitle("x");
+    fig.yaxisTitle("y");
 
-            fig.xaxisTitle("x");
-            fig.yaxisTitle("y");
+    fig.drawContour(x, y, z0); // the initial state of the animation
 
+    for(auto i = 0; i < 5; ++i)
+    {
+        for(auto j = 0; j < 5; ++j)
+        {
             z0[i][j] = z[i][j];
 
-            fig.drawContour(x, y, z0);
-
-            std::ostringstream ss;
-            ss.fill('0');
-            ss.width(3);
-            ss << counter++;
-
-            fig.save("example-contour-animation-" + ss.str() + ".png");
+            fig.beginFrame();
+            fig.drawContour(x, y, z0); // only z is stored in the frame, since x and y are those of the initial state
+            fig.endFrame();
         }
     }
+
+    fig.save("example-contour-animation.html"); // one animated HTML file with play and pause buttons and a slider
+
+    fig.saveFrames("example-contour-animation.png"); // example-contour-animation-000.png, ..., example-contour-animation-024.png
 }
@@ -23,68 +23,390 @@
 
 from __future__ import annotations  # needed to allow Figure as type annotation below for return types
 
+import gzip
+import os
+
 import plotly as ply
 import plotly.graph_objects as pgo
 import plotly.io as pio
 
+from .Json import writeJson
 from .Specs import FontSpecs, ContourSpecs, LineSpecs, MarkerSpecs
 
 
+# Set environment variable REAKTPLOT_VALIDATE=1 to let plotly validate figures built in fast mode (useful for debugging).
+VALIDATE = os.environ.get("REAKTPLOT_VALIDATE", "0") not in ("", "0")
+
+# The plotly property names that contain an underscore and thus must not be split as magic underscore paths.
+UNDERSCORED_PROPERTIES = {"paper_bgcolor", "plot_bgcolor"}
+
+# The plotly templates converted to plain dicts, cached by template name.
+TEMPLATES = dict()
+
+# The arguments of plotly.io.write_html for each way of including plotly.js in HTML files (see setHtmlMode).
+HTML_MODES = {
+    "standalone": dict(include_plotlyjs=True, full_html=True),  # plotly.js embedded in each file
+    "shared": dict(include_plotlyjs="directory", full_html=True),  # plotly.min.js written once next to the files
+    "fragment": dict(include_plotlyjs=False, full_html=False),  # only the div and script of the figure
+}
+
+# The way of including plotly.js in HTML files used by default in this session.
+HTML_MODE = "standalone"
+
+
+def setHtmlMode(mode: str):
+    """
+    Set how plotly.js is included in the HTML files saved in this session.
+
+    Args:
+        mode (str): One of `standalone` (plotly.js embedded in each file, about 3.5 MB each), `shared` (a single
+        `plotly.min.js` file written once in the directory of the HTML files and referenced by them), or `fragment`
+        (only the div and script of the figure, to be inserted in a page that loads plotly.js).
+    """
+    global HTML_MODE
+    if mode not in HTML_MODES:
+        raise ValueError(f"Unknown HTML mode `{mode}`. Expected one of {list(HTML_MODES)}.")
+    HTML_MODE = mode
+
+
+def nested(options: dict) -> dict:
+    """
+    Return a nested dict from a dict with plotly's magic underscore keys (e.g., `title_font_size` becomes `title.font.size`).
+
+    Later keys take precedence over earlier ones, with dicts being merged as in plotly's `update_layout`. As in plotly,
+    a string title is the text of the title (e.g., `title="T", title_font_size=12` becomes `title.text` and
+    `title.font.size`). A ValueError is raised if a key nests under a name with a value that is neither a dict nor a title.
+    """
+    def expanded(name, value):
+        return dict(text=value) if name == "title" and isinstance(value, str) else value
+
+    def merge(node, name, value, key):
+        value = expanded(name, value)
+        current = expanded(name, node.get(name))
+        if isinstance(value, dict) and isinstance(current, dict):
+            for k, v in value.items():
+                merge(current, k, v, key)
+            node[name] = current
+        elif isinstance(value, dict) and current is not None and not isinstance(current, dict):
+            raise ValueError(f"Could not set `{key}` because `{name}` has value {current!r}, which is not a dict.")
+        else:
+            node[name] = value
+
+    result = dict()
+    for key, value in options.items():
+        path = [key] if key in UNDERSCORED_PROPERTIES else key.split("_")
+        node = result
+        for name in path[:-1]:
+            current = expanded(name, node.get(name))
+            if current is None:
+                current = dict()
+            if not isinstance(current, dict):
+                raise ValueError(f"Could not set `{key}` because `{name}` has value {current!r}, which is not a dict.")
+            node[name] = current
+            node = current
+        merge(node, path[-1], nested(value) if isinstance(value, dict) else value, key)
+    return result
+
+
+def template(name: str) -> dict:
+    """Return the plotly template with given name as a plain dict."""
+    if name not in TEMPLATES:
+        TEMPLATES[name] = pio.templates[name].to_plotly_json()
+    return TEMPLATES[name]
+
+
+class TrackedDict(dict):
+    """
+    A dict that records which keys have been assigned or removed since its changes were last collected.
+
+    All the ways of changing a dict are tracked (assignment, `update`, `|=`, `setdefault`, `pop`, `popitem`, `del`, and
+    `clear`), so that no change is missed when only the changed keys are pushed to plotly.
+    """
+
+    def __init__(self):
+        """Construct an empty TrackedDict object."""
+        super().__init__()
+        self.changed = dict()  # the changed keys in order of their last change (the values are unused)
+
+
+    def touch(self, key):
+        """Record that a key has been assigned or removed."""
+        self.changed.pop(key, None)
+        self.changed[key] = None
+
+
+    def __setitem__(self, key, value):
+        super().__setitem__(key, value)
+        self.touch(key)
+
+
+    def __delitem__(self, key):
+        super().__delitem__(key)
+        self.touch(key)
+
+
+    def __ior__(self, other):
+        self.update(other)
+        return self
+
+
+    def update(self, other = (), **kwargs):
+        for key, value in dict(other, **kwargs).items():
+            self[key] = value
+
+
+    def setdefault(self, key, default = None):
+        if key not in self:
+            self[key] = default
+        return self[key]
+
+
+    def pop(self, key, *default):
+        if key in self:
+            self.touch(key)
+        return super().pop(key, *default)
+
+
+    def popitem(self):
+        key, value = super().popitem()
+        self.touch(key)
+        return key, value
+
+
+    def clear(self):
+        for key in self:
+            self.touch(key)
+        super().clear()
+
+
+    def dirty(self) -> bool:
+        """Return True if any key has been assigned or removed since the changes were last collected."""
+        return len(self.changed) > 0
+
+
+    def changes(self) -> dict:
+        """
+        Return the keys changed since the last call, with their current values, and start tracking anew.
+
+        Removed keys have value None, which makes plotly reset them to their defaults.
+        """
+        result = {key: self.get(key) for key in self.changed}
+        self.changed = dict()
+        return result
+
+
 class Figure:
     """
     Used to create, show, and save figures using plotly.
     """
 
-    def __init__(self):
-        """Construct a default Figure object."""
-        self.fig = pgo.Figure()
-        self.layout = dict()
-        self.xaxis = dict()
-        self.yaxis = dict()
+    def __init__(self, fast: bool = False, validate: bool = VALIDATE):
+        """
+        Construct a default Figure object.
+
+        Args:
+            fast (bool): Whether traces and layout are kept as plain dicts and the plotly figure is built once, without validation, when shown or saved. Defaults to False.
+            validate (bool): Whether a figure in fast mode should still be validated by plotly when built. Defaults to `REAKTPLOT_VALIDATE` environment variable.
+        """
+        self.fig = None if fast else pgo.Figure()
+        self.fast = fast
+        self.validate = validate
+        self.traces = []
+        self.frames = []
+        self.layout = TrackedDict()
+        self.xaxis = TrackedDict()
+        self.yaxis = TrackedDict()
+        self.built = None  # the figure dict built in fast mode, reused while traces and layout are unchanged
+
+
+    def addTrace(self, trace: dict):
+        """
+        Add a trace, given as a dict with a `type` key, to the figure.
+
+        The trace is buffered instead of being added to the plotly figure right away, because each `add_trace` call in
+        plotly re-validates and re-indexes all existing traces. The buffered traces are added in a single batch when the
+        figure is shown or saved, or when `commit` is called.
+        """
+        self.traces.append(trace)
+        self.built = None
+
+
+    def commit(self):
+        """Add the buffered traces to the plotly figure in a single batch (traces in fast mode are never committed)."""
+        if self.fast or not self.traces:
+            return
+        self.fig.add_traces(self.traces)
+        self.traces = []
+
+
+    def clearTraces(self):
+        """
+        Remove all traces from the figure, keeping its layout.
+
+        Use this to reuse a figure in a loop (e.g., to produce the frames of an animation) instead of creating a new
+        figure, whose layout and template would have to be set up again.
+        """
+        self.traces = []
+        self.built = None
+        if not self.fast:
+            self.fig.data = []
+
+
+    def addFrame(self, frame: dict):
+        """
+        Add a frame to the animated figure, given as a dict with keys `name`, `data` and `layout`.
+
+        The i-th trace in `data` updates the i-th trace of the figure, so it only needs the attributes that change
+        (e.g., the z values of a contour). The layout in `layout`, if any, updates the layout of the figure.
+        """
+        self.frames.append(frame)
+        self.built = None
+        if not self.fast:
+            data = [nested(trace) for trace in frame.get("data", [])]
+            self.fig.frames += (pgo.Frame(name=frame.get("name"), data=data, layout=nested(frame.get("layout", {}))),)
+
+
+    def clearFrames(self):
+        """Remove all frames from the figure, keeping its traces and layout."""
+        self.frames = []
+        self.built = None
+        if not self.fast:
+            self.fig.frames = []
+
+
+    def reset(self):
+        """
+        Remove all traces, frames and layout customizations from the figure, keeping its template.
+        """
+        self.clearTraces()
+        self.clearFrames()
+        self.layout = TrackedDict()
+        self.xaxis = TrackedDict()
+        self.yaxis = TrackedDict()
+        if not self.fast:
+            self.fig.layout = pgo.Layout(template=self.fig.layout.template)
+
+
+    def flush(self):
+        """
+        Bring the plotly figure up to date with the buffered traces and the layout changes since the last flush.
+
+        Only the layout and axis keys assigned since the last flush are pushed to plotly, so that successive saves of an
+        unchanged figure (e.g., to PNG, SVG and PDF in a row) perform no layout work at all.
+        """
+        if self.fast:
+            if self.built is None or self.layout.dirty() or self.xaxis.dirty() or self.yaxis.dirty():
+                self.built = self.build()
+            return
+        self.commit()
+        layout, xaxis, yaxis = self.layout.changes(), self.xaxis.changes(), self.yaxis.changes()
+        if layout: self.fig.update_layout(layout)
+        if xaxis: self.fig.update_xaxes(xaxis)
+        if yaxis: self.fig.update_yaxes(yaxis)
 
 
     def drawLine(self, x, y, name: str, linespecs = LineSpecs()):
         """Draw a line in the figure."""
-        self.fig.add_trace(pgo.Scatter(x=x, y=y, name=name, mode="lines", line=linespecs.options))
+        self.addTrace(dict(type="scatter", x=x, y=y, name=name, mode="lines", line=linespecs.options))
 
 
     def drawLineWithMarkers(self, x, y, name: str, linespecs = LineSpecs(), markerspecs = MarkerSpecs()):
         """Draw a line with markers in the figure."""
-        self.fig.add_trace(pgo.Scatter(x=x, y=y, name=name, mode='lines+markers', line=linespecs.options, marker=markerspecs.options))
+        self.addTrace(dict(type="scatter", x=x, y=y, name=name, mode="lines+markers", line=linespecs.options, marker=markerspecs.options))
 
 
     def drawMarkers(self, x, y, name: str, markerspecs = MarkerSpecs()):
         """Draw markers in the figure."""
-        self.fig.add_trace(pgo.Scatter(x=x, y=y, name=name, mode='markers', marker=markerspecs.options))
+        self.addTrace(dict(type="scatter", x=x, y=y, name=name, mode="markers", marker=markerspecs.options))
 
 
     def drawContour(self, x, y, z, contourspecs = ContourSpecs()):
         """Draw a contour in the figure."""
-        self.fig.add_contour(x=x, y=y, z=z, **contourspecs.options)
+        self.addTrace(dict(type="contour", x=x, y=y, z=z, **contourspecs.options))
+
+
+    def todict(self) -> dict:
+        """
+        Return the figure as a plain dict ready for plotly.io functions.
+
+        In fast mode, the dict is built once from the accumulated traces and layout, with magic underscore keys expanded
+        and the default template inserted, without any validation by plotly (unless `validate` is True). The built dict
+        is reused until the traces or the layout change.
+        """
+        self.flush()
+        return self.built if self.fast else self.fig.to_dict()
+
+
+    def plain(self) -> dict:
+        """
+        Return the figure as a dict to be serialized with `writeJson`, without copying the whole figure.
+
+        Unlike `todict` in regular mode, for which plotly deep-copies the whole figure at once, the dict holds the
+        traces, layout, and frames of the plotly figure as they are, and `writeJson` converts them one at a time.
+        """
+        self.flush()
+        if self.fast:
+            return self.built
+        fig = dict(data=self.fig.data, layout=self.fig.layout)
+        if self.fig.frames:
+            fig["frames"] = self.fig.frames
+        return fig
+
+
+    def build(self) -> dict:
+        """Build the figure dict in fast mode from the accumulated traces and layout."""
+        for options in [self.layout, self.xaxis, self.yaxis]:
+            options.changes()  # reset change tracking since the whole layout is used below
+        layout = nested(self.layout)
+        layout["template"] = layout.get("template", pio.templates.default)
+        if isinstance(layout["template"], str):
+            layout["template"] = template(layout["template"])
+        layout["xaxis"] = {**layout.get("xaxis", {}), **nested(self.xaxis)}
+        layout["yaxis"] = {**layout.get("yaxis", {}), **nested(self.yaxis)}
+        fig = dict(data=[nested(trace) for trace in self.traces], layout=layout)
+        if self.frames:
+            fig["frames"] = [dict(name=frame.get("name"), data=[nested(trace) for trace in frame.get("data", [])], layout=nested(frame.get("layout", {}))) for frame in self.frames]
+        return pgo.Figure(fig).to_dict() if self.validate else fig
 
 
     def show(self):
         """Show the figure."""
-        self.fig.update_layout(self.layout)
-        self.fig.update_xaxes(self.xaxis)
-        self.fig.update_yaxes(self.yaxis)
-        self.fig.show()
+        self.flush()
+        if self.fast:
+            pio.show(self.built, validate=False)
+        else:
+            self.fig.show()
 
 
-    def save(self, file: str, width: int = 800, height: int = 500, scale: float = 1.0):
+    def save(self, file: str, width: int = 800, height: int = 500, scale: float = 1.0, html: str = None):
         """
-        Save the figure to a PNG, JPEG, WEBP, SVG, PDF, EPS, or HTML file.
+        Save the figure to a PNG, JPEG, WEBP, SVG, PDF, EPS, HTML, or JSON file.
+
+        JSON files are written with `writeJson`, which streams the data arrays to the file in chunks, and compressed
+        with gzip as they are written if their extension is `.json.gz`.
 
         Args:
-            file (str): The name of the file with extension `.png`, `.jpeg`, 'jpg', `.webp`, `.svg`, `.pdf`, `.eps`, or `.html`.
+            file (str): The name of the file with extension `.png`, `.jpeg`, 'jpg', `.webp`, `.svg`, `.pdf`, `.eps`, `.html`, `.json`, or `.json.gz`.
             width (int): The width of the figure (in px). Defaults to 800.
             height (int): The height of the figure (in px). Defaults to 500.
             scale (float): The scaling factor applied to the figure. Defaults to 1.0.
-        """
-        self.fig.update_layout(self.layout)
-        self.fig.update_xaxes(self.xaxis)
-        self.fig.update_yaxes(self.yaxis)
-        self.fig.write_image(file, width=width, height=height, scale=scale)
+            html (str): How plotly.js is included in an HTML file (see `setHtmlMode`). Defaults to the mode of the session.
+        """
+        self.flush()
+        if file.lower().endswith((".json", ".json.gz")):
+            with (gzip.open if file.lower().endswith(".gz") else open)(file, "wt", encoding="utf-8") as out:
+                writeJson(self.plain(), out)
+        elif file.lower().endswith(".html"):
+            options = HTML_MODES[html or HTML_MODE]
+            size = dict(default_width=f"{width}px", default_height=f"{height}px")
+            if self.fast:
+                pio.write_html(self.built, file, validate=False, **size, **options)
+            else:
+                self.fig.write_html(file, **size, **options)
+        elif self.fast:
+            pio.write_image(self.built, file, width=width, height=height, scale=scale, validate=False)
+        else:
+            self.fig.write_image(file, width=width, height=height, scale=scale)
 
 
     #=================================================================================================================
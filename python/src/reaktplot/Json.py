@@ -0,0 +1,95 @@
+# reaktplot - a modern C++ scientific plotting library powered by plotly
+# https://github.com/reaktplot/reaktplot
+#
+# Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+#
+# Copyright (c) 2022-2023 Allan Leal
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+# associated documentation files (the "Software"), to deal in the Software without restriction,
+# including without limitation the rights to use, copy, modify, merge, publish, distribute,
+# sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in all copies or
+# substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+# NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+# NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+# DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+import json
+import math
+
+import numpy as np
+import plotly.utils
+from plotly.basedatatypes import BasePlotlyType
+
+
+# The number of values of a data array formatted and written at a time, which bounds the memory used to write it.
+CHUNK_SIZE = 65536
+
+
+def writeJson(figure: dict, out, chunksize: int = CHUNK_SIZE):
+    """
+    Write a figure dict (e.g., from `Figure.plain`) to a text stream in plotly's JSON format.
+
+    The data arrays of the traces are written straight to the stream in chunks of `chunksize` values, instead of
+    building the whole JSON string (and a list copy of each array) in memory as `plotly.io.write_json` does, so that
+    the memory used beyond the figure itself stays bounded regardless of its size. Non-finite numbers (e.g., NaN in
+    missing data) are written as `null`. The figure may hold plotly objects (e.g., the traces of a plotly figure), each
+    converted to a dict only when written, so that the memory used is that of the largest one instead of all of them.
+
+    Args:
+        figure (dict): The figure with keys `data` and `layout` (and `frames` if animated).
+        out: The text stream (e.g., an open file) the figure is written to.
+        chunksize (int): The number of values of a data array written at a time. Defaults to 65536.
+    """
+    def writeArray(array: np.ndarray):
+        if array.ndim == 0:
+            return write(array.item())
+        if array.ndim > 1:
+            out.write("[")
+            for i, row in enumerate(array):
+                if i: out.write(",")
+                writeArray(row)
+            out.write("]")
+            return
+        out.write("[")
+        for begin in range(0, array.size, chunksize):
+            chunk = array[begin:begin + chunksize]
+            if begin: out.write(",")
+            if chunk.dtype.kind == "f" and not np.isfinite(chunk).all():
+                out.write(",".join(repr(x) if math.isfinite(x) else "null" for x in chunk.tolist()))
+            else:
+                out.write(json.dumps(chunk.tolist(), separators=(",", ":"))[1:-1])
+        out.write("]")
+
+    def write(value):
+        if isinstance(value, np.ndarray) and value.dtype.kind in "biuf":
+            writeArray(value)
+        elif isinstance(value, BasePlotlyType):  # a trace, layout, or frame of a plotly figure
+            write(value.to_plotly_json())
+        elif isinstance(value, dict):
+            out.write("{")
+            for i, (key, item) in enumerate(value.items()):
+                if i: out.write(",")
+                out.write(json.dumps(str(key)))
+                out.write(":")
+                write(item)
+            out.write("}")
+        elif isinstance(value, (list, tuple)):
+            out.write("[")
+            for i, item in enumerate(value):
+                if i: out.write(",")
+                write(item)
+            out.write("]")
+        elif isinstance(value, float) and not math.isfinite(value):
+            out.write("null")
+        else:  # strings, numbers, and anything else plotly knows how to encode (e.g., dates)
+            out.write(json.dumps(value, cls=plotly.utils.PlotlyJSONEncoder, separators=(",", ":")))
+
+    write(figure)
@@ -0,0 +1,175 @@
+# reaktplot - a modern C++ scientific plotting library powered by plotly
+# https://github.com/reaktplot/reaktplot
+#
+# Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+#
+# Copyright (c) 2022-2023 Allan Leal
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+# associated documentation files (the "Software"), to deal in the Software without restriction,
+# including without limitation the rights to use, copy, modify, merge, publish, distribute,
+# sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in all copies or
+# substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+# NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+# NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+# DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+import os
+
+import plotly.graph_objects as pgo
+import plotly.io as pio
+
+
+def descendants(pid: int) -> list:
+    """Return the ids of all processes started (directly or not) by a process (empty if `/proc` is not available)."""
+    pids = []
+    try:
+        for task in os.listdir(f"/proc/{pid}/task"):
+            with open(f"/proc/{pid}/task/{task}/children") as file:
+                for child in file.read().split():
+                    pids += [int(child)] + descendants(int(child))
+    except OSError:
+        pass
+    return pids
+
+
+def rss(pid: int) -> float:
+    """Return the resident memory (in MB) of a process, or zero if unknown."""
+    try:
+        with open(f"/proc/{pid}/statm") as file:
+            return int(file.read().split()[1]) * os.sysconf("SC_PAGE_SIZE") / 2**20
+    except (OSError, ValueError, IndexError):
+        return 0.0
+
+
+class RenderSession:
+    """
+    The image renderer (kaleido) started once and reused across all saved figures.
+
+    Kaleido renders figures in a headless Chromium that is started on the first image export and kept alive afterwards.
+    Its memory keeps growing as figures are rendered, so the session restarts it (i.e., recycles it) after a given
+    number of renders or once the renderer processes use more than a given amount of resident memory.
+    """
+
+    def __init__(self, maxrenders: int = 0, maxmemory: float = 0.0):
+        """
+        Construct a RenderSession object without starting the renderer.
+
+        Args:
+            maxrenders (int): The number of renders after which the renderer is recycled (zero means never). Defaults to 0.
+            maxmemory (float): The resident memory (in MB) of the renderer processes above which the renderer is recycled (zero means never). Defaults to 0.0.
+        """
+        self.maxrenders = maxrenders
+        self.maxmemory = maxmemory
+        self.running = False
+        self.renders = 0  # the number of renders since the renderer was last started
+        self.recycles = 0  # the number of times the renderer has been recycled
+
+    def start(self):
+        """Start the renderer, if not running yet."""
+        if self.running:
+            return
+        import kaleido
+        if hasattr(kaleido, "start_sync_server"):  # kaleido >= 1.0 starts a new browser for every export otherwise
+            kaleido.start_sync_server(silence_warnings=True)
+        self.running = True
+        self.renders = 0
+
+    def stop(self):
+        """Stop the renderer, if running, releasing all of its memory."""
+        if not self.running:
+            return
+        import kaleido
+        if hasattr(kaleido, "stop_sync_server"):
+            kaleido.stop_sync_server(silence_warnings=True)
+        scope = getattr(getattr(pio, "kaleido", None), "scope", None)
+        if hasattr(scope, "_shutdown_kaleido"):  # kaleido < 1.0 keeps its Chromium subprocess in plotly's scope
+            scope._shutdown_kaleido()
+        self.running = False
+
+    def recycle(self):
+        """Stop the renderer so that it is started anew on the next render."""
+        self.stop()
+        self.recycles += 1
+
+    def warmup(self):
+        """Start the renderer and render a tiny dummy figure so that the first actual figure does not pay for it."""
+        self.start()
+        pgo.Figure(data=[pgo.Scatter(x=[0], y=[0])]).to_image(format="png", width=16, height=16)
+
+    def memory(self) -> float:
+        """Return the resident memory (in MB) used by the renderer processes (zero if unknown or not running)."""
+        return sum(rss(pid) for pid in descendants(os.getpid())) if self.running else 0.0
+
+    def save(self, figure, file: str, width: int = 800, height: int = 500, scale: float = 1.0):
+        """
+        Save a figure to an image file using the renderer of this session, recycling it afterwards if needed.
+
+        Args:
+            figure (Figure | dict): The figure to be saved, as a reaktplot figure or a figure dict in plotly's format.
+            file (str): The name of the file with extension `.png`, `.jpeg`, 'jpg', `.webp`, `.svg`, `.pdf`, or `.eps`.
+            width (int): The width of the figure (in px). Defaults to 800.
+            height (int): The height of the figure (in px). Defaults to 500.
+            scale (float): The scaling factor applied to the figure. Defaults to 1.0.
+        """
+        self.start()
+        if isinstance(figure, dict):
+            pio.write_image(figure, file, width=width, height=height, scale=scale, validate=False)
+        else:
+            figure.save(file, width, height, scale)
+        self.rendered(1)
+
+    def saveAll(self, figure, outputs: list):
+        """
+        Save a figure to many image files using the renderer of this session, recycling it afterwards if needed.
+
+        The figure is brought up to date and converted to a figure dict once, and all images (e.g., the same figure in
+        PNG, SVG and PDF format, or a thumbnail and a full-size image) are then produced from it in a single batch.
+
+        Args:
+            figure (Figure | dict): The figure to be saved, as a reaktplot figure or a figure dict in plotly's format.
+            outputs (list): The files given as tuples `(file, width, height, scale)`.
+        """
+        self.start()
+        fig = figure if isinstance(figure, dict) else figure.todict()
+        import kaleido
+        if hasattr(kaleido, "write_fig_from_object_sync"):  # kaleido >= 1.0 renders all images in one batch
+            kaleido.write_fig_from_object_sync([
+                dict(fig=fig, path=file, opts=dict(format=os.path.splitext(file)[1][1:].lower(), width=width, height=height, scale=scale))
+                for file, width, height, scale in outputs])
+        else:
+            for file, width, height, scale in outputs:
+                pio.write_image(fig, file, width=width, height=height, scale=scale, validate=False)
+        self.rendered(len(outputs))
+
+    def image(self, figure, format: str, width: int = 800, height: int = 500, scale: float = 1.0) -> bytes:
+        """
+        Return a figure rendered by the renderer of this session as the contents of an image file, recycling the renderer afterwards if needed.
+
+        Args:
+            figure (Figure | dict): The figure to be rendered, as a reaktplot figure or a figure dict in plotly's format.
+            format (str): The format of the image (`png`, `jpeg`, `webp`, `svg`, `pdf`, or `eps`).
+            width (int): The width of the figure (in px). Defaults to 800.
+            height (int): The height of the figure (in px). Defaults to 500.
+            scale (float): The scaling factor applied to the figure. Defaults to 1.0.
+        """
+        self.start()
+        fig = figure if isinstance(figure, dict) else figure.todict()
+        image = pio.to_image(fig, format=format, width=width, height=height, scale=scale, validate=False)
+        self.rendered(1)
+        return image
+
+    def rendered(self, count: int):
+        """Count the renders just done and recycle the renderer if it has reached its limits."""
+        self.renders += count
+        if self.maxrenders and self.renders >= self.maxrenders:
+            self.recycle()
+        elif self.maxmemory and self.memory() > self.maxmemory:
+            self.recycle()
@@ -0,0 +1,60 @@
+# reaktplot - a modern C++ scientific plotting library powered by plotly
+# https://github.com/reaktplot/reaktplot
+#
+# Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+#
+# Copyright (c) 2022-2023 Allan Leal
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+# associated documentation files (the "Software"), to deal in the Software without restriction,
+# including without limitation the rights to use, copy, modify, merge, publish, distribute,
+# sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in all copies or
+# substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+# NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+# NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+# DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+"""
+The worker process of a reaktplot::RenderPool, started as `python -m reaktplot.RenderWorker maxrenders maxmemory`.
+
+Each line read from the standard input is a job in JSON format with keys `figure` (in plotly's format), `file`,
+`width`, `height`, and `scale`. The figure is saved with a RenderSession and a line is written back for each job,
+either `ok` or `error` followed by the error message.
+"""
+
+import json
+import os
+import sys
+
+from .RenderSession import RenderSession
+
+
+def main(argv: list):
+    """Render the jobs read from the standard input until it is closed."""
+    maxrenders = int(argv[1]) if len(argv) > 1 else 0
+    maxmemory = float(argv[2]) if len(argv) > 2 else 0.0
+    replies = os.fdopen(os.dup(1), "w")  # keep the replies apart from anything printed by plotly or the renderer
+    os.dup2(2, 1)
+    session = RenderSession(maxrenders, maxmemory)
+    for line in sys.stdin:
+        if not line.strip():
+            continue
+        try:
+            job = json.loads(line)
+            session.save(job["figure"], job["file"], job["width"], job["height"], job["scale"])
+            replies.write("ok\n")
+        except Exception as error:
+            replies.write("error " + " ".join(f"{type(error).__name__}: {error}".split()) + "\n")
+        replies.flush()
+    session.stop()
+
+
+if __name__ == "__main__":
+    main(sys.argv)
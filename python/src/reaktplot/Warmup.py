@@ -0,0 +1,40 @@
+# reaktplot - a modern C++ scientific plotting library powered by plotly
+# https://github.com/reaktplot/reaktplot
+#
+# Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+#
+# Copyright (c) 2022-2023 Allan Leal
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+# associated documentation files (the "Software"), to deal in the Software without restriction,
+# including without limitation the rights to use, copy, modify, merge, publish, distribute,
+# sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in all copies or
+# substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+# NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+# NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+# DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+import plotly.graph_objects as pgo
+
+
+def warmup(renderer: bool = False):
+    """
+    Load the plotly modules used by reaktplot so that the first figure does not pay for it.
+
+    Plotly imports its graph objects and validators lazily. Creating a throwaway figure with the trace types used by
+    reaktplot forces these imports. Optionally, the image renderer (kaleido) is also started with a dummy render.
+
+    Args:
+        renderer (bool): Whether the image renderer should be started too. Defaults to False.
+    """
+    fig = pgo.Figure(data=[pgo.Scatter(x=[0], y=[0]), pgo.Contour(x=[0], y=[0], z=[[0]])])
+    fig.update_layout(title_text="warmup")
+    if renderer:
+        fig.to_image(format="png", width=16, height=16)
@@ -25,8 +25,15 @@
 from . import DefaultTheme
 
 from .Figure import Figure
+from .Figure import setHtmlMode
+
+from .Json import writeJson
+
+from .RenderSession import RenderSession
 
 from .Specs import FontSpecs
 from .Specs import LineSpecs
 from .Specs import MarkerSpecs
 from .Specs import ContourSpecs
+
+from .Warmup import warmup
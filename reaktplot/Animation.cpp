@@ -0,0 +1,211 @@
+// reaktplot - a modern C++ scientific plotting library powered by plotly
+// https://github.com/reaktplot/reaktplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2022-2023 Allan Leal
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+// NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include "Animation.hpp"
+
+// C++ includes
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace reaktplot {
+namespace {
+
+/// Return true if two values are the same, taking NaN (e.g., a missing value in a contour) as equal to itself.
+auto same(double a, double b) -> bool
+{
+    return a == b || (std::isnan(a) && std::isnan(b));
+}
+
+/// Return the attributes of each trace changed in some frame of an animated figure.
+auto changedKeys(FigureSpecs const& specs) -> std::vector<std::vector<std::string>>
+{
+    std::vector<std::vector<std::string>> changed;
+
+    auto const add = [&](std::size_t trace, std::string const& key)
+    {
+        if(changed.size() <= trace)
+            changed.resize(trace + 1);
+        auto& keys = changed[trace];
+        if(std::find(keys.begin(), keys.end(), key) == keys.end())
+            keys.push_back(key);
+    };
+
+    for(auto const& frame : specs.frames)
+    {
+        for(std::size_t i = 0; i < frame.traces.size(); ++i)
+            for(auto const& [key, value] : frame.traces[i])
+                add(i, key);
+        for(auto const& delta : frame.deltas)
+            add(delta.trace, delta.key);
+    }
+
+    return changed;
+}
+
+} // namespace
+
+auto encodeDelta(Column const& reference, Column const& column, double fraction) -> std::optional<ColumnDelta>
+{
+    if(reference.isStrings() || column.isStrings() || reference.rows() != column.rows() || reference.cols() != column.cols() || reference.size() != column.size())
+        return {};
+
+    auto const& before = reference.numbers();
+    auto const& after = column.numbers();
+    auto const limit = fraction * after.size(); // the most numbers the delta may store (two per range and one per value)
+
+    ColumnDelta delta;
+
+    for(std::size_t i = 0; i < after.size(); ++i)
+    {
+        if(same(before[i], after[i]))
+            continue;
+        if(delta.ranges.empty() || delta.ranges.back() != i)
+        {
+            delta.ranges.push_back(i);
+            delta.ranges.push_back(i);
+        }
+        delta.values.push_back(after[i]);
+        delta.ranges.back() = i + 1;
+        if(delta.ranges.size() + delta.values.size() > limit)
+            return {};
+    }
+
+    return delta;
+}
+
+auto applyDelta(Column const& reference, ColumnDelta const& delta) -> Column
+{
+    std::vector<double> values = reference.numbers();
+    std::size_t k = 0;
+
+    for(std::size_t r = 0; r + 1 < delta.ranges.size(); r += 2)
+    {
+        auto const begin = delta.ranges[r];
+        auto const end = delta.ranges[r + 1];
+        if(begin > end || end > values.size() || k + (end - begin) > delta.values.size())
+            throw std::runtime_error("Could not apply the changes to the data column " + delta.key + " of a frame, since they do not fit in it.");
+        std::copy_n(delta.values.begin() + k, end - begin, values.begin() + begin);
+        k += end - begin;
+    }
+
+    return reference.isMatrix() ? Column(std::move(values), reference.rows(), reference.cols()) : Column(std::move(values));
+}
+
+auto deltaReference(FigureSpecs const& specs, ColumnDelta const& delta) -> Column const*
+{
+    auto const& traces = delta.keyframe < 0 ? specs.traces : specs.frames.at(delta.keyframe).traces;
+    if(delta.trace >= traces.size())
+        return nullptr;
+    auto const* value = traces[delta.trace].find(delta.key);
+    return value && value->is<Column>() ? &value->as<Column>() : nullptr;
+}
+
+auto frameFigure(FigureSpecs const& specs, std::size_t index) -> FigureSpecs
+{
+    auto const& frame = specs.frames.at(index);
+
+    FigureSpecs result;
+    result.layout = specs.layout;
+    result.layout.update(frame.layout);
+    result.xaxis = specs.xaxis;
+    result.yaxis = specs.yaxis;
+    result.traces = specs.traces;
+
+    for(std::size_t i = 0; i < frame.traces.size(); ++i)
+    {
+        if(i < result.traces.size())
+            result.traces[i].update(frame.traces[i]);
+        else result.traces.push_back(frame.traces[i]);
+    }
+
+    for(auto const& delta : frame.deltas)
+        if(delta.trace < result.traces.size())
+            if(auto const* reference = deltaReference(specs, delta))
+                result.traces[delta.trace].set(delta.key, applyDelta(*reference, delta));
+
+    return result;
+}
+
+auto playbackFrames(FigureSpecs const& specs, std::size_t first, std::size_t last, bool deltas) -> std::vector<FrameSpecs>
+{
+    std::vector<FrameSpecs> frames;
+    eachPlaybackFrame(specs, first, last, deltas, [&](FrameSpecs const& frame) { frames.push_back(frame); });
+    return frames;
+}
+
+auto eachPlaybackFrame(FigureSpecs const& specs, std::size_t first, std::size_t last, bool deltas, std::function<void(FrameSpecs const&)> const& fn) -> void
+{
+    auto const changed = changedKeys(specs);
+
+    last = std::min(last, specs.frames.size());
+
+    for(auto i = first; i < last; ++i)
+    {
+        auto const& frame = specs.frames[i];
+
+        FrameSpecs result{ frame.name, frame.traces, frame.layout, {} };
+
+        for(auto const& delta : frame.deltas)
+        {
+            if(delta.trace >= result.traces.size())
+                continue;
+            if(deltas && delta.key.find('_') == std::string::npos) // nested attributes (e.g., `marker_color`) are applied here
+                result.traces[delta.trace].set(delta.key, Dict{
+                    {"keyframe", static_cast<long long>(delta.keyframe)},
+                    {"ranges", Column(std::vector<double>(delta.ranges.begin(), delta.ranges.end()))},
+                    {"values", Column(delta.values)}});
+            else if(auto const* reference = deltaReference(specs, delta))
+                result.traces[delta.trace].set(delta.key, applyDelta(*reference, delta));
+        }
+
+        for(std::size_t j = 0; j < result.traces.size() && j < changed.size() && j < specs.traces.size(); ++j)
+            for(auto const& key : changed[j])
+                if(!result.traces[j].find(key))
+                    if(auto const* value = specs.traces[j].find(key))
+                        result.traces[j].set(key, *value);
+
+        fn(result);
+    }
+}
+
+auto frameDeltaScript() -> std::string const&
+{
+    static std::string const script =
+        "function(data, frames) {"
+        " frames.forEach(function(frame) {"
+        " (frame.data || []).forEach(function(trace, k) {"
+        " Object.keys(trace).forEach(function(key) {"
+        " var d = trace[key];"
+        " if(!d || d.keyframe === undefined || !d.ranges || !d.values) return;"
+        " var ref = d.keyframe < 0 ? data[k][key] : frames[d.keyframe].data[k][key];"
+        " var matrix = Array.isArray(ref[0]), cols = matrix ? ref[0].length : 1;"
+        " var out = matrix ? ref.map(function(row) { return row.slice(); }) : ref.slice();"
+        " for(var r = 0, v = 0; r < d.ranges.length; r += 2)"
+        " for(var i = d.ranges[r]; i < d.ranges[r + 1]; ++i, ++v)"
+        " if(matrix) out[Math.floor(i / cols)][i % cols] = d.values[v]; else out[i] = d.values[v];"
+        " trace[key] = out; }); }); });"
+        " return frames; }";
+    return script;
+}
+
+} // namespace reaktplot
@@ -0,0 +1,66 @@
+// reaktplot - a modern C++ scientific plotting library powered by plotly
+// https://github.com/reaktplot/reaktplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2022-2023 Allan Leal
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+// NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#pragma once
+
+// C++ includes
+#include <cstddef>
+#include <functional>
+#include <optional>
+#include <string>
+#include <vector>
+
+// reaktplot includes
+#include <reaktplot/Column.hpp>
+#include <reaktplot/Macros.hpp>
+#include <reaktplot/Specs.hpp>
+
+namespace reaktplot {
+
+/// Return the changes of a data column from a reference column as a delta (with its trace, key and keyframe unset),
+/// or nothing if the columns differ in shape or the delta would take more than a given fraction of the column.
+RKP_EXPORT auto encodeDelta(Column const& reference, Column const& column, double fraction) -> std::optional<ColumnDelta>;
+
+/// Return the data column given by a reference column with the changes in a delta applied.
+RKP_EXPORT auto applyDelta(Column const& reference, ColumnDelta const& delta) -> Column;
+
+/// Return the data column in the keyframe (or the figure) that a delta of a frame applies to (null if missing).
+RKP_EXPORT auto deltaReference(FigureSpecs const& specs, ColumnDelta const& delta) -> Column const*;
+
+/// Return a frame of an animated figure as a standalone figure (the traces and layout of the figure updated by the frame).
+RKP_EXPORT auto frameFigure(FigureSpecs const& specs, std::size_t index) -> FigureSpecs;
+
+/// Return the frames in the range [first, last) of an animated figure as plotly plays them, with their deltas applied.
+/// Each trace of a frame also sets the attributes changed by any other frame, since plotly updates the traces shown
+/// when jumping from one frame to another. If @p deltas is true, the deltas are kept as `{"keyframe", "ranges",
+/// "values"}` dictionaries instead, to be applied in the browser by the script in @ref frameDeltaScript.
+RKP_EXPORT auto playbackFrames(FigureSpecs const& specs, std::size_t first, std::size_t last, bool deltas = false) -> std::vector<FrameSpecs>;
+
+/// Call a function with each frame in the range [first, last) as returned by @ref playbackFrames, one at a time, so
+/// that the frames with their deltas applied are never all in memory (e.g., while the figure is written to a file).
+RKP_EXPORT auto eachPlaybackFrame(FigureSpecs const& specs, std::size_t first, std::size_t last, bool deltas, std::function<void(FrameSpecs const& frame)> const& fn) -> void;
+
+/// Return a JavaScript function `(data, frames) => frames` that applies the deltas kept in the frames of an animated
+/// figure (see @ref playbackFrames) to the data of the figure and its keyframes.
+RKP_EXPORT auto frameDeltaScript() -> std::string const&;
+
+} // namespace reaktplot
@@ -0,0 +1,197 @@
+// reaktplot - a modern C++ scientific plotting library powered by plotly
+// https://github.com/reaktplot/reaktplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2022-2023 Allan Leal
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+// NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include "Canvas.hpp"
+
+// C++ includes
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdlib>
+#include <map>
+#include <sstream>
+
+namespace reaktplot {
+namespace {
+
+/// The widths of the printable ASCII characters in Arial (Helvetica), in thousandths of the font size.
+const short ARIAL_WIDTHS[] = {
+    278, 278, 355, 556, 556, 889, 667, 191, 333, 333, 389, 584, 278, 333, 278, 278, // space to /
+    556, 556, 556, 556, 556, 556, 556, 556, 556, 556, 278, 278, 584, 584, 584, 556, // 0 to ?
+    1015, 667, 667, 722, 722, 667, 611, 778, 722, 278, 500, 667, 556, 833, 722, 778, // @ to O
+    667, 778, 722, 667, 611, 722, 667, 944, 667, 667, 611, 278, 278, 278, 469, 556, // P to _
+    333, 556, 556, 500, 556, 556, 278, 556, 556, 222, 222, 500, 222, 833, 556, 556, // ` to o
+    556, 556, 333, 500, 278, 556, 500, 722, 500, 500, 500, 334, 260, 334, 584, 278, // p to DEL
+};
+
+/// The named CSS colors most commonly used with plotly.
+const std::map<std::string, std::string> NAMED_COLORS = {
+    {"black", "#000000"}, {"white", "#ffffff"}, {"red", "#ff0000"}, {"green", "#008000"}, {"blue", "#0000ff"},
+    {"yellow", "#ffff00"}, {"cyan", "#00ffff"}, {"magenta", "#ff00ff"}, {"gray", "#808080"}, {"grey", "#808080"},
+    {"lightgray", "#d3d3d3"}, {"lightgrey", "#d3d3d3"}, {"darkgray", "#a9a9a9"}, {"darkgrey", "#a9a9a9"},
+    {"orange", "#ffa500"}, {"purple", "#800080"}, {"brown", "#a52a2a"}, {"pink", "#ffc0cb"}, {"navy", "#000080"},
+    {"teal", "#008080"}, {"olive", "#808000"}, {"maroon", "#800000"}, {"lime", "#00ff00"}, {"silver", "#c0c0c0"},
+    {"gold", "#ffd700"}, {"darkblue", "#00008b"}, {"darkred", "#8b0000"}, {"darkgreen", "#006400"},
+    {"lightblue", "#add8e6"}, {"steelblue", "#4682b4"}, {"royalblue", "#4169e1"}, {"crimson", "#dc143c"},
+    {"firebrick", "#b22222"}, {"indigo", "#4b0082"}, {"violet", "#ee82ee"}, {"salmon", "#fa8072"},
+    {"tomato", "#ff6347"}, {"coral", "#ff7f50"}, {"orangered", "#ff4500"}, {"forestgreen", "#228b22"},
+    {"seagreen", "#2e8b57"}, {"skyblue", "#87ceeb"}, {"whitesmoke", "#f5f5f5"}, {"transparent", "rgba(0,0,0,0)"},
+};
+
+} // namespace ""
+
+auto color(std::string const& str) -> Color
+{
+    std::string s;
+    for(auto c : str)
+        if(!std::isspace(static_cast<unsigned char>(c)))
+            s.push_back(std::tolower(static_cast<unsigned char>(c)));
+
+    if(auto it = NAMED_COLORS.find(s); it != NAMED_COLORS.end())
+        return color(it->second);
+
+    Color res;
+
+    if(!s.empty() && s[0] == '#')
+    {
+        auto const hex = [&](std::size_t i, std::size_t n) { return static_cast<unsigned char>(std::strtol(s.substr(i, n).c_str(), nullptr, 16) * (n == 1 ? 17 : 1)); };
+        if(s.size() == 4 || s.size() == 5)
+        {
+            res = { hex(1, 1), hex(2, 1), hex(3, 1) };
+            if(s.size() == 5) res.a = hex(4, 1) / 255.0;
+        }
+        else if(s.size() == 7 || s.size() == 9)
+        {
+            res = { hex(1, 2), hex(3, 2), hex(5, 2) };
+            if(s.size() == 9) res.a = hex(7, 2) / 255.0;
+        }
+        return res;
+    }
+
+    if(s.rfind("rgb", 0) == 0)
+    {
+        auto const open = s.find('(');
+        if(open == std::string::npos)
+            return res;
+        std::istringstream ss(s.substr(open + 1));
+        double values[4] = {0.0, 0.0, 0.0, 1.0};
+        char sep = 0;
+        for(int i = 0; i < 4 && ss >> values[i]; ++i)
+        {
+            if(ss.peek() == '%') { ss.get(); values[i] *= i < 3 ? 2.55 : 0.01; }
+            ss >> sep;
+        }
+        auto const channel = [](double v) { return static_cast<unsigned char>(std::clamp(std::round(v), 0.0, 255.0)); };
+        return { channel(values[0]), channel(values[1]), channel(values[2]), std::clamp(values[3], 0.0, 1.0) };
+    }
+
+    return res;
+}
+
+auto mix(Color const& a, Color const& b, double t) -> Color
+{
+    auto const channel = [t](double x, double y) { return static_cast<unsigned char>(std::round(x + (y - x) * t)); };
+    return { channel(a.r, b.r), channel(a.g, b.g), channel(a.b, b.b), a.a + (b.a - a.a) * t };
+}
+
+auto Canvas::textWidth(std::string const& str, TextStyle const& style) -> double
+{
+    double width = 0.0;
+    for(std::size_t i = 0; i < str.size(); ++i)
+    {
+        auto const c = static_cast<unsigned char>(str[i]);
+        if(c >= 32 && c < 128)
+            width += ARIAL_WIDTHS[c - 32];
+        else if((c & 0xC0) != 0x80) // the first byte of a multibyte UTF-8 character (e.g., the minus sign or μ)
+            width += 584;
+    }
+    return width * style.size / 1000.0;
+}
+
+auto dashes(std::string const& dash, double width) -> std::vector<double>
+{
+    auto const w = std::max(width, 3.0);
+    if(dash.empty() || dash == "solid") return {};
+    if(dash == "dot") return { w, w };
+    if(dash == "dash") return { 3 * w, 3 * w };
+    if(dash == "longdash") return { 5 * w, 5 * w };
+    if(dash == "dashdot") return { 3 * w, w, w, w };
+    if(dash == "longdashdot") return { 5 * w, 2 * w, w, 2 * w };
+    std::vector<double> res; // a list of lengths such as "5px,10px,2px,2px" or "5%,10%"
+    std::istringstream ss(dash);
+    std::string item;
+    while(std::getline(ss, item, ','))
+    {
+        auto const value = std::atof(item.c_str());
+        res.push_back(item.find('%') != std::string::npos ? value * width / 100.0 : value);
+    }
+    return res;
+}
+
+auto dashed(std::vector<Point> const& points, std::vector<double> const& pattern) -> std::vector<std::vector<Point>>
+{
+    auto dashes = pattern;
+    if(dashes.size() % 2) // an odd number of lengths is repeated, as in SVG
+        dashes.insert(dashes.end(), pattern.begin(), pattern.end());
+
+    double total = 0.0;
+    for(auto d : dashes)
+        total += d;
+    if(dashes.empty() || total <= 0.0)
+        return { points };
+
+    std::vector<std::vector<Point>> pieces;
+    std::size_t k = 0; // the current dash (even) or gap (odd)
+    double left = dashes[0]; // the length left in the current dash or gap
+    std::vector<Point> piece;
+    if(!points.empty())
+        piece.push_back(points[0]);
+    for(std::size_t i = 1; i < points.size(); ++i)
+    {
+        Point a = points[i - 1];
+        Point const b = points[i];
+        double len = std::hypot(b.x - a.x, b.y - a.y);
+        while(len > left)
+        {
+            Point const p = { a.x + (b.x - a.x) * left / len, a.y + (b.y - a.y) * left / len };
+            if(k % 2 == 0)
+            {
+                piece.push_back(p);
+                pieces.push_back(std::move(piece));
+            }
+            piece = { p };
+            len -= left;
+            a = p;
+            k = (k + 1) % dashes.size();
+            left = dashes[k];
+        }
+        left -= len;
+        if(k % 2 == 0)
+            piece.push_back(b);
+        else piece = { b };
+    }
+    if(k % 2 == 0 && piece.size() > 1)
+        pieces.push_back(std::move(piece));
+    return pieces;
+}
+
+} // namespace reaktplot
@@ -0,0 +1,175 @@
+// reaktplot - a modern C++ scientific plotting library powered by plotly
+// https://github.com/reaktplot/reaktplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2022-2023 Allan Leal
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+// NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#pragma once
+
+// C++ includes
+#include <string>
+#include <vector>
+
+// reaktplot includes
+#include <reaktplot/Macros.hpp>
+
+namespace reaktplot {
+
+/// Used to represent a color with red, green, blue, and alpha (opacity) components.
+struct Color
+{
+    /// The red component of the color (from 0 to 255).
+    unsigned char r = 0;
+
+    /// The green component of the color (from 0 to 255).
+    unsigned char g = 0;
+
+    /// The blue component of the color (from 0 to 255).
+    unsigned char b = 0;
+
+    /// The opacity of the color (from 0 to 1).
+    double a = 1.0;
+
+    /// Return true if the color is fully transparent (i.e., nothing is drawn with it).
+    auto none() const -> bool { return a <= 0.0; }
+};
+
+/// Return the color in a CSS color string as accepted by plotly (e.g., `#f7f7f7`, `#fff`, `rgb(10, 20, 30)`, `rgba(10, 20, 30, 0.5)`, `red`).
+/// Unknown colors are returned as black.
+RKP_EXPORT auto color(std::string const& str) -> Color;
+
+/// Return the color that is a mix of two colors (e.g., `mix(a, b, 0.0)` is `a` and `mix(a, b, 1.0)` is `b`).
+RKP_EXPORT auto mix(Color const& a, Color const& b, double t) -> Color;
+
+/// Used to represent a point in the canvas (in px, with the y-axis pointing down).
+struct Point
+{
+    /// The x coordinate of the point.
+    double x = 0.0;
+
+    /// The y coordinate of the point.
+    double y = 0.0;
+};
+
+/// Used to represent a rectangle in the canvas.
+struct Rect
+{
+    /// The x coordinate of the left side of the rectangle.
+    double x = 0.0;
+
+    /// The y coordinate of the top side of the rectangle.
+    double y = 0.0;
+
+    /// The width of the rectangle.
+    double width = 0.0;
+
+    /// The height of the rectangle.
+    double height = 0.0;
+};
+
+/// Used to specify how lines are drawn.
+struct Stroke
+{
+    /// The color of the line.
+    Color color = {0, 0, 0, 0.0};
+
+    /// The width of the line (in px). Nothing is drawn if zero.
+    double width = 0.0;
+
+    /// The lengths of the alternating dashes and gaps of the line (in px), or empty for a solid line.
+    std::vector<double> dashes = {};
+
+    /// Return true if nothing is drawn with this stroke.
+    auto none() const -> bool { return width <= 0.0 || color.none(); }
+};
+
+/// Used to specify the horizontal alignment of text relative to its position.
+enum class Anchor { Start, Middle, End };
+
+/// Used to specify how text is drawn.
+struct TextStyle
+{
+    /// The font family of the text.
+    std::string family = "Arial";
+
+    /// The font size of the text (in px).
+    double size = 12.0;
+
+    /// The color of the text.
+    Color color = {};
+
+    /// The horizontal alignment of the text relative to its position.
+    Anchor anchor = Anchor::Start;
+
+    /// The rotation angle of the text around its position (in degrees, clockwise).
+    double angle = 0.0;
+};
+
+/// Used as the drawing surface of the native renderers (e.g., SVG and PNG).
+/// The renderer lays out a figure (axes, ticks, legend, traces) and draws it using the primitives below, so that every
+/// output format only needs to implement these few operations.
+class RKP_EXPORT Canvas
+{
+public:
+    /// Destroy this Canvas object.
+    virtual ~Canvas() = default;
+
+    /// Start drawing a figure with given size (in px).
+    virtual auto begin(int width, int height) -> void = 0;
+
+    /// Finish drawing the figure.
+    virtual auto end() -> void = 0;
+
+    /// Restrict the drawing of the next primitives to a rectangle until @ref unclip is called.
+    virtual auto clip(Rect const& rect) -> void = 0;
+
+    /// Remove the restriction set by @ref clip.
+    virtual auto unclip() -> void = 0;
+
+    /// Draw a rectangle.
+    virtual auto rect(Rect const& rect, Color const& fill, Stroke const& stroke = {}) -> void = 0;
+
+    /// Draw a line through given points.
+    virtual auto polyline(std::vector<Point> const& points, Stroke const& stroke) -> void = 0;
+
+    /// Draw line segments, each given by two consecutive points.
+    virtual auto segments(std::vector<Point> const& points, Stroke const& stroke) -> void = 0;
+
+    /// Fill polygons as a single shape with the nonzero rule, so that adjacent polygons show no seams between them.
+    virtual auto polygons(std::vector<std::vector<Point>> const& polygons, Color const& fill, Stroke const& stroke = {}) -> void = 0;
+
+    /// Draw a circle.
+    virtual auto circle(Point const& center, double radius, Color const& fill, Stroke const& stroke = {}) -> void = 0;
+
+    /// Draw text with its baseline starting, centered, or ending at a given position (see TextStyle::anchor).
+    virtual auto text(Point const& pos, std::string const& str, TextStyle const& style) -> void = 0;
+
+    /// Return the width of text (in px) when drawn with given style.
+    /// The default implementation uses the font metrics of Arial (Helvetica), the default font of reaktplot.
+    virtual auto textWidth(std::string const& str, TextStyle const& style) -> double;
+};
+
+/// Return the dashes of a plotly dash style (e.g., `solid`, `dot`, `dash`, `longdash`, `dashdot`, `longdashdot`, or a
+/// list of lengths such as `5px,10px,2px`) for a line of given width.
+RKP_EXPORT auto dashes(std::string const& dash, double width) -> std::vector<double>;
+
+/// Return the pieces of a line with given dashes as separate lines (the whole line if there are no dashes).
+RKP_EXPORT auto dashed(std::vector<Point> const& points, std::vector<double> const& dashes) -> std::vector<std::vector<Point>>;
+
+} // namespace reaktplot
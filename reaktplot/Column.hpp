@@ -0,0 +1,189 @@
+// reaktplot - a modern C++ scientific plotting library powered by plotly
+// https://github.com/reaktplot/reaktplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2022-2023 Allan Leal
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+// NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#pragma once
+
+// C++ includes
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace reaktplot {
+
+/// Used to store the values of a data array in a trace (e.g., its x, y, or z values).
+/// The values are stored as numbers (in row-major order for a matrix) or strings (e.g., dates) and are shared among
+/// copies of the column, so that copying a trace or a figure does not copy its data.
+class Column
+{
+private:
+    /// The numbers in the column (null if the column stores strings).
+    std::shared_ptr<std::vector<double> const> nums;
+
+    /// The strings in the column (null if the column stores numbers).
+    std::shared_ptr<std::vector<std::string> const> strs;
+
+    /// The number of rows in the column (its length if not a matrix).
+    std::size_t nrows = 0;
+
+    /// The number of columns in the column if it is a matrix, zero otherwise.
+    std::size_t ncols = 0;
+
+public:
+    /// Construct an empty Column object.
+    Column()
+    : nums(std::make_shared<std::vector<double> const>())
+    {}
+
+    /// Construct a Column object with given numbers.
+    explicit Column(std::vector<double> values)
+    : nums(std::make_shared<std::vector<double> const>(std::move(values))), nrows(nums->size())
+    {}
+
+    /// Construct a Column object with given numbers of a matrix stored in row-major order.
+    Column(std::vector<double> values, std::size_t rows, std::size_t cols)
+    : nums(std::make_shared<std::vector<double> const>(std::move(values))), nrows(rows), ncols(cols)
+    {}
+
+    /// Construct a Column object with given strings.
+    explicit Column(std::vector<std::string> values)
+    : strs(std::make_shared<std::vector<std::string> const>(std::move(values))), nrows(strs->size())
+    {}
+
+    /// Return the number of values in the column.
+    auto size() const -> std::size_t { return nums ? nums->size() : strs->size(); }
+
+    /// Return the number of rows in the column (its length if not a matrix).
+    auto rows() const -> std::size_t { return nrows; }
+
+    /// Return the number of columns in the column if it is a matrix, zero otherwise.
+    auto cols() const -> std::size_t { return ncols; }
+
+    /// Return true if the column stores the numbers of a matrix.
+    auto isMatrix() const -> bool { return ncols != 0; }
+
+    /// Return true if the column stores strings.
+    auto isStrings() const -> bool { return strs != nullptr; }
+
+    /// Return the numbers in the column (empty if the column stores strings).
+    auto numbers() const -> std::vector<double> const& { static std::vector<double> const none; return nums ? *nums : none; }
+
+    /// Return the strings in the column (empty if the column stores numbers).
+    auto strings() const -> std::vector<std::string> const& { static std::vector<std::string> const none; return strs ? *strs : none; }
+
+    /// Return the shared numbers in the column (null if the column stores strings), e.g., to hand them over to Python without copying.
+    auto shared() const -> std::shared_ptr<std::vector<double> const> const& { return nums; }
+
+    /// Return true if this and another column share the same values in memory.
+    auto shares(Column const& other) const -> bool { return nums ? nums == other.nums : strs == other.strs; }
+
+    /// Return true if this column has the same values and shape as another.
+    auto operator==(Column const& other) const -> bool { return shares(other) || (nrows == other.nrows && ncols == other.ncols && numbers() == other.numbers() && strings() == other.strings()); }
+
+    /// Return true if this column differs from another.
+    auto operator!=(Column const& other) const -> bool { return !(*this == other); }
+};
+
+namespace detail {
+
+/// Check if type @p T is a container whose elements can be converted to `std::string`.
+template<typename T, typename = void>
+constexpr auto isStringContainer = false;
+
+template<typename T>
+constexpr auto isStringContainer<T, std::void_t<decltype(*std::begin(std::declval<T const&>()))>> =
+    std::is_convertible_v<decltype(*std::begin(std::declval<T const&>())), std::string>;
+
+/// Check if type @p T is a matrix type with `rows()`, `cols()` and `operator()(i, j)` that is not a vector (e.g., `Eigen::MatrixXd`).
+template<typename T, typename = void>
+constexpr auto isMatrixType = false;
+
+template<typename T>
+constexpr auto isMatrixType<T, std::void_t<decltype(std::declval<T const&>().rows()), decltype(std::declval<T const&>()(0, 0)), decltype(T::IsVectorAtCompileTime)>> = !T::IsVectorAtCompileTime;
+
+/// Check if type @p T is a container of containers (e.g., `std::vector<std::vector<double>>`).
+template<typename T, typename = void>
+constexpr auto isNestedContainer = false;
+
+template<typename T>
+constexpr auto isNestedContainer<T, std::void_t<decltype(std::declval<T const&>()[0].size())>> = true;
+
+/// Check if type @p T supports iteration with `std::begin` and `std::end`.
+template<typename T, typename = void>
+constexpr auto isIterable = false;
+
+template<typename T>
+constexpr auto isIterable<T, std::void_t<decltype(std::begin(std::declval<T const&>())), decltype(std::end(std::declval<T const&>()))>> = true;
+
+} // namespace detail
+
+/// Return a Column with the values in a given container.
+/// Supported containers are those with numbers or strings and random access or iterators (e.g., `std::vector`,
+/// `std::valarray` and its expressions, `Eigen::VectorXd`), and matrices given as containers of containers (missing
+/// entries in shorter rows are filled with NaN) or as Eigen matrices.
+template<typename X>
+auto column(X const& x) -> Column
+{
+    if constexpr(std::is_same_v<X, Column>)
+        return x;
+    else if constexpr(detail::isStringContainer<X>)
+        return Column(std::vector<std::string>(std::begin(x), std::end(x)));
+    else if constexpr(detail::isMatrixType<X>)
+    {
+        std::size_t const rows = x.rows();
+        std::size_t const cols = x.cols();
+        std::vector<double> values;
+        values.reserve(rows * cols);
+        for(std::size_t i = 0; i < rows; ++i)
+            for(std::size_t j = 0; j < cols; ++j)
+                values.push_back(x(i, j));
+        return Column(std::move(values), rows, cols);
+    }
+    else if constexpr(detail::isNestedContainer<X>)
+    {
+        std::size_t const rows = x.size();
+        std::size_t cols = 0;
+        for(std::size_t i = 0; i < rows; ++i)
+            cols = std::max<std::size_t>(cols, x[i].size());
+        std::vector<double> values(rows * cols, std::numeric_limits<double>::quiet_NaN());
+        for(std::size_t i = 0; i < rows; ++i)
+            for(std::size_t j = 0; j < x[i].size(); ++j)
+                values[i * cols + j] = x[i][j];
+        return Column(std::move(values), rows, cols);
+    }
+    else if constexpr(detail::isIterable<X>)
+        return Column(std::vector<double>(std::begin(x), std::end(x)));
+    else
+    {
+        std::vector<double> values(x.size());
+        for(std::size_t i = 0; i < values.size(); ++i)
+            values[i] = x[i];
+        return Column(std::move(values));
+    }
+}
+
+} // namespace reaktplot
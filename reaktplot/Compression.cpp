@@ -0,0 +1,464 @@
+// reaktplot - a modern C++ scientific plotting library powered by plotly
+// https://github.com/reaktplot/reaktplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2022-2023 Allan Leal
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+// NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include "Compression.hpp"
+
+// C++ includes
+#include <algorithm>
+#include <deque>
+#include <exception>
+#include <fstream>
+#include <future>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+// zlib includes
+#ifdef REAKTPLOT_HAS_ZLIB
+#include <zlib.h>
+#endif
+
+// zstd includes
+#ifdef REAKTPLOT_HAS_ZSTD
+#include <zstd.h>
+#endif
+
+namespace reaktplot {
+namespace {
+
+/// The size of the buffers used to read and write files.
+const auto FILE_BUFFER_SIZE = std::size_t(1) << 16;
+
+/// Return true if a string ends with a given suffix.
+auto endswith(std::string const& str, std::string const& suffix) -> bool
+{
+    return str.size() >= suffix.size() && str.compare(str.size() - suffix.size(), suffix.size(), suffix) == 0;
+}
+
+/// Throw an exception if the compression format of a file is not available in this build of reaktplot.
+auto checkAvailable(std::string const& file, Compression format) -> void
+{
+#ifndef REAKTPLOT_HAS_ZLIB
+    if(format == Compression::Gzip)
+        throw std::runtime_error("Could not open file " + file + ", since reaktplot was built without zlib, needed for gzip compression.");
+#endif
+#ifndef REAKTPLOT_HAS_ZSTD
+    if(format == Compression::Zstd)
+        throw std::runtime_error("Could not open file " + file + ", since reaktplot was built without libzstd, needed for zstd compression.");
+#endif
+    (void)file;
+    (void)format;
+}
+
+#ifdef REAKTPLOT_HAS_ZLIB
+/// Return data compressed as a gzip member, which concatenated with other members gives a valid gzip file.
+auto gzipMember(std::string const& data, int level) -> std::string
+{
+    z_stream stream{};
+    if(deflateInit2(&stream, level ? level : Z_DEFAULT_COMPRESSION, Z_DEFLATED, 15 + 16, 8, Z_DEFAULT_STRATEGY) != Z_OK)
+        throw std::runtime_error("Could not initialize the gzip compressor.");
+    std::string res(deflateBound(&stream, static_cast<uLong>(data.size())), '\0');
+    stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(data.data()));
+    stream.avail_in = static_cast<uInt>(data.size());
+    stream.next_out = reinterpret_cast<Bytef*>(&res[0]);
+    stream.avail_out = static_cast<uInt>(res.size());
+    auto const status = deflate(&stream, Z_FINISH);
+    res.resize(stream.total_out);
+    deflateEnd(&stream);
+    if(status != Z_STREAM_END)
+        throw std::runtime_error("Could not compress data with gzip.");
+    return res;
+}
+#endif
+
+} // namespace
+
+auto compression(std::string const& file) -> Compression
+{
+    if(endswith(file, ".gz"))
+        return Compression::Gzip;
+    if(endswith(file, ".zst"))
+        return Compression::Zstd;
+    return Compression::None;
+}
+
+auto uncompressed(std::string const& file) -> std::string
+{
+    switch(compression(file))
+    {
+        case Compression::Gzip: return file.substr(0, file.size() - 3);
+        case Compression::Zstd: return file.substr(0, file.size() - 4);
+        default: return file;
+    }
+}
+
+/// The buffer of a CompressedOutput object, compressing each block of output when full.
+struct CompressedOutput::Buffer : std::streambuf
+{
+    /// The path to the file.
+    std::string path;
+
+    /// The file the compressed output is written to.
+    std::ofstream file;
+
+    /// The compression format of the file.
+    Compression format;
+
+    /// The options used to compress the output.
+    CompressionOptions options;
+
+    /// The number of threads compressing the output.
+    std::size_t threads;
+
+    /// The block of output not yet compressed.
+    std::vector<char> block;
+
+    /// The gzip members of the blocks of output being compressed by other threads, in the order they are written.
+    std::deque<std::future<std::string>> members;
+
+    /// Whether a gzip member was already written.
+    bool written = false;
+
+    /// Whether the file was already closed.
+    bool closed = false;
+
+    /// The error that happened while compressing the output, rethrown in @ref close.
+    std::exception_ptr error;
+
+#ifdef REAKTPLOT_HAS_ZSTD
+    /// The zstd compression context.
+    std::unique_ptr<ZSTD_CCtx, decltype(&ZSTD_freeCCtx)> zstd{nullptr, ZSTD_freeCCtx};
+
+    /// The buffer of zstd compressed output.
+    std::vector<char> zout;
+#endif
+
+    Buffer(std::string const& file, CompressionOptions const& options)
+    : path(file), format(compression(file)), options(options)
+    {
+        checkAvailable(path, format);
+
+        this->file.open(path, std::ios::binary);
+        if(!this->file)
+            throw std::runtime_error("Could not open file " + path + " for writing.");
+
+        threads = options.threads ? options.threads : std::max(1u, std::thread::hardware_concurrency());
+
+#ifdef REAKTPLOT_HAS_ZSTD
+        if(format == Compression::Zstd)
+        {
+            zstd.reset(ZSTD_createCCtx());
+            if(!zstd)
+                throw std::runtime_error("Could not initialize the zstd compressor.");
+            if(options.level)
+                ZSTD_CCtx_setParameter(zstd.get(), ZSTD_c_compressionLevel, options.level);
+            if(threads > 1) // fails harmlessly if libzstd was built without multithreading
+            {
+                ZSTD_CCtx_setParameter(zstd.get(), ZSTD_c_nbWorkers, static_cast<int>(threads));
+                ZSTD_CCtx_setParameter(zstd.get(), ZSTD_c_jobSize, static_cast<int>(std::min<std::size_t>(options.blocksize, 1 << 30)));
+            }
+            zout.resize(ZSTD_CStreamOutSize());
+        }
+#endif
+
+        block.resize(format == Compression::None ? FILE_BUFFER_SIZE : std::max<std::size_t>(options.blocksize, FILE_BUFFER_SIZE));
+        setp(block.data(), block.data() + block.size());
+    }
+
+    auto overflow(int_type c) -> int_type override
+    {
+        try { emit(); }
+        catch(...) { error = std::current_exception(); return traits_type::eof(); }
+        if(!traits_type::eq_int_type(c, traits_type::eof()))
+        {
+            *pptr() = traits_type::to_char_type(c);
+            pbump(1);
+        }
+        return traits_type::not_eof(c);
+    }
+
+    /// Compress and write the block of output.
+    auto emit() -> void
+    {
+        auto const size = static_cast<std::size_t>(pptr() - pbase());
+        setp(block.data(), block.data() + block.size());
+
+        switch(format)
+        {
+            case Compression::None:
+                file.write(block.data(), size);
+                break;
+            case Compression::Gzip:
+#ifdef REAKTPLOT_HAS_ZLIB
+                if(size == 0 && written) // an empty member is only needed for an empty output
+                    break;
+                written = true;
+                if(threads > 1)
+                {
+                    members.push_back(std::async(std::launch::async, gzipMember, std::string(block.data(), size), options.level));
+                    while(members.size() >= threads)
+                        writeMember();
+                }
+                else
+                {
+                    auto const member = gzipMember(std::string(block.data(), size), options.level);
+                    file.write(member.data(), member.size());
+                }
+#endif
+                break;
+            case Compression::Zstd:
+#ifdef REAKTPLOT_HAS_ZSTD
+                compress(block.data(), size, ZSTD_e_continue);
+#endif
+                break;
+        }
+
+        if(!file)
+            throw std::runtime_error("Could not write to file " + path + ".");
+    }
+
+    /// Write the first gzip member being compressed by another thread, once done.
+    auto writeMember() -> void
+    {
+        auto const member = members.front().get();
+        members.pop_front();
+        file.write(member.data(), member.size());
+    }
+
+#ifdef REAKTPLOT_HAS_ZSTD
+    /// Compress data with zstd and write the compressed output available.
+    auto compress(char const* data, std::size_t size, ZSTD_EndDirective mode) -> void
+    {
+        ZSTD_inBuffer in{ data, size, 0 };
+        auto finished = false;
+        while(!finished)
+        {
+            ZSTD_outBuffer out{ zout.data(), zout.size(), 0 };
+            auto const remaining = ZSTD_compressStream2(zstd.get(), &out, &in, mode);
+            if(ZSTD_isError(remaining))
+                throw std::runtime_error("Could not compress file " + path + " with zstd: " + ZSTD_getErrorName(remaining) + ".");
+            file.write(zout.data(), out.pos);
+            finished = mode == ZSTD_e_end ? remaining == 0 : in.pos == in.size;
+        }
+    }
+#endif
+
+    /// Compress the remaining output and close the file.
+    auto close() -> void
+    {
+        if(closed)
+            return;
+        closed = true;
+
+        if(error)
+            std::rethrow_exception(error);
+
+        emit();
+
+        while(!members.empty())
+            writeMember();
+
+#ifdef REAKTPLOT_HAS_ZSTD
+        if(format == Compression::Zstd)
+            compress(nullptr, 0, ZSTD_e_end);
+#endif
+
+        file.close();
+        if(!file)
+            throw std::runtime_error("Could not write to file " + path + ".");
+    }
+};
+
+CompressedOutput::CompressedOutput(std::string const& file, CompressionOptions const& options)
+: std::ostream(nullptr), buffer(new Buffer(file, options))
+{
+    rdbuf(buffer.get());
+}
+
+CompressedOutput::~CompressedOutput()
+{
+    try { close(); }
+    catch(...) {}
+}
+
+auto CompressedOutput::close() -> void
+{
+    flush();
+    buffer->close();
+}
+
+/// The buffer of a CompressedInput object, decompressing the file in blocks as it is read.
+struct CompressedInput::Buffer : std::streambuf
+{
+    /// The path to the file.
+    std::string path;
+
+    /// The file the compressed input is read from.
+    std::ifstream file;
+
+    /// The compression format of the file.
+    Compression format;
+
+    /// The compressed input read from the file and not yet decompressed.
+    std::vector<char> input;
+
+    /// The decompressed input not yet read.
+    std::vector<char> output;
+
+    /// Whether the input decompressed so far ends a complete gzip member or zstd frame.
+    bool ended = false;
+
+#ifdef REAKTPLOT_HAS_ZLIB
+    /// The gzip decompression stream.
+    z_stream gzip{};
+#endif
+
+#ifdef REAKTPLOT_HAS_ZSTD
+    /// The zstd decompression context.
+    std::unique_ptr<ZSTD_DCtx, decltype(&ZSTD_freeDCtx)> zstd{nullptr, ZSTD_freeDCtx};
+
+    /// The position of the compressed input not yet decompressed by zstd.
+    ZSTD_inBuffer zin{ nullptr, 0, 0 };
+#endif
+
+    Buffer(std::string const& file)
+    : path(file), format(compression(file)), input(FILE_BUFFER_SIZE), output(FILE_BUFFER_SIZE)
+    {
+        checkAvailable(path, format);
+
+        this->file.open(path, std::ios::binary);
+        if(!this->file)
+            throw std::runtime_error("Could not open file " + path + " for reading.");
+
+#ifdef REAKTPLOT_HAS_ZLIB
+        if(format == Compression::Gzip && inflateInit2(&gzip, 15 + 32) != Z_OK)
+            throw std::runtime_error("Could not initialize the gzip decompressor.");
+#endif
+
+#ifdef REAKTPLOT_HAS_ZSTD
+        if(format == Compression::Zstd)
+        {
+            zstd.reset(ZSTD_createDCtx());
+            if(!zstd)
+                throw std::runtime_error("Could not initialize the zstd decompressor.");
+        }
+#endif
+    }
+
+    ~Buffer()
+    {
+#ifdef REAKTPLOT_HAS_ZLIB
+        if(format == Compression::Gzip)
+            inflateEnd(&gzip);
+#endif
+    }
+
+    auto underflow() -> int_type override
+    {
+        if(gptr() < egptr())
+            return traits_type::to_int_type(*gptr());
+        auto const size = fill();
+        if(size == 0)
+            return traits_type::eof();
+        setg(output.data(), output.data(), output.data() + size);
+        return traits_type::to_int_type(*gptr());
+    }
+
+    /// Read compressed input from the file, returning its size (zero at the end of the file).
+    auto read() -> std::size_t
+    {
+        file.read(input.data(), input.size());
+        auto const size = static_cast<std::size_t>(file.gcount());
+        if(size == 0 && !ended)
+            throw std::runtime_error("Could not decompress file " + path + ", which is truncated.");
+        return size;
+    }
+
+    /// Decompress the next block of input, returning its size (zero at the end of the file).
+    auto fill() -> std::size_t
+    {
+        switch(format)
+        {
+            case Compression::None:
+                file.read(output.data(), output.size());
+                return static_cast<std::size_t>(file.gcount());
+            case Compression::Gzip:
+#ifdef REAKTPLOT_HAS_ZLIB
+                while(true)
+                {
+                    if(gzip.avail_in == 0)
+                    {
+                        auto const size = read();
+                        if(size == 0)
+                            return 0;
+                        gzip.next_in = reinterpret_cast<Bytef*>(input.data());
+                        gzip.avail_in = static_cast<uInt>(size);
+                    }
+                    gzip.next_out = reinterpret_cast<Bytef*>(output.data());
+                    gzip.avail_out = static_cast<uInt>(output.size());
+                    auto const status = inflate(&gzip, Z_NO_FLUSH);
+                    if(status != Z_OK && status != Z_STREAM_END && status != Z_BUF_ERROR)
+                        throw std::runtime_error("Could not decompress file " + path + ", which is not a valid gzip file.");
+                    ended = status == Z_STREAM_END;
+                    if(ended) // the next member, if any, follows
+                        inflateReset(&gzip);
+                    auto const size = output.size() - gzip.avail_out;
+                    if(size)
+                        return size;
+                }
+#endif
+                return 0;
+            case Compression::Zstd:
+#ifdef REAKTPLOT_HAS_ZSTD
+                while(true)
+                {
+                    if(zin.pos == zin.size)
+                    {
+                        auto const size = read();
+                        if(size == 0)
+                            return 0;
+                        zin = { input.data(), size, 0 };
+                    }
+                    ZSTD_outBuffer out{ output.data(), output.size(), 0 };
+                    auto const remaining = ZSTD_decompressStream(zstd.get(), &out, &zin);
+                    if(ZSTD_isError(remaining))
+                        throw std::runtime_error("Could not decompress file " + path + " with zstd: " + ZSTD_getErrorName(remaining) + ".");
+                    ended = remaining == 0;
+                    if(out.pos)
+                        return out.pos;
+                }
+#endif
+                return 0;
+        }
+        return 0;
+    }
+};
+
+CompressedInput::CompressedInput(std::string const& file)
+: std::istream(nullptr), buffer(new Buffer(file))
+{
+    rdbuf(buffer.get());
+}
+
+CompressedInput::~CompressedInput() = default;
+
+} // namespace reaktplot
@@ -0,0 +1,100 @@
+// reaktplot - a modern C++ scientific plotting library powered by plotly
+// https://github.com/reaktplot/reaktplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2022-2023 Allan Leal
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+// NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#pragma once
+
+// C++ includes
+#include <cstddef>
+#include <istream>
+#include <memory>
+#include <ostream>
+#include <string>
+
+// reaktplot includes
+#include <reaktplot/Macros.hpp>
+
+namespace reaktplot {
+
+/// Used to specify the compression format of a file.
+enum class Compression
+{
+    None,  ///< The file is not compressed.
+    Gzip,  ///< The file is compressed with gzip (extension `.gz`), which requires zlib.
+    Zstd,  ///< The file is compressed with zstd (extension `.zst`), which requires libzstd.
+};
+
+/// Return the compression format of a file given by its extension (e.g., `fig.json.gz` is compressed with gzip).
+RKP_EXPORT auto compression(std::string const& file) -> Compression;
+
+/// Return a file name without the extension of its compression format (e.g., `fig.json` for `fig.json.zst`).
+RKP_EXPORT auto uncompressed(std::string const& file) -> std::string;
+
+/// Used to specify how files are compressed.
+struct CompressionOptions
+{
+    /// The compression level (e.g., from 1 to 9 for gzip and from 1 to 19 for zstd), or zero for the default of the format.
+    int level = 0;
+
+    /// The number of threads compressing large outputs, or zero to use all hardware threads.
+    std::size_t threads = 0;
+
+    /// The size of the blocks of output compressed by each thread, so that outputs smaller than this use a single thread.
+    std::size_t blocksize = std::size_t(1) << 22;
+};
+
+/// Used to write a file through a compressor chosen by its extension (see @ref compression) as it is written, so
+/// that large outputs (e.g., the JSON of a figure with hundreds of MB of data) are never held in memory. With gzip,
+/// the blocks of output are compressed in parallel as concatenated gzip members, which gzip tools and zlib read as a
+/// single stream. With zstd, the blocks are compressed in parallel by the worker threads of libzstd.
+class RKP_EXPORT CompressedOutput : public std::ostream
+{
+public:
+    /// Construct a CompressedOutput object that writes to a given file.
+    explicit CompressedOutput(std::string const& file, CompressionOptions const& options = {});
+
+    /// Destroy this CompressedOutput object after closing the file (see @ref close).
+    ~CompressedOutput();
+
+    /// Compress the remaining output and close the file, throwing an exception if it could not be written.
+    auto close() -> void;
+
+private:
+    struct Buffer;
+    std::unique_ptr<Buffer> buffer;
+};
+
+/// Used to read a file through a decompressor chosen by its extension (see @ref compression) as it is read.
+class RKP_EXPORT CompressedInput : public std::istream
+{
+public:
+    /// Construct a CompressedInput object that reads from a given file.
+    explicit CompressedInput(std::string const& file);
+
+    /// Destroy this CompressedInput object.
+    ~CompressedInput();
+
+private:
+    struct Buffer;
+    std::unique_ptr<Buffer> buffer;
+};
+
+} // namespace reaktplot
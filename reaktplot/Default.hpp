@@ -33,5 +33,8 @@ namespace reaktplot {
 const auto DEFAULT_FIGURE_HEIGHT = 500; // in px
 const auto DEFAULT_FIGURE_WIDTH = 800; // in px
 const auto DEFAULT_FIGURE_SCALE = 1.0;
+const auto DEFAULT_FRAME_DURATION = 500; // in ms
+const auto DEFAULT_FRAME_DELTA_FRACTION = 0.25;
+const auto DEFAULT_TILE_SIZE = 1024; // in pixels
 
 } // namespace reaktplot
@@ -0,0 +1,84 @@
+// reaktplot - a modern C++ scientific plotting library powered by plotly
+// https://github.com/reaktplot/reaktplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2022-2023 Allan Leal
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+// NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include "Executor.hpp"
+
+// C++ includes
+#include <algorithm>
+
+namespace reaktplot {
+
+Executor::Executor(std::size_t numthreads)
+{
+    for(std::size_t i = 0; i < std::max<std::size_t>(numthreads, 1); ++i)
+        threads.emplace_back([this]
+        {
+            std::function<void()> task;
+            while(true)
+            {
+                {
+                    std::unique_lock<std::mutex> lock(mutex);
+                    posted.wait(lock, [&] { return !tasks.empty() || stopping; });
+                    if(tasks.empty())
+                        return;
+                    task = std::move(tasks.front());
+                    tasks.pop_front();
+                }
+                try { task(); } catch(...) {} // submitted tasks report their errors through futures
+                task = nullptr;
+            }
+        });
+}
+
+Executor::~Executor()
+{
+    stop();
+}
+
+auto Executor::post(std::function<void()> fn) -> void
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        tasks.push_back(std::move(fn));
+    }
+    posted.notify_one();
+}
+
+auto Executor::stop() -> void
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    posted.notify_all();
+    for(auto& thread : threads)
+        if(thread.joinable())
+            thread.join();
+}
+
+auto executor() -> Executor&
+{
+    static Executor instance;
+    return instance;
+}
+
+} // namespace reaktplot
@@ -0,0 +1,96 @@
+// reaktplot - a modern C++ scientific plotting library powered by plotly
+// https://github.com/reaktplot/reaktplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2022-2023 Allan Leal
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+// NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#pragma once
+
+// C++ includes
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// reaktplot includes
+#include <reaktplot/Macros.hpp>
+
+namespace reaktplot {
+
+/// Used to run tasks in background threads, in the order they are submitted.
+/// With a single thread (the default), each task starts once the previous one has finished, so that tasks working
+/// on the same data (e.g., successive saves of a figure) need no further synchronization.
+class RKP_EXPORT Executor
+{
+public:
+    /// Construct an Executor object with a given number of background threads.
+    explicit Executor(std::size_t numthreads = 1);
+
+    /// Destroy this Executor object after running all tasks submitted so far.
+    ~Executor();
+
+    /// Submit a function to be executed in a background thread and return a future to its result.
+    template<typename Fn>
+    auto submit(Fn&& fn) -> std::future<std::invoke_result_t<Fn>>
+    {
+        using R = std::invoke_result_t<Fn>;
+        auto task = std::make_shared<std::packaged_task<R()>>(std::forward<Fn>(fn));
+        auto result = task->get_future();
+        post([task] { (*task)(); });
+        return result;
+    }
+
+    /// Post a function to be executed in a background thread, without waiting for it.
+    auto post(std::function<void()> fn) -> void;
+
+    /// Run all tasks submitted so far and stop the background threads (tasks submitted afterwards are never run).
+    auto stop() -> void;
+
+    /// Return the number of background threads.
+    auto numthreads() const -> std::size_t { return threads.size(); }
+
+private:
+    /// The background threads.
+    std::vector<std::thread> threads;
+
+    /// The mutex protecting the tasks and the stopping flag.
+    std::mutex mutex;
+
+    /// The condition variable notified when a task is posted or the executor is stopping.
+    std::condition_variable posted;
+
+    /// The tasks waiting for a background thread.
+    std::deque<std::function<void()>> tasks;
+
+    /// The flag indicating the background threads should stop once there are no more tasks.
+    bool stopping = false;
+};
+
+/// Return the executor running the background work of reaktplot (e.g., the saves of Figure::saveAsync).
+/// It has a single thread, so that background work is done in the order it is submitted.
+RKP_EXPORT auto executor() -> Executor&;
+
+} // namespace reaktplot
@@ -0,0 +1,572 @@
+// reaktplot - a modern C++ scientific plotting library powered by plotly
+// https://github.com/reaktplot/reaktplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2022-2023 Allan Leal
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+// NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include "Figure.hpp"
+
+// C++ includes
+#include <algorithm>
+#include <cstdlib>
+#include <exception>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+
+// reaktplot includes
+#include <reaktplot/Animation.hpp>
+#include <reaktplot/Compression.hpp>
+#include <reaktplot/Executor.hpp>
+#include <reaktplot/Html.hpp>
+#include <reaktplot/Json.hpp>
+#include <reaktplot/Pdf.hpp>
+#include <reaktplot/Png.hpp>
+#include <reaktplot/RenderCache.hpp>
+#include <reaktplot/RenderPool.hpp>
+#include <reaktplot/RenderSession.hpp>
+#include <reaktplot/Renderer.hpp>
+#include <reaktplot/Svg.hpp>
+#include <reaktplot/Tiles.hpp>
+#include <reaktplot/Video.hpp>
+
+namespace reaktplot {
+namespace {
+
+/// The number of pixels above which PNG images rendered natively are rendered as tiles (see @ref saveTiled).
+const auto MAX_UNTILED_PIXELS = 64e6;
+
+/// Return true if a file is a figure in plotly's JSON format, possibly compressed (e.g., `fig.json.gz`).
+auto isJson(std::string const& file) -> bool
+{
+    auto const name = uncompressed(file);
+    return name.size() >= 5 && name.compare(name.size() - 5, 5, ".json") == 0;
+}
+
+/// Return true if a file is saved natively in C++, without the Python interpreter.
+auto isNative(std::string const& file) -> bool
+{
+    auto const ext = file.substr(file.find_last_of('.') + 1);
+    return ext == "html" || ext == "tif" || ext == "tiff" || isJson(file) || ((ext == "svg" || ext == "png" || ext == "pdf") && backend() == Backend::Native);
+}
+
+/// Save a figure natively in C++ to a file for which @ref isNative is true.
+auto saveNative(FigureSpecs const& specs, std::string const& file, int width, int height, double scale) -> void
+{
+    auto const ext = file.substr(file.find_last_of('.') + 1);
+
+    if(ext == "html")
+        return saveHtml(file, specs, width, height, htmlOptions());
+
+    if(isJson(file))
+    {
+        CompressedOutput out(file);
+        writeJson(out, specs);
+        return out.close();
+    }
+
+    if(ext == "svg")
+        return saveSvg(file, specs, width, height);
+
+    if(ext == "pdf")
+        return savePdf(file, specs, width, height);
+
+    if(ext == "tif" || ext == "tiff" || width * scale * height * scale > MAX_UNTILED_PIXELS)
+        return saveTiled(file, specs, width, height, scale);
+
+    savePng(file, specs, width, height, scale);
+}
+
+/// Return true if a file is a video (e.g., an animation saved with a VideoWriter).
+auto isVideo(std::string const& file) -> bool
+{
+    auto const ext = file.substr(file.find_last_of('.') + 1);
+    return ext == "mp4" || ext == "webm" || ext == "mkv" || ext == "mov" || ext == "gif";
+}
+
+/// Copy a file cached under a given key to a file, if any, and return true if found (see RenderCache::fetch).
+/// The plotly.js bundle that HTML files in HtmlMode::Shared mode need next to them is not cached, so it is written too.
+auto fetched(RenderCache& cache, std::string const& key, std::string const& file, HtmlOptions const& options) -> bool
+{
+    if(!cache.fetch(key, file))
+        return false;
+    if(file.substr(file.find_last_of('.') + 1) == "html")
+        savePlotlyjs(file, options);
+    return true;
+}
+
+/// Return a callback of a render pool that adds a saved file to a render cache (errors are rethrown by the pool).
+auto storing(RenderCache* cache, std::string key) -> RenderPool::Callback
+{
+    return [cache, key = std::move(key)](std::string const& file, std::exception_ptr error)
+    {
+        if(error)
+            std::rethrow_exception(error);
+        cache->store(key, file);
+    };
+}
+
+/// Return the executor of the saves in the background that use Python (see Figure::saveAsync).
+/// The executor and the render session (which starts the Python interpreter) are constructed before registering the
+/// exit handler that stops the executor, so that at exit the saves in the background finish before either is destroyed.
+auto pythonExecutor() -> Executor&
+{
+    auto& res = executor();
+    renderSession();
+    [[maybe_unused]] static auto const registered = std::atexit([] { executor().stop(); });
+    return res;
+}
+
+/// Return the last frame before a given one with a data column of a trace stored in full and this column, or -1 and
+/// the column in the figure if there is no such frame (null if the figure does not have it either).
+auto keyframeColumn(FigureSpecs const& specs, std::size_t frame, std::size_t trace, std::string const& key) -> std::pair<std::ptrdiff_t, Column const*>
+{
+    for(auto i = static_cast<std::ptrdiff_t>(frame) - 1; i >= 0; --i)
+        if(auto const& traces = specs.frames[i].traces; trace < traces.size())
+            if(auto const* value = traces[trace].find(key); value && value->is<Column>())
+                return { i, &value->as<Column>() };
+
+    if(trace < specs.traces.size())
+        if(auto const* value = specs.traces[trace].find(key); value && value->is<Column>())
+            return { -1, &value->as<Column>() };
+
+    return { -1, nullptr };
+}
+
+} // namespace
+
+auto Figure::stage() const -> Changes
+{
+    if(mirror.pending.valid())
+    {
+        // The changes handed over in the background must come first, and if they could not be, the Python figure is
+        // created again from the whole figure
+        try { std::exchange(mirror.pending, {}).get(); }
+        catch(...) { mirror.pyfig = nullptr; }
+    }
+
+    Changes changes;
+
+    if(mirror.pyfig)
+    {
+        changes.cleartraces = mirror.cleartraces;
+        changes.clearframes = mirror.clearframes;
+        changes.reset = mirror.reset;
+        changes.layout = mirror.layout;
+        changes.xaxis = mirror.xaxis;
+        changes.yaxis = mirror.yaxis;
+    }
+    else
+    {
+        changes.layout = figspecs.layout;
+        changes.xaxis = figspecs.xaxis;
+        changes.yaxis = figspecs.yaxis;
+    }
+
+    auto const numtraces = mirror.pyfig ? mirror.numtraces : 0; // the traces already in the Python figure
+    auto const numframes = mirror.pyfig ? mirror.numframes : 0; // the frames already in the Python figure
+
+    changes.traces.assign(figspecs.traces.begin() + numtraces, figspecs.traces.end());
+    changes.numtraces = figspecs.traces.size();
+
+    changes.numframes = figspecs.frames.size() - (framing ? 1 : 0); // the current frame is handed over once finished
+    auto const frames = figspecs.frames.begin();
+
+    changes.frames = playbackFrames(figspecs, numframes, changes.numframes);
+
+    if(!changes.frames.empty() || changes.clearframes)
+    {
+        auto controls = changes.numframes ? animationControls({ frames, frames + changes.numframes }) : Dict{{"updatemenus", List()}, {"sliders", List()}};
+        for(auto const& [key, value] : controls)
+            if(!figspecs.layout.find(key))
+                changes.controls.set(key, value);
+    }
+
+    return changes;
+}
+
+auto Figure::commit(Changes const& changes) const -> void
+{
+    mirror.layout = mirror.xaxis = mirror.yaxis = {};
+    mirror.cleartraces = mirror.clearframes = mirror.reset = false;
+    mirror.numtraces = changes.numtraces;
+    mirror.numframes = changes.numframes;
+}
+
+auto Figure::pyfigure(Changes const& changes) const -> py::object
+{
+    if(!mirror.pyfig)
+        mirror.pyfig = Pythonic::share(py::object()); // created in handover
+    try
+    {
+        auto pyfig = handover(mirror.pyfig, changes);
+        commit(changes);
+        return pyfig;
+    }
+    catch(...)
+    {
+        mirror.pyfig = nullptr; // possibly updated in part, so created again from the whole figure next time
+        throw;
+    }
+}
+
+auto Figure::handover(std::shared_ptr<py::object> const& handle, Changes const& changes) -> py::object
+{
+    auto const update = [](py::object options, Dict const& values)
+    {
+        for(auto const& [key, value] : values)
+            options[py::str(key)] = Pythonic::pyobject(value);
+    };
+
+    if(!*handle)
+        *handle = Pythonic::createFigure();
+
+    py::object pyfig = *handle;
+
+    if(changes.reset)
+        pyfig.attr("reset")();
+    else
+    {
+        if(changes.cleartraces)
+            pyfig.attr("clearTraces")();
+        if(changes.clearframes)
+            pyfig.attr("clearFrames")();
+    }
+
+    update(pyfig.attr("layout"), changes.layout);
+    update(pyfig.attr("xaxis"), changes.xaxis);
+    update(pyfig.attr("yaxis"), changes.yaxis);
+
+    for(auto const& trace : changes.traces)
+        pyfig.attr("addTrace")(Pythonic::pyobject(trace));
+
+    for(auto const& frame : changes.frames)
+        pyfig.attr("addFrame")(Pythonic::pyobject(Dict{{"name", frame.name}, {"data", List(frame.traces.begin(), frame.traces.end())}, {"layout", frame.layout}}));
+
+    update(pyfig.attr("layout"), changes.controls);
+
+    return pyfig;
+}
+
+auto Figure::addFrameTrace(Dict trace) -> void
+{
+    if(figspecs.frames.empty())
+        beginFrame();
+
+    auto& frame = figspecs.frames.back();
+    auto const index = frame.traces.size();
+
+    if(index < figspecs.traces.size())
+    {
+        auto const& base = figspecs.traces[index];
+        std::vector<std::string> unchanged;
+        for(auto const& [key, value] : trace)
+            if(key != "type")
+                if(auto const* found = base.find(key); found && *found == value)
+                    unchanged.push_back(key);
+        for(auto const& key : unchanged)
+            trace.erase(key);
+    }
+
+    if(deltafraction > 0.0)
+    {
+        std::vector<std::string> encoded;
+        for(auto const& [key, value] : trace)
+        {
+            if(!value.is<Column>())
+                continue;
+            auto const [keyframe, reference] = keyframeColumn(figspecs, figspecs.frames.size() - 1, index, key);
+            if(!reference)
+                continue;
+            if(auto delta = encodeDelta(*reference, value.as<Column>(), deltafraction))
+            {
+                delta->trace = index;
+                delta->key = key;
+                delta->keyframe = keyframe;
+                frame.deltas.push_back(std::move(*delta));
+                encoded.push_back(key);
+            }
+        }
+        for(auto const& key : encoded)
+            trace.erase(key);
+    }
+
+    frame.traces.push_back(std::move(trace));
+}
+
+auto Figure::load(std::string const& file) -> Figure
+{
+    CompressedInput in(file);
+    Figure fig;
+    fig.figspecs = readJson(in);
+    return fig;
+}
+
+auto Figure::frame(std::size_t index) const -> FigureSpecs
+{
+    return frameFigure(figspecs, index);
+}
+
+auto Figure::show() const -> void
+{
+    auto const changes = stage();
+    Pythonic::execute([&] { pyfigure(changes).attr("show")(); });
+}
+
+auto Figure::save(std::string const& file, int width, int height, double scale) const -> void
+{
+    auto const cache = renderCache();
+    auto const key = cache ? cache->key(figspecs, file, width, height, scale) : std::string();
+
+    if(cache && fetched(*cache, key, file, htmlOptions()))
+        return;
+
+    if(isNative(file))
+        saveNative(figspecs, file, width, height, scale);
+    else if(isVideo(file))
+        saveVideo(file, width, height, scale);
+    else if(auto pool = renderPool())
+        return pool->save(*this, file, width, height, scale, cache ? storing(cache, key) : RenderPool::Callback());
+    else
+    {
+        auto const changes = stage();
+        Pythonic::execute([&] { renderSession().save(pyfigure(changes), file, width, height, scale); });
+    }
+
+    if(cache)
+        cache->store(key, file);
+}
+
+auto Figure::save(std::string const& file, HtmlOptions const& options, int width, int height) const -> void
+{
+    auto const cache = renderCache();
+    auto const key = cache ? cache->key(figspecs, file, width, height, options) : std::string();
+
+    if(cache && fetched(*cache, key, file, options))
+        return;
+
+    saveHtml(file, figspecs, width, height, options);
+
+    if(cache)
+        cache->store(key, file);
+}
+
+auto Figure::saveAll(std::vector<RenderTarget> const& targets) const -> void
+{
+    auto const cache = renderCache();
+
+    std::vector<RenderTarget> rendered;
+    std::vector<std::string> keys;
+
+    for(auto const& target : targets)
+    {
+        auto const key = cache ? cache->key(figspecs, target.file, target.width, target.height, target.scale) : std::string();
+        if(cache && fetched(*cache, key, target.file, htmlOptions()))
+            continue;
+        if(!isNative(target.file) && !isVideo(target.file))
+        {
+            rendered.push_back(target);
+            keys.push_back(key);
+            continue;
+        }
+        if(isVideo(target.file))
+            saveVideo(target.file, target.width, target.height, target.scale);
+        else saveNative(figspecs, target.file, target.width, target.height, target.scale);
+        if(cache)
+            cache->store(key, target.file);
+    }
+
+    if(rendered.empty())
+        return;
+
+    if(auto pool = renderPool())
+    {
+        for(std::size_t i = 0; i < rendered.size(); ++i)
+            pool->save(*this, rendered[i].file, rendered[i].width, rendered[i].height, rendered[i].scale, cache ? storing(cache, keys[i]) : RenderPool::Callback());
+        return;
+    }
+
+    auto const changes = stage();
+    Pythonic::execute([&] { renderSession().save(pyfigure(changes), rendered); });
+
+    if(cache)
+        for(std::size_t i = 0; i < rendered.size(); ++i)
+            cache->store(keys[i], rendered[i].file);
+}
+
+auto Figure::saveFrames(std::string const& file, int width, int height, double scale) const -> std::vector<std::string>
+{
+    auto const dot = file.find_last_of('.');
+    auto const stem = file.substr(0, dot);
+    auto const ext = dot == std::string::npos ? std::string() : file.substr(dot);
+    auto const digits = std::max<std::size_t>(3, std::to_string(figspecs.frames.size()).size());
+
+    std::vector<std::string> files;
+
+    eachFrame([&](Figure const& fig, std::size_t index)
+    {
+        std::ostringstream name;
+        name << stem << '-' << std::setfill('0') << std::setw(digits) << index << ext;
+        fig.save(name.str(), width, height, scale);
+        files.push_back(name.str());
+    });
+
+    return files;
+}
+
+auto Figure::saveVideo(std::string const& file, int width, int height, double scale) const -> void
+{
+    VideoOptions options;
+    options.width = width;
+    options.height = height;
+    options.scale = scale;
+
+    VideoWriter video(file, options);
+
+    if(figspecs.frames.empty())
+        video.write(*this);
+    else video.writeFrames(*this);
+
+    video.close();
+}
+
+auto Figure::saveTiled(std::string const& file, int width, int height, double scale) const -> void
+{
+    reaktplot::saveTiled(file, figspecs, width, height, scale);
+}
+
+auto Figure::eachFrame(std::function<void(Figure const&, std::size_t)> const& fn) const -> void
+{
+    Figure fig; // reused for all frames, so that its Python figure and layout are set up once
+
+    for(std::size_t i = 0; i < figspecs.frames.size(); ++i)
+    {
+        auto specs = frame(i);
+
+        if(i == 0 || specs.layout != fig.figspecs.layout)
+        {
+            fig.reset();
+            for(auto const& [key, value] : specs.layout) fig.setLayout(key, value);
+            for(auto const& [key, value] : specs.xaxis) fig.setXaxis(key, value);
+            for(auto const& [key, value] : specs.yaxis) fig.setYaxis(key, value);
+        }
+        else fig.clearTraces();
+
+        for(auto& trace : specs.traces)
+            fig.addTrace(std::move(trace));
+
+        fn(fig, i);
+    }
+}
+
+auto Figure::image(std::string const& format, int width, int height, double scale) const -> std::string
+{
+    std::ostringstream out;
+
+    if(format == "json")
+        writeJson(out, figspecs);
+    else if(format == "html")
+        writeHtml(out, figspecs, width, height, htmlOptions());
+    else if(format == "svg" && backend() == Backend::Native)
+        writeSvg(out, figspecs, width, height);
+    else if(format == "png" && backend() == Backend::Native)
+        writePng(out, figspecs, width, height, scale);
+    else if(format == "pdf" && backend() == Backend::Native)
+        writePdf(out, figspecs, width, height);
+    else
+    {
+        auto const changes = stage();
+        return Pythonic::execute([&] { return renderSession().image(pyfigure(changes), format, width, height, scale); });
+    }
+
+    return out.str();
+}
+
+auto Figure::saveAsync(std::string const& file, int width, int height, double scale) const -> std::future<void>
+{
+    auto const cache = renderCache();
+
+    if(isNative(file) || isVideo(file))
+    {
+        auto& background = isNative(file) || backend() == Backend::Native ? executor() : pythonExecutor();
+        return background.submit([=, fig = clone()] {
+            auto const key = cache ? cache->key(fig.figspecs, file, width, height, scale) : std::string();
+            if(cache && fetched(*cache, key, file, htmlOptions()))
+                return;
+            if(isNative(file))
+                saveNative(fig.figspecs, file, width, height, scale);
+            else fig.saveVideo(file, width, height, scale);
+            if(cache)
+                cache->store(key, file);
+        });
+    }
+
+    if(auto pool = renderPool())
+    {
+        auto promise = std::make_shared<std::promise<void>>();
+        auto const key = cache ? cache->key(figspecs, file, width, height, scale) : std::string();
+        if(cache && cache->fetch(key, file))
+            promise->set_value();
+        else pool->save(*this, file, width, height, scale, [promise, cache, key](std::string const& saved, std::exception_ptr error) {
+            if(!error && cache)
+                try { cache->store(key, saved); } catch(...) { error = std::current_exception(); }
+            if(error) promise->set_exception(error);
+            else promise->set_value();
+        });
+        return promise->get_future();
+    }
+
+    auto& background = pythonExecutor();
+    auto previous = std::exchange(mirror.pending, {}); // the handovers in the background are done in order by the executor, so no need to wait here
+    auto changes = stage();
+    commit(changes); // the changes are handed over before any later ones, or the later ones fail too
+    if(!mirror.pyfig)
+        mirror.pyfig = Pythonic::share(py::object()); // created in the background by handover
+    auto handed = std::make_shared<std::promise<void>>();
+    mirror.pending = handed->get_future().share();
+    return background.submit([=, pyfig = mirror.pyfig, changes = std::move(changes), specs = cache ? figspecs : FigureSpecs()] {
+        auto done = false; // whether the changes were handed over
+        try
+        {
+            if(previous.valid())
+                previous.get(); // the changes before these could not be handed over
+            auto const key = cache ? cache->key(specs, file, width, height, scale) : std::string();
+            auto const cached = cache && cache->fetch(key, file);
+            Pythonic::execute([&] {
+                auto const figure = handover(pyfig, changes); // even if cached, since the changes were committed
+                done = true;
+                handed->set_value();
+                if(!cached)
+                    renderSession().save(figure, file, width, height, scale);
+            });
+            if(cache && !cached)
+                cache->store(key, file);
+        }
+        catch(...)
+        {
+            if(!done)
+                handed->set_exception(std::current_exception());
+            throw;
+        }
+    });
+}
+
+} // namespace reaktplot
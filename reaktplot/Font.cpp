@@ -0,0 +1,486 @@
+// reaktplot - a modern C++ scientific plotting library powered by plotly
+// https://github.com/reaktplot/reaktplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2022-2023 Allan Leal
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+// NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include "Font.hpp"
+
+// C++ includes
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <mutex>
+#include <stdexcept>
+
+namespace reaktplot {
+namespace {
+
+/// The columns of the 5x7 characters of the built-in font from ` ` to `~` (bit 0 is the top row).
+const unsigned char BITMAPS[95][5] = {
+    {0x00, 0x00, 0x00, 0x00, 0x00}, {0x00, 0x00, 0x5F, 0x00, 0x00}, {0x00, 0x07, 0x00, 0x07, 0x00}, {0x14, 0x7F, 0x14, 0x7F, 0x14}, // space ! " #
+    {0x24, 0x2A, 0x7F, 0x2A, 0x12}, {0x23, 0x13, 0x08, 0x64, 0x62}, {0x36, 0x49, 0x55, 0x22, 0x50}, {0x00, 0x05, 0x03, 0x00, 0x00}, // $ % & '
+    {0x00, 0x1C, 0x22, 0x41, 0x00}, {0x00, 0x41, 0x22, 0x1C, 0x00}, {0x14, 0x08, 0x3E, 0x08, 0x14}, {0x08, 0x08, 0x3E, 0x08, 0x08}, // ( ) * +
+    {0x00, 0x50, 0x30, 0x00, 0x00}, {0x08, 0x08, 0x08, 0x08, 0x08}, {0x00, 0x60, 0x60, 0x00, 0x00}, {0x20, 0x10, 0x08, 0x04, 0x02}, // , - . /
+    {0x3E, 0x51, 0x49, 0x45, 0x3E}, {0x00, 0x42, 0x7F, 0x40, 0x00}, {0x42, 0x61, 0x51, 0x49, 0x46}, {0x21, 0x41, 0x45, 0x4B, 0x31}, // 0 1 2 3
+    {0x18, 0x14, 0x12, 0x7F, 0x10}, {0x27, 0x45, 0x45, 0x45, 0x39}, {0x3C, 0x4A, 0x49, 0x49, 0x30}, {0x01, 0x71, 0x09, 0x05, 0x03}, // 4 5 6 7
+    {0x36, 0x49, 0x49, 0x49, 0x36}, {0x06, 0x49, 0x49, 0x29, 0x1E}, {0x00, 0x36, 0x36, 0x00, 0x00}, {0x00, 0x56, 0x36, 0x00, 0x00}, // 8 9 : ;
+    {0x08, 0x14, 0x22, 0x41, 0x00}, {0x14, 0x14, 0x14, 0x14, 0x14}, {0x00, 0x41, 0x22, 0x14, 0x08}, {0x02, 0x01, 0x51, 0x09, 0x06}, // < = > ?
+    {0x32, 0x49, 0x79, 0x41, 0x3E}, {0x7E, 0x11, 0x11, 0x11, 0x7E}, {0x7F, 0x49, 0x49, 0x49, 0x36}, {0x3E, 0x41, 0x41, 0x41, 0x22}, // @ A B C
+    {0x7F, 0x41, 0x41, 0x22, 0x1C}, {0x7F, 0x49, 0x49, 0x49, 0x41}, {0x7F, 0x09, 0x09, 0x09, 0x01}, {0x3E, 0x41, 0x49, 0x49, 0x7A}, // D E F G
+    {0x7F, 0x08, 0x08, 0x08, 0x7F}, {0x00, 0x41, 0x7F, 0x41, 0x00}, {0x20, 0x40, 0x41, 0x3F, 0x01}, {0x7F, 0x08, 0x14, 0x22, 0x41}, // H I J K
+    {0x7F, 0x40, 0x40, 0x40, 0x40}, {0x7F, 0x02, 0x0C, 0x02, 0x7F}, {0x7F, 0x04, 0x08, 0x10, 0x7F}, {0x3E, 0x41, 0x41, 0x41, 0x3E}, // L M N O
+    {0x7F, 0x09, 0x09, 0x09, 0x06}, {0x3E, 0x41, 0x51, 0x21, 0x5E}, {0x7F, 0x09, 0x19, 0x29, 0x46}, {0x46, 0x49, 0x49, 0x49, 0x31}, // P Q R S
+    {0x01, 0x01, 0x7F, 0x01, 0x01}, {0x3F, 0x40, 0x40, 0x40, 0x3F}, {0x1F, 0x20, 0x40, 0x20, 0x1F}, {0x3F, 0x40, 0x38, 0x40, 0x3F}, // T U V W
+    {0x63, 0x14, 0x08, 0x14, 0x63}, {0x07, 0x08, 0x70, 0x08, 0x07}, {0x61, 0x51, 0x49, 0x45, 0x43}, {0x00, 0x7F, 0x41, 0x41, 0x00}, // X Y Z [
+    {0x02, 0x04, 0x08, 0x10, 0x20}, {0x00, 0x41, 0x41, 0x7F, 0x00}, {0x04, 0x02, 0x01, 0x02, 0x04}, {0x40, 0x40, 0x40, 0x40, 0x40}, // \ ] ^ _
+    {0x00, 0x01, 0x02, 0x04, 0x00}, {0x20, 0x54, 0x54, 0x54, 0x78}, {0x7F, 0x48, 0x44, 0x44, 0x38}, {0x38, 0x44, 0x44, 0x44, 0x20}, // ` a b c
+    {0x38, 0x44, 0x44, 0x48, 0x7F}, {0x38, 0x54, 0x54, 0x54, 0x18}, {0x08, 0x7E, 0x09, 0x01, 0x02}, {0x0C, 0x52, 0x52, 0x52, 0x3E}, // d e f g
+    {0x7F, 0x08, 0x04, 0x04, 0x78}, {0x00, 0x44, 0x7D, 0x40, 0x00}, {0x20, 0x40, 0x44, 0x3D, 0x00}, {0x7F, 0x10, 0x28, 0x44, 0x00}, // h i j k
+    {0x00, 0x41, 0x7F, 0x40, 0x00}, {0x7C, 0x04, 0x18, 0x04, 0x78}, {0x7C, 0x08, 0x04, 0x04, 0x78}, {0x38, 0x44, 0x44, 0x44, 0x38}, // l m n o
+    {0x7C, 0x14, 0x14, 0x14, 0x08}, {0x08, 0x14, 0x14, 0x18, 0x7C}, {0x7C, 0x08, 0x04, 0x04, 0x08}, {0x48, 0x54, 0x54, 0x54, 0x20}, // p q r s
+    {0x04, 0x3F, 0x44, 0x40, 0x20}, {0x3C, 0x40, 0x40, 0x20, 0x7C}, {0x1C, 0x20, 0x40, 0x20, 0x1C}, {0x3C, 0x40, 0x30, 0x40, 0x3C}, // t u v w
+    {0x44, 0x28, 0x10, 0x28, 0x44}, {0x0C, 0x50, 0x50, 0x50, 0x3C}, {0x44, 0x64, 0x54, 0x4C, 0x44}, {0x00, 0x08, 0x36, 0x41, 0x00}, // x y z {
+    {0x00, 0x00, 0x7F, 0x00, 0x00}, {0x00, 0x41, 0x36, 0x08, 0x00}, {0x10, 0x08, 0x08, 0x10, 0x08},                                  // | } ~
+};
+
+/// The size of a pixel of the built-in font (in em), so that its capital letters are about as tall as those of Arial.
+const double BITMAP_PIXEL = 0.1;
+
+/// The files of common sans-serif fonts searched by @ref defaultFont, in order of preference.
+const char* const SYSTEM_FONTS[] = {
+    "/usr/share/fonts/truetype/msttcorefonts/Arial.ttf",
+    "/usr/share/fonts/truetype/liberation/LiberationSans-Regular.ttf",
+    "/usr/share/fonts/truetype/liberation2/LiberationSans-Regular.ttf",
+    "/usr/share/fonts/liberation-sans/LiberationSans-Regular.ttf",
+    "/usr/share/fonts/truetype/dejavu/DejaVuSans.ttf",
+    "/usr/share/fonts/dejavu/DejaVuSans.ttf",
+    "/usr/share/fonts/TTF/DejaVuSans.ttf",
+    "/System/Library/Fonts/Supplemental/Arial.ttf",
+    "/Library/Fonts/Arial.ttf",
+    "C:/Windows/Fonts/arial.ttf",
+};
+
+/// Return a byte in the font data (zero if out of bounds).
+auto u8(std::string const& bytes, std::size_t pos) -> unsigned
+{
+    return pos < bytes.size() ? static_cast<unsigned char>(bytes[pos]) : 0;
+}
+
+/// Return an unsigned 16-bit integer stored big-endian in the font data (zero if out of bounds).
+auto u16(std::string const& bytes, std::size_t pos) -> unsigned
+{
+    if(pos + 2 > bytes.size())
+        return 0;
+    return static_cast<unsigned char>(bytes[pos]) << 8 | static_cast<unsigned char>(bytes[pos + 1]);
+}
+
+/// Return a signed 16-bit integer stored big-endian in the font data.
+auto i16(std::string const& bytes, std::size_t pos) -> int
+{
+    return static_cast<std::int16_t>(static_cast<std::uint16_t>(u16(bytes, pos)));
+}
+
+/// Return an unsigned 32-bit integer stored big-endian in the font data.
+auto u32(std::string const& bytes, std::size_t pos) -> std::uint32_t
+{
+    return static_cast<std::uint32_t>(u16(bytes, pos)) << 16 | u16(bytes, pos + 2);
+}
+
+/// Return a 2.14 fixed-point number stored big-endian in the font data.
+auto f2dot14(std::string const& bytes, std::size_t pos) -> double
+{
+    return i16(bytes, pos) / 16384.0;
+}
+
+/// Return the contours of a quadratic TrueType outline as polygons, with each curve flattened into line segments.
+auto flatten(std::vector<std::vector<std::pair<Point, bool>>> const& contours) -> std::vector<std::vector<Point>>
+{
+    std::vector<std::vector<Point>> res;
+    for(auto const& contour : contours)
+    {
+        auto const n = contour.size();
+        if(n < 2)
+            continue;
+
+        auto const mid = [](Point const& a, Point const& b) { return Point{ 0.5 * (a.x + b.x), 0.5 * (a.y + b.y) }; };
+
+        // Start at an on-curve point (the midpoint of the first two points if both are off-curve)
+        std::size_t first = 0;
+        while(first < n && !contour[first].second)
+            ++first;
+        auto const start = first < n ? contour[first].first : mid(contour[0].first, contour[1].first);
+        if(first == n)
+            first = 0;
+
+        std::vector<Point> polygon = { start };
+        Point control;
+        bool pending = false;
+        for(std::size_t k = 1; k <= n; ++k)
+        {
+            auto const& [p, on] = contour[(first + k) % n];
+            auto const& end = k == n ? start : p;
+            if(!on && k < n)
+            {
+                if(pending) // two consecutive off-curve points imply an on-curve point between them
+                {
+                    auto const m = mid(control, p);
+                    auto const a = polygon.back();
+                    for(int s = 1; s <= 6; ++s)
+                    {
+                        auto const t = s / 6.0, u = 1.0 - t;
+                        polygon.push_back({ u * u * a.x + 2 * u * t * control.x + t * t * m.x, u * u * a.y + 2 * u * t * control.y + t * t * m.y });
+                    }
+                }
+                control = p;
+                pending = true;
+                continue;
+            }
+            if(pending)
+            {
+                auto const a = polygon.back();
+                for(int s = 1; s <= 6; ++s)
+                {
+                    auto const t = s / 6.0, u = 1.0 - t;
+                    polygon.push_back({ u * u * a.x + 2 * u * t * control.x + t * t * end.x, u * u * a.y + 2 * u * t * control.y + t * t * end.y });
+                }
+                pending = false;
+            }
+            else polygon.push_back(end);
+        }
+        polygon.pop_back(); // the last point is the start point again
+        res.push_back(std::move(polygon));
+    }
+    return res;
+}
+
+} // namespace ""
+
+/// The tables and parsed glyphs of a font.
+struct Font::Data
+{
+    /// The contents of the TrueType file (empty for the built-in font).
+    std::string bytes;
+
+    /// The offsets of the `glyf` and `loca` tables.
+    std::size_t glyf = 0, loca = 0;
+
+    /// Whether the `loca` table has 32-bit offsets.
+    bool longloca = false;
+
+    /// The number of font units per em.
+    double unitsPerEm = 1.0;
+
+    /// The number of glyphs in the font.
+    unsigned numglyphs = 0;
+
+    /// The advances of the glyphs (in em).
+    std::vector<double> advances;
+
+    /// The glyph index of each character.
+    std::map<char32_t, unsigned> cmap;
+
+    /// The glyphs parsed so far, by index.
+    std::map<unsigned, Glyph> glyphs;
+
+    /// The mutex protecting the glyphs parsed so far.
+    std::mutex mutex;
+
+    /// Return the contours of a glyph in font units (recursively for composite glyphs).
+    auto outline(unsigned index, int depth) const -> std::vector<std::vector<std::pair<Point, bool>>>
+    {
+        std::vector<std::vector<std::pair<Point, bool>>> contours;
+        if(index >= numglyphs || depth > 8)
+            return contours;
+
+        auto const offset = longloca ? u32(bytes, loca + 4 * index) : 2 * u16(bytes, loca + 2 * index);
+        auto const next = longloca ? u32(bytes, loca + 4 * index + 4) : 2 * u16(bytes, loca + 2 * index + 2);
+        if(next <= offset)
+            return contours; // a glyph without outline (e.g., space)
+
+        auto pos = glyf + offset;
+        auto const numcontours = i16(bytes, pos);
+        pos += 10;
+
+        if(numcontours >= 0) // a simple glyph
+        {
+            std::vector<unsigned> ends;
+            for(int c = 0; c < numcontours; ++c, pos += 2)
+                ends.push_back(u16(bytes, pos));
+            auto const numpoints = ends.empty() ? 0 : ends.back() + 1;
+            pos += 2 + u16(bytes, pos); // skip the instructions
+
+            std::vector<unsigned char> flags;
+            while(flags.size() < numpoints && pos < bytes.size())
+            {
+                auto const flag = static_cast<unsigned char>(u8(bytes, pos++));
+                flags.push_back(flag);
+                if(flag & 8) // the flag is repeated
+                    for(auto r = u8(bytes, pos++); r > 0 && flags.size() < numpoints; --r)
+                        flags.push_back(flag);
+            }
+            if(flags.size() < numpoints)
+                return {}; // a truncated glyph, drawn as nothing
+
+            std::vector<Point> points(numpoints);
+            for(int axis = 0; axis < 2; ++axis)
+            {
+                auto const shortbit = axis == 0 ? 2 : 4, samebit = axis == 0 ? 16 : 32;
+                double value = 0.0;
+                for(unsigned k = 0; k < numpoints; ++k)
+                {
+                    if(flags[k] & shortbit)
+                    {
+                        auto const delta = static_cast<int>(u8(bytes, pos++));
+                        value += flags[k] & samebit ? delta : -delta;
+                    }
+                    else if(!(flags[k] & samebit))
+                    {
+                        value += i16(bytes, pos);
+                        pos += 2;
+                    }
+                    (axis == 0 ? points[k].x : points[k].y) = value;
+                }
+            }
+
+            unsigned begin = 0;
+            for(auto end : ends)
+            {
+                contours.emplace_back();
+                for(auto k = begin; k <= end && k < numpoints; ++k)
+                    contours.back().push_back({ points[k], (flags[k] & 1) != 0 });
+                begin = end + 1;
+            }
+            return contours;
+        }
+
+        for(unsigned flags = 0x20; flags & 0x20;) // a composite glyph, made of other glyphs transformed
+        {
+            flags = u16(bytes, pos);
+            auto const component = u16(bytes, pos + 2);
+            pos += 4;
+            double dx = 0.0, dy = 0.0;
+            if(flags & 1) { dx = i16(bytes, pos); dy = i16(bytes, pos + 2); pos += 4; }
+            else { dx = static_cast<signed char>(u8(bytes, pos)); dy = static_cast<signed char>(u8(bytes, pos + 1)); pos += 2; }
+            double a = 1.0, b = 0.0, c = 0.0, d = 1.0;
+            if(flags & 8) { a = d = f2dot14(bytes, pos); pos += 2; }
+            else if(flags & 0x40) { a = f2dot14(bytes, pos); d = f2dot14(bytes, pos + 2); pos += 4; }
+            else if(flags & 0x80) { a = f2dot14(bytes, pos); b = f2dot14(bytes, pos + 2); c = f2dot14(bytes, pos + 4); d = f2dot14(bytes, pos + 6); pos += 8; }
+            if(!(flags & 2)) // the arguments are point numbers, which are not supported (and rarely used in Latin fonts)
+                dx = dy = 0.0;
+            for(auto contour : outline(component, depth + 1))
+            {
+                for(auto& [p, on] : contour)
+                    p = { a * p.x + c * p.y + dx, b * p.x + d * p.y + dy };
+                contours.push_back(std::move(contour));
+            }
+        }
+        return contours;
+    }
+};
+
+Font::Font()
+: data(std::make_shared<Data>())
+{
+    data->numglyphs = 95;
+    data->advances.assign(95, 6 * BITMAP_PIXEL);
+    for(char32_t c = 32; c < 127; ++c)
+        data->cmap[c] = c - 32;
+    data->cmap[U'\u2212'] = '-' - 32; // the minus sign in tick labels
+    data->cmap[U'\u00b5'] = data->cmap[U'\u03bc'] = 'u' - 32; // the micro sign in tick labels
+}
+
+auto Font::load(std::string const& file) -> Font
+{
+    std::ifstream in(file, std::ios::binary);
+    if(!in)
+        throw std::runtime_error("Could not read the font file " + file + ".");
+
+    Font font;
+    auto& d = *font.data;
+    d.advances.clear();
+    d.cmap.clear();
+    d.bytes.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+
+    auto const& bytes = d.bytes;
+    auto const version = u32(bytes, 0);
+    if(version != 0x00010000 && version != 0x74727565) // TrueType outlines only (not CFF-based OpenType fonts or collections)
+        throw std::runtime_error("The font file " + file + " is not a TrueType font.");
+
+    std::map<std::string, std::size_t> tables;
+    for(unsigned t = 0, n = u16(bytes, 4); t < n; ++t)
+        tables[bytes.substr(12 + 16 * t, 4)] = u32(bytes, 12 + 16 * t + 8);
+    for(auto tag : { "head", "maxp", "hhea", "hmtx", "loca", "glyf", "cmap" })
+        if(!tables.count(tag))
+            throw std::runtime_error("The font file " + file + " has no " + tag + " table.");
+
+    d.unitsPerEm = u16(bytes, tables["head"] + 18);
+    d.longloca = i16(bytes, tables["head"] + 50) != 0;
+    d.numglyphs = u16(bytes, tables["maxp"] + 4);
+    d.glyf = tables["glyf"];
+    d.loca = tables["loca"];
+
+    auto const nummetrics = std::max(1u, u16(bytes, tables["hhea"] + 34));
+    for(unsigned g = 0; g < d.numglyphs; ++g)
+        d.advances.push_back(u16(bytes, tables["hmtx"] + 4 * std::min(g, nummetrics - 1)) / d.unitsPerEm);
+
+    // The character to glyph mapping, from a Unicode subtable of format 4 (BMP) or 12 (full range)
+    auto const cmap = tables["cmap"];
+    for(unsigned t = 0, n = u16(bytes, cmap + 2); t < n; ++t)
+    {
+        auto const platform = u16(bytes, cmap + 4 + 8 * t);
+        auto const encoding = u16(bytes, cmap + 4 + 8 * t + 2);
+        auto const sub = cmap + u32(bytes, cmap + 4 + 8 * t + 4);
+        auto const format = u16(bytes, sub);
+        if(!(platform == 0 || (platform == 3 && (encoding == 1 || encoding == 10))))
+            continue;
+        if(format == 4 && d.cmap.empty())
+        {
+            auto const segs = u16(bytes, sub + 6) / 2;
+            auto const ends = sub + 14, starts = ends + 2 * segs + 2, deltas = starts + 2 * segs, ranges = deltas + 2 * segs;
+            for(unsigned s = 0; s < segs; ++s)
+            {
+                auto const start = u16(bytes, starts + 2 * s), end = u16(bytes, ends + 2 * s);
+                auto const delta = u16(bytes, deltas + 2 * s), range = u16(bytes, ranges + 2 * s);
+                for(auto c = start; c <= end && c != 0xFFFF; ++c)
+                {
+                    auto g = range == 0 ? c : u16(bytes, ranges + 2 * s + range + 2 * (c - start));
+                    if(range == 0 || g != 0)
+                        g = (g + delta) & 0xFFFF;
+                    if(g != 0)
+                        d.cmap[c] = g;
+                }
+            }
+        }
+        if(format == 12)
+        {
+            d.cmap.clear();
+            for(std::uint32_t k = 0, n = u32(bytes, sub + 12); k < n; ++k)
+            {
+                auto const group = sub + 16 + 12 * k;
+                auto const start = u32(bytes, group), end = std::min<std::uint32_t>(u32(bytes, group + 4), 0x10FFFF);
+                for(auto c = start; c <= end; ++c)
+                    d.cmap[c] = u32(bytes, group + 8) + (c - start);
+            }
+            break;
+        }
+    }
+    return font;
+}
+
+auto Font::index(char32_t c) const -> unsigned
+{
+    auto it = data->cmap.find(c);
+    if(it == data->cmap.end())
+        it = data->cmap.find(U'?');
+    return it == data->cmap.end() ? 0 : it->second;
+}
+
+auto Font::glyph(unsigned index) const -> Glyph const&
+{
+    std::lock_guard<std::mutex> lock(data->mutex);
+
+    if(auto it = data->glyphs.find(index); it != data->glyphs.end())
+        return it->second;
+
+    Glyph glyph;
+    glyph.advance = advance(index);
+
+    if(builtin() && index < 95)
+    {
+        for(int col = 0; col < 5; ++col)
+            for(int row = 0; row < 7; ++row)
+                if(BITMAPS[index][col] >> row & 1)
+                {
+                    auto const x0 = col * BITMAP_PIXEL, x1 = x0 + BITMAP_PIXEL;
+                    auto const y0 = (6 - row) * BITMAP_PIXEL, y1 = y0 + BITMAP_PIXEL;
+                    glyph.contours.push_back({ {x0, y0}, {x1, y0}, {x1, y1}, {x0, y1} });
+                }
+    }
+    else
+    {
+        glyph.contours = flatten(data->outline(index, 0));
+        for(auto& contour : glyph.contours)
+            for(auto& p : contour)
+                p = { p.x / data->unitsPerEm, p.y / data->unitsPerEm };
+    }
+
+    return data->glyphs[index] = std::move(glyph);
+}
+
+auto Font::advance(unsigned index) const -> double
+{
+    return index < data->advances.size() ? data->advances[index] : 0.0;
+}
+
+auto Font::width(std::string const& str, double size) const -> double
+{
+    double width = 0.0;
+    for(auto c : decode(str))
+        width += advance(index(c));
+    return width * size;
+}
+
+auto Font::builtin() const -> bool
+{
+    return data->bytes.empty();
+}
+
+auto defaultFont() -> Font const&
+{
+    static Font const font = []
+    {
+        if(auto const* file = std::getenv("REAKTPLOT_FONT"); file && *file)
+            return Font::load(file);
+        for(auto file : SYSTEM_FONTS)
+            if(std::ifstream(file).good())
+            {
+                try { return Font::load(file); }
+                catch(std::exception const&) {}
+            }
+        return Font();
+    }();
+    return font;
+}
+
+auto decode(std::string const& str) -> std::u32string
+{
+    std::u32string res;
+    for(std::size_t i = 0; i < str.size();)
+    {
+        auto const c = static_cast<unsigned char>(str[i]);
+        auto const len = c < 0x80 ? 1 : (c >> 5) == 0x6 ? 2 : (c >> 4) == 0xE ? 3 : (c >> 3) == 0x1E ? 4 : 0;
+        char32_t code = len == 1 ? c : len == 2 ? c & 0x1F : len == 3 ? c & 0x0F : c & 0x07;
+        bool valid = len > 0 && i + len <= str.size();
+        for(int k = 1; valid && k < len; ++k)
+        {
+            auto const cont = static_cast<unsigned char>(str[i + k]);
+            valid = (cont & 0xC0) == 0x80;
+            code = code << 6 | (cont & 0x3F);
+        }
+        res.push_back(valid ? code : U'\uFFFD');
+        i += valid ? len : 1;
+    }
+    return res;
+}
+
+} // namespace reaktplot
@@ -0,0 +1,88 @@
+// reaktplot - a modern C++ scientific plotting library powered by plotly
+// https://github.com/reaktplot/reaktplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2022-2023 Allan Leal
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+// NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#pragma once
+
+// C++ includes
+#include <memory>
+#include <string>
+#include <vector>
+
+// reaktplot includes
+#include <reaktplot/Canvas.hpp>
+#include <reaktplot/Macros.hpp>
+
+namespace reaktplot {
+
+/// Used to represent the outline of a character in a font.
+struct Glyph
+{
+    /// The horizontal distance to the next character (in em, i.e., relative to the font size).
+    double advance = 0.0;
+
+    /// The closed contours of the character filled with the nonzero rule (in em, with the y-axis pointing up from the baseline).
+    std::vector<std::vector<Point>> contours;
+};
+
+/// Used to represent a font for the native raster backend (see PngCanvas).
+/// A font is either loaded from a TrueType file (e.g., `DejaVuSans.ttf`, `Arial.ttf`) or is the built-in font, a
+/// small bitmap font with the printable ASCII characters used when no TrueType file is available.
+class RKP_EXPORT Font
+{
+public:
+    /// Construct a Font object with the built-in font.
+    Font();
+
+    /// Return the font in a TrueType file. Throws if the file cannot be read or is not a TrueType font.
+    static auto load(std::string const& file) -> Font;
+
+    /// Return the index of the glyph of a character, or the one of `?` if the font has no glyph for it.
+    auto index(char32_t c) const -> unsigned;
+
+    /// Return the glyph with given index.
+    auto glyph(unsigned index) const -> Glyph const&;
+
+    /// Return the horizontal distance to the next character after the glyph with given index (in em).
+    auto advance(unsigned index) const -> double;
+
+    /// Return the width of text (in px) when drawn with given font size.
+    auto width(std::string const& str, double size) const -> double;
+
+    /// Return true if this is the built-in font.
+    auto builtin() const -> bool;
+
+private:
+    struct Data;
+
+    /// The tables and parsed glyphs of the font, shared among copies.
+    std::shared_ptr<Data> data;
+};
+
+/// Return the font used by the native raster backend, loaded once.
+/// This is the TrueType file in the environment variable `REAKTPLOT_FONT`, otherwise the first found among common
+/// sans-serif system fonts (e.g., Arial, Liberation Sans, DejaVu Sans), otherwise the built-in font.
+RKP_EXPORT auto defaultFont() -> Font const&;
+
+/// Return the Unicode characters of a UTF-8 string (invalid bytes are returned as the replacement character U+FFFD).
+RKP_EXPORT auto decode(std::string const& str) -> std::u32string;
+
+} // namespace reaktplot
@@ -0,0 +1,189 @@
+// reaktplot - a modern C++ scientific plotting library powered by plotly
+// https://github.com/reaktplot/reaktplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2022-2023 Allan Leal
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+// NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include "Html.hpp"
+
+// C++ includes
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+
+// reaktplot includes
+#include <reaktplot/Animation.hpp>
+
+namespace reaktplot {
+namespace {
+
+/// Return the path to the plotly.js bundle when not given explicitly, or an empty string if unknown.
+auto plotlyjsPath() -> std::string
+{
+    if(auto const* path = std::getenv("REAKTPLOT_PLOTLYJS"); path && *path)
+        return path;
+#ifdef REAKTPLOT_PLOTLYJS_INSTALLED
+    if(std::ifstream(REAKTPLOT_PLOTLYJS_INSTALLED).good())
+        return REAKTPLOT_PLOTLYJS_INSTALLED;
+#endif
+    return {};
+}
+
+/// Return a new unique identifier for the div element of a figure in an HTML page.
+auto divid() -> std::string
+{
+    static std::mutex mutex;
+    static std::mt19937_64 engine(std::random_device{}());
+    std::lock_guard<std::mutex> lock(mutex);
+    std::ostringstream ss;
+    ss << std::hex << engine();
+    return ss.str();
+}
+
+/// The mutex protecting the HTML options of the session.
+std::mutex sessionmutex;
+
+/// The HTML options of the session.
+HtmlOptions session;
+
+} // namespace ""
+
+auto setHtmlOptions(HtmlOptions const& options) -> void
+{
+    std::lock_guard<std::mutex> lock(sessionmutex);
+    session = options;
+}
+
+auto htmlOptions() -> HtmlOptions
+{
+    std::lock_guard<std::mutex> lock(sessionmutex);
+    return session;
+}
+
+auto plotlyjs(std::string const& path) -> std::string const&
+{
+    static std::mutex mutex;
+    static std::map<std::string, std::string> bundles; // the bundles already read, by path
+
+    auto const file = path.empty() ? plotlyjsPath() : path;
+
+    std::lock_guard<std::mutex> lock(mutex);
+
+    if(auto it = bundles.find(file); it != bundles.end())
+        return it->second;
+
+    if(file.empty())
+        throw std::runtime_error("Could not find the plotly.js bundle to embed in HTML files. Set HtmlOptions::plotlyjs "
+            "or the environment variable REAKTPLOT_PLOTLYJS to the path of plotly.min.js, or export HTML fragments instead.");
+
+    std::ifstream in(file, std::ios::binary);
+    if(!in)
+        throw std::runtime_error("Could not read the plotly.js bundle " + file + ".");
+    std::ostringstream ss;
+    ss << in.rdbuf();
+    return bundles[file] = ss.str();
+}
+
+auto writeHtml(std::ostream& out, FigureSpecs const& specs, int width, int height, HtmlOptions const& options) -> void
+{
+    auto const id = divid();
+    auto const fragment = options.mode == HtmlMode::Fragment;
+
+    if(!fragment)
+    {
+        out << "<html>\n<head><meta charset=\"utf-8\" /></head>\n<body>\n";
+        out << "    <div>\n";
+        out << "        <script type=\"text/javascript\">window.PlotlyConfig = {MathJaxConfig: 'local'};</script>\n";
+        if(options.mode == HtmlMode::Shared)
+            out << "        <script src=\"plotly.min.js\"></script>\n";
+        else out << "        <script type=\"text/javascript\">" << plotlyjs(options.plotlyjs) << "</script>\n";
+    }
+    out << "        <div id=\"" << id << "\" class=\"plotly-graph-div\" style=\"height:" << height << "px; width:" << width << "px;\"></div>";
+    out << "        <script type=\"text/javascript\">\n";
+    out << "            window.PLOTLYENV=window.PLOTLYENV || {};\n";
+    out << "            if (document.getElementById(\"" << id << "\")) {\n";
+    out << "                Plotly.newPlot(\"" << id << "\", ";
+    {
+        auto const deltas = !options.json.typedarrays; // the deltas of frames are applied in the browser to arrays of numbers only
+        Dict const figure = plotlyFigure(specs, options.json.theme, false);
+        JsonWriter writer(out, options.json);
+        writer.write(figure.find("data")->as<List>());
+        writer.raw(", ");
+        writer.write(figure.find("layout")->as<Dict>());
+        writer.raw(", {\"responsive\": true})");
+        if(!specs.frames.empty())
+        {
+            writer.raw(".then(function(gd){ Plotly.addFrames(\"" + id + "\", ");
+            if(deltas)
+                writer.raw("(" + frameDeltaScript() + ")(gd.data, ");
+            writeFrames(writer, specs, deltas);
+            writer.raw(deltas ? ")); })" : "); })");
+        }
+    }
+    out << ";\n";
+    out << "            };\n";
+    out << "        </script>\n";
+    if(!fragment)
+        out << "    </div>\n</body>\n</html>";
+}
+
+auto savePlotlyjs(std::string const& file, HtmlOptions const& options) -> void
+{
+    namespace fs = std::filesystem;
+
+    if(options.mode == HtmlMode::Shared)
+    {
+        static std::mutex mutex;
+        static std::map<fs::path, std::string const*> written; // the bundle last written to each file by this process
+
+        auto const& bundle = plotlyjs(options.plotlyjs);
+        auto const path = fs::absolute(fs::path(file)).parent_path() / "plotly.min.js";
+
+        std::lock_guard<std::mutex> lock(mutex);
+        if(written[path] != &bundle)
+        {
+            std::ostringstream existing;
+            existing << std::ifstream(path, std::ios::binary).rdbuf();
+            if(existing.str() != bundle) // not yet written by this or a previous run, or written from another bundle
+            {
+                std::ofstream out(path, std::ios::binary);
+                if(!out.write(bundle.data(), bundle.size()))
+                    throw std::runtime_error("Could not write the plotly.js bundle " + path.string() + ".");
+            }
+            written[path] = &bundle;
+        }
+    }
+}
+
+auto saveHtml(std::string const& file, FigureSpecs const& specs, int width, int height, HtmlOptions const& options) -> void
+{
+    savePlotlyjs(file, options);
+
+    std::ofstream out(file, std::ios::binary);
+    if(!out)
+        throw std::runtime_error("Could not open file " + file + " for writing.");
+    writeHtml(out, specs, width, height, options);
+}
+
+} // namespace reaktplot
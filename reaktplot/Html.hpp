@@ -0,0 +1,87 @@
+// reaktplot - a modern C++ scientific plotting library powered by plotly
+// https://github.com/reaktplot/reaktplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2022-2023 Allan Leal
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+// NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#pragma once
+
+// C++ includes
+#include <ostream>
+#include <string>
+
+// reaktplot includes
+#include <reaktplot/Json.hpp>
+#include <reaktplot/Macros.hpp>
+#include <reaktplot/Specs.hpp>
+
+namespace reaktplot {
+
+/// Used to specify how the plotly.js bundle is included in HTML files.
+enum class HtmlMode
+{
+    Standalone, ///< The plotly.js bundle (about 3.5 MB) is embedded in each HTML file, which can then be opened anywhere.
+    Shared,     ///< The HTML file references a single `plotly.min.js` file, written once in the directory of the HTML file.
+    Fragment,   ///< Only the div element and the script drawing the figure are written, to be inserted in a page that loads plotly.js.
+};
+
+/// Used to specify how figures are exported to HTML.
+struct HtmlOptions
+{
+    /// How the plotly.js bundle is included in HTML files.
+    HtmlMode mode = HtmlMode::Standalone;
+
+    /// The path to the plotly.js bundle (e.g., `plotly.min.js`) embedded in the HTML page.
+    /// If empty, the bundle is searched in this order: the file in the environment variable `REAKTPLOT_PLOTLYJS`, and
+    /// the bundle installed with reaktplot (the one given by the CMake variable `REAKTPLOT_PLOTLYJS` when reaktplot was
+    /// built, defaulting to that of the plotly Python package). An error is thrown if no bundle is found.
+    std::string plotlyjs;
+
+    /// The options used to write the figure in JSON format.
+    JsonOptions json;
+};
+
+/// Return the contents of the plotly.js bundle, read once and cached (see @ref HtmlOptions::plotlyjs).
+RKP_EXPORT auto plotlyjs(std::string const& path = "") -> std::string const&;
+
+/// Set the options used by default to export figures to HTML in this session (e.g., in Figure::save).
+RKP_EXPORT auto setHtmlOptions(HtmlOptions const& options) -> void;
+
+/// Return the options used by default to export figures to HTML in this session.
+RKP_EXPORT auto htmlOptions() -> HtmlOptions;
+
+/// Write a figure in HTML format, as `plotly.io.write_html` does.
+/// The figure is written natively in C++, so that the Python interpreter is not needed if the plotly.js bundle is.
+/// In HtmlMode::Shared mode, the page references `plotly.min.js` in its directory, which is not written by this function.
+/// @param out The output stream.
+/// @param specs The specification of the figure.
+/// @param width The width of the figure (in px).
+/// @param height The height of the figure (in px).
+/// @param options The options used to export the figure.
+RKP_EXPORT auto writeHtml(std::ostream& out, FigureSpecs const& specs, int width, int height, HtmlOptions const& options = {}) -> void;
+
+/// Write the plotly.js bundle to `plotly.min.js` in the directory of an HTML file in HtmlMode::Shared mode.
+/// Nothing is done in other modes, or if already written there (by this process or a previous one).
+RKP_EXPORT auto savePlotlyjs(std::string const& file, HtmlOptions const& options) -> void;
+
+/// Save a figure to an HTML file (see @ref writeHtml).
+/// In HtmlMode::Shared mode, the plotly.js bundle is also written next to the file (see @ref savePlotlyjs).
+RKP_EXPORT auto saveHtml(std::string const& file, FigureSpecs const& specs, int width, int height, HtmlOptions const& options) -> void;
+
+} // namespace reaktplot
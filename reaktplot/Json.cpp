@@ -0,0 +1,759 @@
+// reaktplot - a modern C++ scientific plotting library powered by plotly
+// https://github.com/reaktplot/reaktplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2022-2023 Allan Leal
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+// NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include "Json.hpp"
+
+// C++ includes
+#include <charconv>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <optional>
+#include <sstream>
+#include <stdexcept>
+
+// reaktplot includes
+#include <reaktplot/Animation.hpp>
+#include <reaktplot/Default.hpp>
+#include <reaktplot/DefaultTheme.hpp>
+
+namespace reaktplot {
+namespace {
+
+/// The size of the buffered output before it is written to the stream.
+const auto JSON_BUFFER_SIZE = std::size_t(1) << 16;
+
+/// The characters used in base64 encoding.
+const char BASE64[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+/// Return the bytes encoded in base64, ignoring padding and other characters.
+auto base64decode(std::string const& text) -> std::string
+{
+    std::string bytes;
+    bytes.reserve(text.size() / 4 * 3);
+    std::uint32_t bits = 0;
+    int count = 0;
+    for(auto c : text)
+    {
+        auto const* pos = std::strchr(BASE64, c);
+        if(c == '\0' || !pos)
+            continue;
+        bits = (bits << 6) | static_cast<std::uint32_t>(pos - BASE64);
+        if(++count == 4)
+        {
+            bytes += static_cast<char>((bits >> 16) & 0xFF);
+            bytes += static_cast<char>((bits >> 8) & 0xFF);
+            bytes += static_cast<char>(bits & 0xFF);
+            bits = 0;
+            count = 0;
+        }
+    }
+    if(count == 3)
+    {
+        bytes += static_cast<char>((bits >> 10) & 0xFF);
+        bytes += static_cast<char>((bits >> 2) & 0xFF);
+    }
+    else if(count == 2)
+        bytes += static_cast<char>((bits >> 4) & 0xFF);
+    return bytes;
+}
+
+/// Return the values of type T stored in bytes, as numbers.
+template<typename T>
+auto numbers(std::string const& bytes) -> std::vector<double>
+{
+    std::vector<double> values(bytes.size() / sizeof(T));
+    for(std::size_t i = 0; i < values.size(); ++i)
+    {
+        T value;
+        std::memcpy(&value, bytes.data() + i * sizeof(T), sizeof(T)); // assumes little-endian bytes, as on all supported platforms
+        values[i] = static_cast<double>(value);
+    }
+    return values;
+}
+
+/// Return the data column in a typed-array block (e.g., `{"dtype": "f8", "bdata": "...", "shape": "2, 3"}`), if any.
+auto typedArray(Dict const& dict) -> std::optional<Column>
+{
+    auto const* dtype = dict.find("dtype");
+    auto const* bdata = dict.find("bdata");
+    if(!dtype || !bdata || !dtype->is<std::string>() || !bdata->is<std::string>())
+        return {};
+
+    auto const bytes = base64decode(bdata->as<std::string>());
+    auto const& type = dtype->as<std::string>();
+
+    std::vector<double> values;
+    if(type == "f8") values = numbers<double>(bytes);
+    else if(type == "f4") values = numbers<float>(bytes);
+    else if(type == "i1") values = numbers<std::int8_t>(bytes);
+    else if(type == "u1") values = numbers<std::uint8_t>(bytes);
+    else if(type == "i2") values = numbers<std::int16_t>(bytes);
+    else if(type == "u2") values = numbers<std::uint16_t>(bytes);
+    else if(type == "i4") values = numbers<std::int32_t>(bytes);
+    else if(type == "u4") values = numbers<std::uint32_t>(bytes);
+    else return {};
+
+    std::size_t rows = 0, cols = 0;
+    if(auto const* shape = dict.find("shape"); shape && shape->is<std::string>())
+    {
+        char comma = 0;
+        std::istringstream(shape->as<std::string>()) >> rows >> comma >> cols;
+    }
+    else if(shape && shape->is<Column>() && shape->as<Column>().size() == 2)
+    {
+        rows = static_cast<std::size_t>(shape->as<Column>().numbers()[0]);
+        cols = static_cast<std::size_t>(shape->as<Column>().numbers()[1]);
+    }
+
+    if(rows * cols == values.size() && cols != 0)
+        return Column(std::move(values), rows, cols);
+    return Column(std::move(values));
+}
+
+} // namespace ""
+
+JsonWriter::JsonWriter(std::ostream& out, JsonOptions const& options)
+: out(out), options(options)
+{
+    buffer.reserve(JSON_BUFFER_SIZE + 64);
+}
+
+JsonWriter::~JsonWriter()
+{
+    flush();
+}
+
+auto JsonWriter::put(char c) -> void
+{
+    buffer.push_back(c);
+    if(buffer.size() >= JSON_BUFFER_SIZE)
+        flush();
+}
+
+auto JsonWriter::put(char const* data, std::size_t size) -> void
+{
+    buffer.append(data, size);
+    if(buffer.size() >= JSON_BUFFER_SIZE)
+        flush();
+}
+
+auto JsonWriter::flush() -> void
+{
+    out.write(buffer.data(), buffer.size());
+    buffer.clear();
+}
+
+auto JsonWriter::raw(std::string const& text) -> void
+{
+    put(text.data(), text.size());
+}
+
+auto JsonWriter::write(Value const& value) -> void
+{
+    std::visit([&](auto const& val)
+    {
+        using T = std::decay_t<decltype(val)>;
+        if constexpr(std::is_same_v<T, std::nullptr_t>)
+            put("null", 4);
+        else if constexpr(std::is_same_v<T, bool>)
+            val ? put("true", 4) : put("false", 5);
+        else if constexpr(std::is_same_v<T, long long>)
+        {
+            char chars[24];
+            auto const res = std::to_chars(chars, chars + sizeof(chars), val);
+            put(chars, res.ptr - chars);
+        }
+        else write(val);
+    }, value.variant());
+}
+
+auto JsonWriter::write(Dict const& dict) -> void
+{
+    put('{');
+    auto first = true;
+    for(auto const& [key, value] : dict)
+    {
+        if(!first) put(',');
+        first = false;
+        write(key);
+        put(':');
+        write(value);
+    }
+    put('}');
+}
+
+auto JsonWriter::write(List const& list) -> void
+{
+    put('[');
+    for(std::size_t i = 0; i < list.size(); ++i)
+    {
+        if(i) put(',');
+        write(list[i]);
+    }
+    put(']');
+}
+
+auto JsonWriter::write(Column const& column) -> void
+{
+    if(column.isStrings())
+    {
+        put('[');
+        for(std::size_t i = 0; i < column.size(); ++i)
+        {
+            if(i) put(',');
+            write(column.strings()[i]);
+        }
+        put(']');
+        return;
+    }
+
+    auto const& values = column.numbers();
+
+    if(options.typedarrays)
+    {
+        raw("{\"dtype\":\"f8\",\"bdata\":\"");
+        auto const* bytes = reinterpret_cast<unsigned char const*>(values.data()); // assumes little-endian doubles, as on all supported platforms
+        auto const size = values.size() * sizeof(double);
+        for(std::size_t i = 0; i < size; i += 3)
+        {
+            std::uint32_t const b0 = bytes[i];
+            std::uint32_t const b1 = i + 1 < size ? bytes[i + 1] : 0;
+            std::uint32_t const b2 = i + 2 < size ? bytes[i + 2] : 0;
+            std::uint32_t const n = (b0 << 16) | (b1 << 8) | b2;
+            char const chars[4] = {
+                BASE64[(n >> 18) & 63],
+                BASE64[(n >> 12) & 63],
+                i + 1 < size ? BASE64[(n >> 6) & 63] : '=',
+                i + 2 < size ? BASE64[n & 63] : '='
+            };
+            put(chars, 4);
+        }
+        put('"');
+        if(column.isMatrix())
+            raw(",\"shape\":\"" + std::to_string(column.rows()) + ", " + std::to_string(column.cols()) + "\"");
+        put('}');
+        return;
+    }
+
+    if(values.empty()) // also a matrix without rows, as numpy's tolist writes it
+    {
+        put("[]", 2);
+        return;
+    }
+
+    auto const cols = column.isMatrix() ? column.cols() : values.size();
+
+    if(column.isMatrix()) put('[');
+    for(std::size_t i = 0; i < values.size(); ++i)
+    {
+        if(i % cols == 0)
+        {
+            if(i) put(',');
+            put('[');
+        }
+        else put(',');
+        write(values[i]);
+        if((i + 1) % cols == 0)
+            put(']');
+    }
+    if(column.isMatrix()) put(']');
+}
+
+auto JsonWriter::write(std::string const& str) -> void
+{
+    put('"');
+    for(std::size_t i = 0; i < str.size(); ++i)
+    {
+        auto const c = str[i];
+        switch(c)
+        {
+        case '"': put("\\\"", 2); break;
+        case '\\': put("\\\\", 2); break;
+        case '\n': put("\\n", 2); break;
+        case '\r': put("\\r", 2); break;
+        case '\t': put("\\t", 2); break;
+        case '/': i && str[i - 1] == '<' ? put("\\/", 2) : put('/'); break; // avoid closing a <script> element in HTML output
+        default:
+            if(static_cast<unsigned char>(c) < 0x20)
+            {
+                char chars[8];
+                std::snprintf(chars, sizeof(chars), "\\u%04x", c);
+                put(chars, 6);
+            }
+            else put(c);
+        }
+    }
+    put('"');
+}
+
+auto JsonWriter::write(double number) -> void
+{
+    if(!std::isfinite(number))
+        return put("null", 4);
+    char chars[32];
+    auto const res = std::to_chars(chars, chars + sizeof(chars), number);
+    put(chars, res.ptr - chars);
+}
+
+JsonReader::JsonReader(std::istream& in)
+: in(*in.rdbuf())
+{}
+
+auto JsonReader::peek() -> int
+{
+    auto c = in.sgetc();
+    while(c == ' ' || c == '\n' || c == '\r' || c == '\t')
+    {
+        in.sbumpc();
+        c = in.sgetc();
+    }
+    return c;
+}
+
+auto JsonReader::expect(char c) -> void
+{
+    auto const next = peek();
+    if(next != static_cast<unsigned char>(c))
+        throw std::runtime_error(std::string("Could not read JSON, which has ") + (next == EOF ? "its end" : std::string("'") + char(next) + "'") + " where '" + c + "' is expected.");
+    in.sbumpc();
+}
+
+auto JsonReader::readLiteral(std::string const& literal) -> void
+{
+    for(auto c : literal)
+        expect(c);
+}
+
+auto JsonReader::read() -> Value
+{
+    switch(peek())
+    {
+        case '{': return readObject();
+        case '[': return readArray();
+        case '"': return readString();
+        case 't': readLiteral("true"); return true;
+        case 'f': readLiteral("false"); return false;
+        case 'n': readLiteral("null"); return nullptr;
+        case EOF: throw std::runtime_error("Could not read JSON, which ends unexpectedly.");
+        default: return readNumber();
+    }
+}
+
+auto JsonReader::readString() -> std::string
+{
+    expect('"');
+
+    std::string str;
+
+    auto const hex = [&]
+    {
+        unsigned code = 0;
+        for(int i = 0; i < 4; ++i)
+        {
+            auto const c = in.sbumpc();
+            auto const digit = c >= '0' && c <= '9' ? c - '0' : c >= 'a' && c <= 'f' ? c - 'a' + 10 : c >= 'A' && c <= 'F' ? c - 'A' + 10 : -1;
+            if(digit < 0)
+                throw std::runtime_error("Could not read JSON, which has an invalid escape sequence in a string.");
+            code = code * 16 + digit;
+        }
+        return code;
+    };
+
+    while(true)
+    {
+        auto c = in.sbumpc();
+        if(c == EOF)
+            throw std::runtime_error("Could not read JSON, which ends in a string.");
+        if(c == '"')
+            return str;
+        if(c != '\\')
+        {
+            str += static_cast<char>(c);
+            continue;
+        }
+        switch(c = in.sbumpc())
+        {
+            case 'b': str += '\b'; break;
+            case 'f': str += '\f'; break;
+            case 'n': str += '\n'; break;
+            case 'r': str += '\r'; break;
+            case 't': str += '\t'; break;
+            case 'u':
+            {
+                auto code = hex();
+                if(code >= 0xD800 && code < 0xDC00 && in.sgetc() == '\\') // a surrogate pair
+                {
+                    in.sbumpc();
+                    if(in.sbumpc() != 'u')
+                        throw std::runtime_error("Could not read JSON, which has an invalid escape sequence in a string.");
+                    code = 0x10000 + ((code - 0xD800) << 10) + (hex() - 0xDC00);
+                }
+                if(code < 0x80)
+                    str += static_cast<char>(code);
+                else if(code < 0x800)
+                {
+                    str += static_cast<char>(0xC0 | (code >> 6));
+                    str += static_cast<char>(0x80 | (code & 0x3F));
+                }
+                else if(code < 0x10000)
+                {
+                    str += static_cast<char>(0xE0 | (code >> 12));
+                    str += static_cast<char>(0x80 | ((code >> 6) & 0x3F));
+                    str += static_cast<char>(0x80 | (code & 0x3F));
+                }
+                else
+                {
+                    str += static_cast<char>(0xF0 | (code >> 18));
+                    str += static_cast<char>(0x80 | ((code >> 12) & 0x3F));
+                    str += static_cast<char>(0x80 | ((code >> 6) & 0x3F));
+                    str += static_cast<char>(0x80 | (code & 0x3F));
+                }
+                break;
+            }
+            case EOF: throw std::runtime_error("Could not read JSON, which ends in a string.");
+            default: str += static_cast<char>(c); // the escaped characters `"`, `\` and `/`
+        }
+    }
+}
+
+auto JsonReader::readNumber() -> Value
+{
+    char chars[64];
+    std::size_t size = 0;
+    auto integer = true;
+
+    for(auto c = peek(); (c >= '0' && c <= '9') || c == '-' || c == '+' || c == '.' || c == 'e' || c == 'E'; c = in.sgetc())
+    {
+        if(size == sizeof(chars))
+            throw std::runtime_error("Could not read JSON, which has a number that is too long.");
+        integer = integer && c != '.' && c != 'e' && c != 'E';
+        chars[size++] = static_cast<char>(in.sbumpc());
+    }
+
+    if(size == 0)
+    {
+        auto const c = in.sgetc();
+        throw std::runtime_error(std::string("Could not read JSON, which has an unexpected character '") + char(c) + "'.");
+    }
+
+    if(integer)
+    {
+        long long value = 0;
+        auto const res = std::from_chars(chars, chars + size, value);
+        if(res.ec == std::errc() && res.ptr == chars + size)
+            return value;
+    }
+
+    double value = 0.0;
+    auto const res = std::from_chars(chars, chars + size, value);
+    if(res.ec != std::errc() || res.ptr != chars + size)
+        throw std::runtime_error("Could not read JSON, which has an invalid number " + std::string(chars, size) + ".");
+    return value;
+}
+
+auto JsonReader::readArray() -> Value
+{
+    std::vector<double> numbers; // the entries while they are all numbers (with NaN for null)
+    auto nonnull = false;        // whether some of the numbers is not null (e.g., `[null]` is not a data column)
+    std::vector<Column> rows;    // the entries while they are all arrays of numbers
+    List values;                 // the entries once they are neither
+
+    auto const tolist = [&]
+    {
+        for(auto number : numbers)
+            values.push_back(std::isnan(number) ? Value() : Value(number));
+        for(auto& row : rows)
+            values.push_back(std::move(row));
+        numbers.clear();
+        rows.clear();
+    };
+
+    expect('[');
+
+    if(peek() == ']')
+    {
+        in.sbumpc();
+        return List();
+    }
+
+    while(true)
+    {
+        auto const c = peek();
+        if(rows.empty() && values.empty() && (c == 'n' || c == '-' || (c >= '0' && c <= '9')))
+        {
+            if(c == 'n')
+            {
+                readLiteral("null");
+                numbers.push_back(std::numeric_limits<double>::quiet_NaN());
+            }
+            else
+            {
+                auto const number = readNumber();
+                nonnull = true;
+                numbers.push_back(number.is<double>() ? number.as<double>() : static_cast<double>(number.as<long long>()));
+            }
+        }
+        else
+        {
+            auto value = read();
+            if(numbers.empty() && values.empty() && value.is<Column>() && !value.as<Column>().isMatrix() && !value.as<Column>().isStrings())
+                rows.push_back(value.as<Column>());
+            else
+            {
+                tolist();
+                values.push_back(std::move(value));
+            }
+        }
+
+        if(peek() == ']')
+        {
+            in.sbumpc();
+            break;
+        }
+        expect(',');
+    }
+
+    if(!numbers.empty() && !nonnull)
+        tolist();
+
+    if(!values.empty())
+        return values;
+
+    if(!numbers.empty())
+        return Column(std::move(numbers));
+
+    std::size_t cols = 0;
+    for(auto const& row : rows)
+        cols = std::max(cols, row.size());
+
+    std::vector<double> matrix(rows.size() * cols, std::numeric_limits<double>::quiet_NaN()); // missing entries in shorter rows are NaN, as in @ref column
+    for(std::size_t i = 0; i < rows.size(); ++i)
+        std::copy(rows[i].numbers().begin(), rows[i].numbers().end(), matrix.begin() + i * cols);
+
+    return Column(std::move(matrix), rows.size(), cols);
+}
+
+auto JsonReader::readObject() -> Value
+{
+    Dict dict;
+
+    expect('{');
+
+    if(peek() == '}')
+    {
+        in.sbumpc();
+        return dict;
+    }
+
+    while(true)
+    {
+        auto key = readString();
+        expect(':');
+        dict.set(key, read());
+
+        if(peek() == '}')
+        {
+            in.sbumpc();
+            break;
+        }
+        expect(',');
+    }
+
+    if(auto column = typedArray(dict))
+        return std::move(*column);
+
+    return dict;
+}
+
+auto animationControls(std::vector<FrameSpecs> const& frames) -> Dict
+{
+    auto const animate = [](Value const& names, int duration) -> List
+    {
+        return { names, Dict{{"mode", "immediate"}, {"fromcurrent", true}, {"frame", Dict{{"duration", duration}, {"redraw", true}}}, {"transition", Dict{{"duration", 0}}}} };
+    };
+
+    Dict play = {{"label", "Play"}, {"method", "animate"}, {"args", animate(nullptr, DEFAULT_FRAME_DURATION)}};
+    Dict pause = {{"label", "Pause"}, {"method", "animate"}, {"args", animate(List{nullptr}, 0)}};
+
+    Dict buttons = {{"type", "buttons"}, {"direction", "left"}, {"showactive", false}, {"x", 0.0}, {"y", 0.0},
+        {"xanchor", "right"}, {"yanchor", "top"}, {"pad", Dict{{"t", 60}, {"r", 10}}}, {"buttons", List{play, pause}}};
+
+    List steps;
+    steps.reserve(frames.size());
+    for(auto const& frame : frames)
+        steps.push_back(Dict{{"label", frame.name}, {"method", "animate"}, {"args", animate(List{frame.name}, 0)}});
+
+    Dict slider = {{"active", 0}, {"x", 0.0}, {"y", 0.0}, {"len", 1.0}, {"xanchor", "left"}, {"yanchor", "top"},
+        {"pad", Dict{{"t", 50}, {"b", 10}}}, {"steps", std::move(steps)}};
+
+    return {{"updatemenus", List{buttons}}, {"sliders", List{slider}}};
+}
+
+auto plotlyFigure(FigureSpecs const& specs, bool theme, bool frames) -> Dict
+{
+    List data;
+    data.reserve(specs.traces.size());
+    for(auto const& trace : specs.traces)
+        data.push_back(nested(trace));
+
+    Dict layout = nested(specs.layout);
+
+    auto const* xaxis = layout.find("xaxis");
+    auto const* yaxis = layout.find("yaxis");
+
+    Dict axis = xaxis && xaxis->is<Dict>() ? xaxis->as<Dict>() : Dict();
+    axis.update(nested(specs.xaxis));
+    layout.set("xaxis", axis);
+
+    axis = yaxis && yaxis->is<Dict>() ? yaxis->as<Dict>() : Dict();
+    axis.update(nested(specs.yaxis));
+    layout.set("yaxis", axis);
+
+    auto const* name = layout.find("template");
+    if(name && name->is<std::string>() && name->as<std::string>() == "reaktplot")
+        layout.set("template", defaultTheme());
+    else if(name && name->is<std::string>() && name->as<std::string>() == "none")
+        layout.erase("template");
+    else if(name && name->is<std::string>()) // the other named templates of plotly (e.g., plotly_dark) are only known in Python
+        throw std::runtime_error("Could not expand the plotly template " + name->as<std::string>() + " without Python. "
+            "Only the templates reaktplot and none are available to the native exporters; set the template as a dictionary instead.");
+    else if(!name && theme)
+        layout.set("template", defaultTheme());
+
+    if(specs.frames.empty())
+        return {{"data", std::move(data)}, {"layout", std::move(layout)}};
+
+    for(auto const& [key, value] : animationControls(specs.frames))
+        if(!layout.find(key))
+            layout.set(key, value);
+
+    if(!frames)
+        return {{"data", std::move(data)}, {"layout", std::move(layout)}};
+
+    List list;
+    list.reserve(specs.frames.size());
+    eachPlaybackFrame(specs, 0, specs.frames.size(), false, [&](FrameSpecs const& frame) { list.push_back(plotlyFrame(frame)); });
+
+    return {{"data", std::move(data)}, {"layout", std::move(layout)}, {"frames", std::move(list)}};
+}
+
+auto plotlyFrame(FrameSpecs const& frame) -> Dict
+{
+    List data;
+    data.reserve(frame.traces.size());
+    for(auto const& trace : frame.traces)
+        data.push_back(nested(trace));
+    Dict entry = {{"name", frame.name}, {"data", std::move(data)}};
+    if(!frame.layout.empty())
+        entry.set("layout", nested(frame.layout));
+    return entry;
+}
+
+auto writeFrames(JsonWriter& writer, FigureSpecs const& specs, bool deltas) -> void
+{
+    auto first = true;
+    writer.raw("[");
+    eachPlaybackFrame(specs, 0, specs.frames.size(), deltas, [&](FrameSpecs const& frame)
+    {
+        if(!first)
+            writer.raw(",");
+        first = false;
+        writer.write(plotlyFrame(frame));
+    });
+    writer.raw("]");
+}
+
+auto figureSpecs(Dict const& figure) -> FigureSpecs
+{
+    auto const list = [](Dict const& dict, std::string const& key)
+    {
+        auto const* value = dict.find(key);
+        return value && value->is<List>() ? value->as<List>() : List();
+    };
+
+    auto const dict = [](Dict const& dict, std::string const& key)
+    {
+        auto const* value = dict.find(key);
+        return value && value->is<Dict>() ? value->as<Dict>() : Dict();
+    };
+
+    auto const traces = [](List const& data)
+    {
+        std::vector<Dict> traces;
+        for(auto const& trace : data)
+            if(trace.is<Dict>())
+                traces.push_back(trace.as<Dict>());
+        return traces;
+    };
+
+    FigureSpecs specs;
+    specs.layout = dict(figure, "layout");
+    specs.traces = traces(list(figure, "data"));
+
+    for(auto const& value : list(figure, "frames"))
+    {
+        if(!value.is<Dict>())
+            continue;
+        auto const& frame = value.as<Dict>();
+        auto const* name = frame.find("name");
+        specs.frames.push_back({ name && name->is<std::string>() ? name->as<std::string>() : std::to_string(specs.frames.size()), traces(list(frame, "data")), dict(frame, "layout"), {} });
+    }
+
+    return specs;
+}
+
+auto readJson(std::istream& in) -> FigureSpecs
+{
+    auto const figure = JsonReader(in).read();
+    if(!figure.is<Dict>())
+        throw std::runtime_error("Could not read a figure from JSON, which is not an object with keys data and layout.");
+    return figureSpecs(figure.as<Dict>());
+}
+
+auto writeJson(std::ostream& out, FigureSpecs const& specs, JsonOptions const& options) -> void
+{
+    JsonWriter writer(out, options);
+
+    if(specs.frames.empty())
+        return writer.write(plotlyFigure(specs, options.theme));
+
+    Dict const figure = plotlyFigure(specs, options.theme, false);
+    writer.raw("{\"data\":");
+    writer.write(figure.find("data")->as<List>());
+    writer.raw(",\"layout\":");
+    writer.write(figure.find("layout")->as<Dict>());
+    writer.raw(",\"frames\":");
+    writeFrames(writer, specs);
+    writer.raw("}");
+}
+
+auto toJson(FigureSpecs const& specs, JsonOptions const& options) -> std::string
+{
+    std::ostringstream out;
+    writeJson(out, specs, options);
+    return out.str();
+}
+
+} // namespace reaktplot
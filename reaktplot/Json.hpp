@@ -0,0 +1,174 @@
+// reaktplot - a modern C++ scientific plotting library powered by plotly
+// https://github.com/reaktplot/reaktplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2022-2023 Allan Leal
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+// NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#pragma once
+
+// C++ includes
+#include <istream>
+#include <ostream>
+#include <string>
+
+// reaktplot includes
+#include <reaktplot/Column.hpp>
+#include <reaktplot/Macros.hpp>
+#include <reaktplot/Specs.hpp>
+#include <reaktplot/Value.hpp>
+
+namespace reaktplot {
+
+/// Used to specify how figures are serialized to JSON.
+struct JsonOptions
+{
+    /// Whether numeric data arrays are written as typed-array blocks `{"dtype": "f8", "bdata": "..."}` with base64
+    /// encoded little-endian doubles, as understood by plotly.js 2.28 and later, instead of arrays of numbers.
+    bool typedarrays = false;
+
+    /// Whether the default theme of reaktplot is written as the template of the figure (unless the figure sets
+    /// another template).
+    bool theme = true;
+};
+
+/// Used to write values to an output stream in JSON format, as plotly expects them.
+/// The output is buffered and written to the stream in large blocks, so that figures can be written at disk bandwidth
+/// without building the whole JSON string in memory. Numbers are formatted with `std::to_chars` in their shortest
+/// form that round-trips, and non-finite numbers (e.g., NaN in missing data) are written as `null`.
+class RKP_EXPORT JsonWriter
+{
+public:
+    /// Construct a JsonWriter object that writes to a given output stream.
+    explicit JsonWriter(std::ostream& out, JsonOptions const& options = {});
+
+    /// Destroy this JsonWriter object after writing any buffered output to the stream.
+    ~JsonWriter();
+
+    /// Write a value.
+    auto write(Value const& value) -> void;
+
+    /// Write a dictionary as a JSON object.
+    auto write(Dict const& dict) -> void;
+
+    /// Write a list as a JSON array.
+    auto write(List const& list) -> void;
+
+    /// Write a data column as a JSON array (of arrays, for a matrix) or a typed-array block.
+    auto write(Column const& column) -> void;
+
+    /// Write a string with the required escapes.
+    auto write(std::string const& str) -> void;
+
+    /// Write a number.
+    auto write(double number) -> void;
+
+    /// Write raw JSON text as is.
+    auto raw(std::string const& text) -> void;
+
+    /// Write the buffered output to the stream.
+    auto flush() -> void;
+
+private:
+    /// The output stream.
+    std::ostream& out;
+
+    /// The options used to write JSON.
+    JsonOptions options;
+
+    /// The buffered output not yet written to the stream.
+    std::string buffer;
+
+    /// Append a character to the buffered output.
+    auto put(char c) -> void;
+
+    /// Append characters to the buffered output.
+    auto put(char const* data, std::size_t size) -> void;
+};
+
+/// Used to read values from an input stream in JSON format (e.g., a figure written by JsonWriter).
+/// Arrays of numbers (with `null` for missing values), arrays of such arrays, and typed-array blocks are read as data
+/// columns (the latter two as matrices), so that a figure read back has the data columns it was written with.
+class RKP_EXPORT JsonReader
+{
+public:
+    /// Construct a JsonReader object that reads from a given input stream.
+    explicit JsonReader(std::istream& in);
+
+    /// Read a value.
+    auto read() -> Value;
+
+private:
+    /// The buffer of the input stream, read directly so that errors in it (e.g., in decompression) are not swallowed.
+    std::streambuf& in;
+
+    /// Skip whitespace and return the next character without extracting it.
+    auto peek() -> int;
+
+    /// Skip whitespace, extract the next character, and check it is a given one.
+    auto expect(char c) -> void;
+
+    /// Read a string.
+    auto readString() -> std::string;
+
+    /// Read a number.
+    auto readNumber() -> Value;
+
+    /// Read an array, as a data column if it holds numbers or arrays of numbers.
+    auto readArray() -> Value;
+
+    /// Read an object, as a data column if it is a typed-array block.
+    auto readObject() -> Value;
+
+    /// Read a literal (e.g., `true`).
+    auto readLiteral(std::string const& literal) -> void;
+};
+
+/// Return the layout properties `updatemenus` and `sliders` with the play and pause buttons and the slider of an animation.
+RKP_EXPORT auto animationControls(std::vector<FrameSpecs> const& frames) -> Dict;
+
+/// Return the figure as a dictionary following plotly's figure schema, with keys `data` and `layout` (and `frames` if animated).
+/// The magic underscore keys of traces and layout are expanded into nested dictionaries, the axes are inserted in the
+/// layout, and the default theme of reaktplot is used as the template of the figure (if @p theme is true and the
+/// figure sets no other template). The controls of an animated figure are added to its layout unless already set, and
+/// its frames are those of @ref playbackFrames, unless @p frames is false (e.g., to write them with @ref writeFrames).
+RKP_EXPORT auto plotlyFigure(FigureSpecs const& specs, bool theme = true, bool frames = true) -> Dict;
+
+/// Return a frame as a dictionary following plotly's frame schema, with keys `name`, `data` and `layout`.
+RKP_EXPORT auto plotlyFrame(FrameSpecs const& frame) -> Dict;
+
+/// Write the frames of an animated figure as a JSON array, one frame at a time (see @ref eachPlaybackFrame), keeping
+/// their deltas if @p deltas is true (see @ref frameDeltaScript).
+RKP_EXPORT auto writeFrames(JsonWriter& writer, FigureSpecs const& specs, bool deltas = false) -> void;
+
+/// Return a figure given as a dictionary following plotly's figure schema (e.g., as returned by @ref plotlyFigure).
+/// The axes are kept in the layout, and the frames are stored with all the attributes of their traces.
+RKP_EXPORT auto figureSpecs(Dict const& figure) -> FigureSpecs;
+
+/// Read a figure from an input stream in plotly's JSON format (e.g., as written by @ref writeJson).
+RKP_EXPORT auto readJson(std::istream& in) -> FigureSpecs;
+
+/// Write a figure to an output stream in plotly's JSON format (e.g., as written by `plotly.io.write_json`).
+/// The data columns are written straight to the stream in blocks (see JsonWriter) and the frames one at a time, so
+/// that the memory used beyond the figure itself does not grow with its size.
+RKP_EXPORT auto writeJson(std::ostream& out, FigureSpecs const& specs, JsonOptions const& options = {}) -> void;
+
+/// Return a figure in plotly's JSON format.
+RKP_EXPORT auto toJson(FigureSpecs const& specs, JsonOptions const& options = {}) -> std::string;
+
+} // namespace reaktplot
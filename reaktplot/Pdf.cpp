@@ -0,0 +1,515 @@
+// reaktplot - a modern C++ scientific plotting library powered by plotly
+// https://github.com/reaktplot/reaktplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2022-2023 Allan Leal
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+// NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include "Pdf.hpp"
+
+// C++ includes
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+
+// zlib includes
+#ifdef REAKTPLOT_HAS_ZLIB
+#include <zlib.h>
+#endif
+
+// reaktplot includes
+#include <reaktplot/Constants.hpp>
+#include <reaktplot/Renderer.hpp>
+
+namespace reaktplot {
+namespace {
+
+/// The number of pt per px (as in CSS, where 1 px is 1/96 in and 1 pt is 1/72 in).
+const auto PT_PER_PX = 0.75;
+
+/// The object numbers of the document catalog, the page tree, and the resources shared by all pages.
+const std::size_t CATALOG = 1, PAGES = 2, RESOURCES = 3;
+
+/// Return a number formatted with at most given decimal places, without trailing zeros.
+auto num(double value, int digits = 2) -> std::string
+{
+    char chars[32];
+    std::snprintf(chars, sizeof(chars), "%.*f", digits, value + 0.0);
+    std::string str = chars;
+    if(str.find('.') != std::string::npos)
+    {
+        str.erase(str.find_last_not_of('0') + 1);
+        if(str.back() == '.')
+            str.pop_back();
+    }
+    return str == "-0" ? "0" : str;
+}
+
+/// Return the components of a color as in the color operators of PDF (e.g., `0.267 0.267 0.267`).
+auto rgb(Color const& c) -> std::string
+{
+    return num(c.r / 255.0, 3) + " " + num(c.g / 255.0, 3) + " " + num(c.b / 255.0, 3);
+}
+
+/// Return an opacity in thousandths (used to name the transparency settings shared by all pages).
+auto thousandths(double opacity) -> int
+{
+    return static_cast<int>(std::lround(std::min(std::max(opacity, 0.0), 1.0) * 1000));
+}
+
+/// Return the name of the standard PDF font closest to a font family (e.g., `Courier` for `Courier New, monospace`).
+auto standardFont(std::string family) -> std::string
+{
+    for(auto& c : family)
+        c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+    if(family.find("courier") != std::string::npos || family.find("mono") != std::string::npos)
+        return "Courier";
+    if(family.find("times") != std::string::npos || (family.find("serif") != std::string::npos && family.find("sans") == std::string::npos))
+        return "Times-Roman";
+    return "Helvetica";
+}
+
+/// Return the resource name of a standard PDF font (e.g., `/Helvetica` for `Helvetica`).
+auto fontName(std::string const& font) -> std::string
+{
+    return font == "Times-Roman" ? "/Times" : "/" + font;
+}
+
+/// The widths of the characters from space to tilde in Helvetica and Times-Roman, from their AFM files (in 1/1000 of the font size).
+const short HELVETICA_WIDTHS[] = {
+    278, 278, 355, 556, 556, 889, 667, 191, 333, 333, 389, 584, 278, 333, 278, 278, // space to /
+    556, 556, 556, 556, 556, 556, 556, 556, 556, 556, 278, 278, 584, 584, 584, 556, // 0 to ?
+    1015, 667, 667, 722, 722, 667, 611, 778, 722, 278, 500, 667, 556, 833, 722, 778, // @ to O
+    667, 778, 722, 667, 611, 722, 667, 944, 667, 667, 611, 278, 278, 278, 469, 556, // P to _
+    333, 556, 556, 500, 556, 556, 278, 556, 556, 222, 222, 500, 222, 833, 556, 556, // ` to o
+    556, 556, 333, 500, 278, 556, 500, 722, 500, 500, 500, 334, 260, 334, 584,      // p to ~
+};
+const short TIMES_WIDTHS[] = {
+    250, 333, 408, 500, 500, 833, 778, 180, 333, 333, 500, 564, 250, 333, 250, 278, // space to /
+    500, 500, 500, 500, 500, 500, 500, 500, 500, 500, 278, 278, 564, 564, 564, 444, // 0 to ?
+    921, 722, 667, 667, 722, 611, 556, 722, 722, 333, 389, 722, 611, 889, 722, 722, // @ to O
+    556, 722, 667, 556, 611, 722, 722, 944, 722, 722, 611, 333, 278, 333, 469, 500, // P to _
+    333, 444, 500, 444, 500, 444, 333, 500, 500, 278, 278, 500, 278, 778, 500, 500, // ` to o
+    500, 500, 333, 389, 278, 500, 500, 722, 500, 500, 444, 480, 200, 480, 541,      // p to ~
+};
+
+/// Return the width of a character in WinAnsiEncoding in a standard PDF font (in 1/1000 of the font size).
+auto charWidth(std::string const& font, unsigned char byte) -> int
+{
+    if(font == "Courier")
+        return 600; // a monospaced font
+    auto const times = font == "Times-Roman";
+    if(byte >= 32 && byte < 127)
+        return (times ? TIMES_WIDTHS : HELVETICA_WIDTHS)[byte - 32];
+    switch(byte)
+    {
+        case 0x85: case 0x97: return 1000; // the ellipsis and the em dash
+        case 0x95: return 350; // the bullet
+        case 0x96: return times ? 500 : 556; // the en dash
+        case 0xA0: return times ? 250 : 278; // the no-break space
+        case 0xB0: return 400; // the degree sign
+        case 0xB1: case 0xD7: return times ? 564 : 584; // the plus-minus and multiplication signs
+        case 0xB2: case 0xB3: case 0xB9: return times ? 300 : 333; // the superscript digits
+        default: return times ? 500 : 556; // as most other letters (e.g., the micro sign)
+    }
+}
+
+/// Return UTF-8 text in WinAnsiEncoding, with `?` for characters it lacks.
+auto winAnsi(std::string const& str) -> std::string
+{
+    std::string res;
+    for(std::size_t i = 0; i < str.size();)
+    {
+        auto const c = static_cast<unsigned char>(str[i]);
+        auto const len = c < 0x80 ? 1 : (c >> 5) == 0x6 ? 2 : (c >> 4) == 0xE ? 3 : 4;
+        char32_t code = len == 1 ? c : len == 2 ? c & 0x1F : len == 3 ? c & 0x0F : c & 0x07;
+        for(int k = 1; k < len && i + k < str.size(); ++k)
+            code = (code << 6) | (static_cast<unsigned char>(str[i + k]) & 0x3F);
+        i += len;
+
+        unsigned char byte = '?';
+        if(code < 0x7F || (code >= 0xA0 && code <= 0xFF)) byte = static_cast<unsigned char>(code);
+        else if(code == 0x2212) byte = '-'; // the minus sign used in tick labels
+        else if(code == 0x03BC) byte = 0xB5; // the Greek letter mu as the micro sign
+        else if(code == 0x2013) byte = 0x96;
+        else if(code == 0x2014) byte = 0x97;
+        else if(code == 0x2022) byte = 0x95;
+        else if(code == 0x2026) byte = 0x85;
+        else if(code == 0x20AC) byte = 0x80;
+
+        if(byte < 32)
+            byte = ' ';
+        res += static_cast<char>(byte);
+    }
+    return res;
+}
+
+/// Return UTF-8 text as a PDF string in WinAnsiEncoding (e.g., `(x \\(m\\))`), with `?` for characters it lacks.
+auto encoded(std::string const& str) -> std::string
+{
+    std::string res = "(";
+    for(auto const c : winAnsi(str))
+    {
+        if(c == '(' || c == ')' || c == '\\')
+            res += '\\';
+        res += c;
+    }
+    return res + ")";
+}
+
+/// Return the content of a page compressed with zlib, or unchanged if zlib is not available.
+auto deflated(std::string const& data) -> std::string
+{
+#ifdef REAKTPLOT_HAS_ZLIB
+    auto size = compressBound(static_cast<uLong>(data.size()));
+    std::string res(size, '\0');
+    if(compress2(reinterpret_cast<Bytef*>(&res[0]), &size, reinterpret_cast<Bytef const*>(data.data()), static_cast<uLong>(data.size()), Z_DEFAULT_COMPRESSION) != Z_OK)
+        throw std::runtime_error("Could not compress the content of the PDF page.");
+    res.resize(size);
+    return res;
+#else
+    return data;
+#endif
+}
+
+/// Add the path of a polyline to the content of a page.
+auto path(std::string& content, std::vector<Point> const& points, bool closed) -> void
+{
+    for(std::size_t i = 0; i < points.size(); ++i)
+        content += num(points[i].x) + " " + num(points[i].y) + (i ? " l\n" : " m\n");
+    if(closed)
+        content += "h\n";
+}
+
+} // namespace ""
+
+PdfCanvas::PdfCanvas(std::ostream& out)
+: out(out), offsets(RESOURCES + 1, 0)
+{
+    write("%PDF-1.4\n%\xE2\xE3\xCF\xD3\n"); // the binary comment tells file transfer programs that the file is not text
+}
+
+auto PdfCanvas::write(std::string const& str) -> void
+{
+    out.write(str.data(), static_cast<std::streamsize>(str.size()));
+    offset += str.size();
+}
+
+auto PdfCanvas::object(std::size_t id) -> void
+{
+    if(offsets.size() <= id)
+        offsets.resize(id + 1, 0);
+    offsets[id] = offset;
+    write(std::to_string(id) + " 0 obj\n");
+}
+
+auto PdfCanvas::begin(int width, int height) -> void
+{
+    if(closed)
+        throw std::runtime_error("Could not add a page to a PDF document that has been closed.");
+    w = width;
+    h = height;
+    state = saved = {};
+    clipped = false;
+    content = num(PT_PER_PX) + " 0 0 " + num(-PT_PER_PX) + " 0 " + num(height * PT_PER_PX) + " cm\n"; // draw in px with the y-axis pointing down
+}
+
+auto PdfCanvas::end() -> void
+{
+    unclip();
+
+    auto const data = deflated(content);
+    content.clear();
+    content.shrink_to_fit();
+
+    auto const id = offsets.size();
+    object(id);
+    write("<< /Length " + std::to_string(data.size()));
+#ifdef REAKTPLOT_HAS_ZLIB
+    write(" /Filter /FlateDecode");
+#endif
+    write(" >>\nstream\n");
+    write(data);
+    write("\nendstream\nendobj\n");
+
+    object(id + 1);
+    write("<< /Type /Page /Parent " + std::to_string(PAGES) + " 0 R /MediaBox [0 0 " + num(w * PT_PER_PX) + " " + num(h * PT_PER_PX) +
+        "] /Resources " + std::to_string(RESOURCES) + " 0 R /Contents " + std::to_string(id) + " 0 R >>\nendobj\n");
+    pageids.push_back(id + 1);
+
+    out.flush();
+}
+
+auto PdfCanvas::clip(Rect const& r) -> void
+{
+    unclip();
+    saved = state;
+    content += "q\n" + num(r.x) + " " + num(r.y) + " " + num(r.width) + " " + num(r.height) + " re W n\n";
+    clipped = true;
+}
+
+auto PdfCanvas::unclip() -> void
+{
+    if(clipped)
+    {
+        content += "Q\n";
+        state = saved; // the graphics state is restored to the one before the clip path
+    }
+    clipped = false;
+}
+
+auto PdfCanvas::set(std::string& current, std::string const& op) -> void
+{
+    if(current == op)
+        return;
+    content += op;
+    current = op;
+}
+
+auto PdfCanvas::paint(Color const& fill, Stroke const& stroke, bool round) -> std::string
+{
+    auto const filled = !fill.none();
+    auto const stroked = !stroke.none();
+
+    auto const fillopacity = thousandths(filled ? fill.a : 1.0);
+    auto const strokeopacity = thousandths(stroked ? stroke.color.a : 1.0);
+    if(fillopacity < 1000 || strokeopacity < 1000 || !state.opacity.empty())
+    {
+        opacities.insert({ fillopacity, strokeopacity });
+        set(state.opacity, "/A" + std::to_string(fillopacity) + "_" + std::to_string(strokeopacity) + " gs\n");
+    }
+
+    if(filled)
+        set(state.fill, rgb(fill) + " rg\n");
+
+    if(stroked)
+    {
+        set(state.stroke, rgb(stroke.color) + " RG\n");
+        set(state.width, num(stroke.width) + " w\n");
+        std::string dash = "[";
+        for(std::size_t i = 0; i < stroke.dashes.size(); ++i)
+            dash += (i ? " " : "") + num(stroke.dashes[i]);
+        set(state.dash, dash + "] 0 d\n");
+        set(state.join, round ? "1 j\n" : "0 j\n");
+    }
+
+    return filled && stroked ? "B\n" : filled ? "f\n" : stroked ? "S\n" : "n\n";
+}
+
+auto PdfCanvas::rect(Rect const& r, Color const& fill, Stroke const& stroke) -> void
+{
+    if(fill.none() && stroke.none())
+        return;
+    auto const op = paint(fill, stroke);
+    content += num(r.x) + " " + num(r.y) + " " + num(r.width) + " " + num(r.height) + " re\n" + op;
+}
+
+auto PdfCanvas::polyline(std::vector<Point> const& points, Stroke const& stroke) -> void
+{
+    if(points.size() < 2 || stroke.none())
+        return;
+    auto const op = paint({0, 0, 0, 0.0}, stroke, true);
+    path(content, points, false);
+    content += op;
+}
+
+auto PdfCanvas::segments(std::vector<Point> const& points, Stroke const& stroke) -> void
+{
+    if(points.size() < 2 || stroke.none())
+        return;
+    auto const op = paint({0, 0, 0, 0.0}, stroke);
+    for(std::size_t i = 0; i + 1 < points.size(); i += 2)
+        content += num(points[i].x) + " " + num(points[i].y) + " m\n" + num(points[i + 1].x) + " " + num(points[i + 1].y) + " l\n";
+    content += op;
+}
+
+auto PdfCanvas::polygons(std::vector<std::vector<Point>> const& polygons, Color const& fill, Stroke const& stroke) -> void
+{
+    if(polygons.empty() || (fill.none() && stroke.none()))
+        return;
+    auto const op = paint(fill, stroke);
+    for(auto const& polygon : polygons)
+        path(content, polygon, true);
+    content += op;
+}
+
+auto PdfCanvas::circle(Point const& center, double radius, Color const& fill, Stroke const& stroke) -> void
+{
+    if(fill.none() && stroke.none())
+        return;
+    auto const op = paint(fill, stroke);
+    auto const k = 0.5523 * radius; // the distance of the control points of a cubic Bézier curve that approximates a quarter of a circle
+    auto const x = center.x, y = center.y, r = radius;
+    content += num(x + r) + " " + num(y) + " m\n";
+    content += num(x + r) + " " + num(y + k) + " " + num(x + k) + " " + num(y + r) + " " + num(x) + " " + num(y + r) + " c\n";
+    content += num(x - k) + " " + num(y + r) + " " + num(x - r) + " " + num(y + k) + " " + num(x - r) + " " + num(y) + " c\n";
+    content += num(x - r) + " " + num(y - k) + " " + num(x - k) + " " + num(y - r) + " " + num(x) + " " + num(y - r) + " c\n";
+    content += num(x + k) + " " + num(y - r) + " " + num(x + r) + " " + num(y - k) + " " + num(x + r) + " " + num(y) + " c\nh\n" + op;
+}
+
+auto PdfCanvas::text(Point const& pos, std::string const& str, TextStyle const& style) -> void
+{
+    if(str.empty() || style.color.none())
+        return;
+
+    paint(style.color, {});
+
+    auto const font = standardFont(style.family);
+    fonts.insert(font);
+
+    auto const angle = style.angle * PI / 180.0;
+    auto const cos = std::cos(angle), sin = std::sin(angle);
+
+    auto const width = textWidth(str, style);
+    auto const shift = style.anchor == Anchor::Start ? 0.0 : style.anchor == Anchor::Middle ? -0.5 * width : -width;
+
+    // The text matrix rotates the text clockwise around its position and flips it upright again in the page whose y-axis points down
+    content += "BT\n" + fontName(font) + " " + num(style.size) + " Tf\n";
+    content += num(cos, 4) + " " + num(sin, 4) + " " + num(sin, 4) + " " + num(-cos, 4) + " " + num(pos.x + cos * shift) + " " + num(pos.y + sin * shift) + " Tm\n";
+    content += encoded(str) + " Tj\nET\n";
+}
+
+auto PdfCanvas::textWidth(std::string const& str, TextStyle const& style) -> double
+{
+    auto const font = standardFont(style.family);
+    auto width = 0;
+    for(auto const c : winAnsi(str))
+        width += charWidth(font, static_cast<unsigned char>(c));
+    return width * style.size / 1000.0;
+}
+
+auto PdfCanvas::close() -> void
+{
+    if(closed)
+        return;
+    closed = true;
+
+    std::string fontrefs;
+    for(auto const& font : fonts)
+    {
+        auto const id = offsets.size();
+        object(id);
+        write("<< /Type /Font /Subtype /Type1 /BaseFont /" + font + " /Encoding /WinAnsiEncoding >>\nendobj\n");
+        fontrefs += " " + fontName(font) + " " + std::to_string(id) + " 0 R";
+    }
+
+    std::string states;
+    for(auto const& [fill, stroke] : opacities)
+        states += " /A" + std::to_string(fill) + "_" + std::to_string(stroke) + " << /Type /ExtGState /ca " + num(fill / 1000.0, 3) + " /CA " + num(stroke / 1000.0, 3) + " >>";
+
+    object(RESOURCES);
+    write("<< /ProcSet [/PDF /Text] /Font <<" + fontrefs + " >> /ExtGState <<" + states + " >> >>\nendobj\n");
+
+    std::string kids;
+    for(auto const id : pageids)
+        kids += (kids.empty() ? "" : " ") + std::to_string(id) + " 0 R";
+    object(PAGES);
+    write("<< /Type /Pages /Kids [" + kids + "] /Count " + std::to_string(pageids.size()) + " >>\nendobj\n");
+
+    object(CATALOG);
+    write("<< /Type /Catalog /Pages " + std::to_string(PAGES) + " 0 R >>\nendobj\n");
+
+    auto const xref = offset;
+    write("xref\n0 " + std::to_string(offsets.size()) + "\n0000000000 65535 f \n");
+    for(std::size_t id = 1; id < offsets.size(); ++id)
+    {
+        char entry[21];
+        std::snprintf(entry, sizeof(entry), "%010zu 00000 n \n", offsets[id]);
+        write(entry);
+    }
+    write("trailer\n<< /Size " + std::to_string(offsets.size()) + " /Root " + std::to_string(CATALOG) + " 0 R >>\nstartxref\n" + std::to_string(xref) + "\n%%EOF\n");
+    out.flush();
+}
+
+auto writePdf(std::ostream& out, FigureSpecs const& specs, int width, int height) -> void
+{
+    PdfCanvas canvas(out);
+    render(canvas, specs, width, height);
+    canvas.close();
+}
+
+auto savePdf(std::string const& file, FigureSpecs const& specs, int width, int height) -> void
+{
+    std::ofstream out(file, std::ios::binary);
+    if(!out)
+        throw std::runtime_error("Could not open file " + file + " for writing.");
+    writePdf(out, specs, width, height);
+    if(!out)
+        throw std::runtime_error("Could not write file " + file + ".");
+}
+
+struct PdfReport::Data
+{
+    /// The name of the PDF file.
+    std::string file;
+
+    /// The output stream of the PDF file.
+    std::ofstream out;
+
+    /// The canvas on which the figures are drawn, one per page.
+    std::unique_ptr<PdfCanvas> canvas;
+};
+
+PdfReport::PdfReport(std::string const& file)
+: data(new Data)
+{
+    data->file = file;
+    data->out.open(file, std::ios::binary);
+    if(!data->out)
+        throw std::runtime_error("Could not open file " + file + " for writing.");
+    data->canvas = std::make_unique<PdfCanvas>(data->out);
+}
+
+PdfReport::~PdfReport()
+{
+    try { close(); } catch(...) {}
+}
+
+auto PdfReport::add(Figure const& figure, int width, int height) -> void
+{
+    if(!data->out.is_open())
+        throw std::runtime_error("Could not add a page to PDF file " + data->file + " because it has been closed.");
+    render(*data->canvas, figure.specs(), width, height);
+    if(!data->out)
+        throw std::runtime_error("Could not write file " + data->file + ".");
+}
+
+auto PdfReport::addFrames(Figure const& figure, int width, int height) -> void
+{
+    figure.eachFrame([&](Figure const& frame, std::size_t) { add(frame, width, height); });
+}
+
+auto PdfReport::close() -> void
+{
+    if(!data->out.is_open())
+        return;
+    data->canvas->close();
+    data->out.close();
+    if(!data->out)
+        throw std::runtime_error("Could not write file " + data->file + ".");
+}
+
+auto PdfReport::pages() const -> std::size_t
+{
+    return data->canvas->pages();
+}
+
+} // namespace reaktplot
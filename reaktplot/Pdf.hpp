@@ -0,0 +1,172 @@
+// reaktplot - a modern C++ scientific plotting library powered by plotly
+// https://github.com/reaktplot/reaktplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2022-2023 Allan Leal
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+// NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#pragma once
+
+// C++ includes
+#include <cstddef>
+#include <memory>
+#include <ostream>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+// reaktplot includes
+#include <reaktplot/Canvas.hpp>
+#include <reaktplot/Default.hpp>
+#include <reaktplot/Figure.hpp>
+#include <reaktplot/Macros.hpp>
+#include <reaktplot/Specs.hpp>
+
+namespace reaktplot {
+
+/// Used to draw figures in PDF format, as vector graphics with one page per figure.
+/// Pages are written to the output stream as soon as they are drawn (see @ref end), so that only the page being drawn
+/// is kept in memory. Text is drawn with the standard PDF fonts (Helvetica, Times, and Courier), which are not embedded
+/// and are measured with the widths in their AFM files, and the fonts and transparency settings are resources shared by
+/// all pages, written once by @ref close.
+/// Sizes in px are converted to pt as in CSS (i.e., 1 px is 0.75 pt).
+class RKP_EXPORT PdfCanvas : public Canvas
+{
+public:
+    /// Construct a PdfCanvas object that writes a PDF document to an output stream.
+    explicit PdfCanvas(std::ostream& out);
+
+    auto begin(int width, int height) -> void override;
+    auto end() -> void override;
+    auto clip(Rect const& rect) -> void override;
+    auto unclip() -> void override;
+    auto rect(Rect const& rect, Color const& fill, Stroke const& stroke = {}) -> void override;
+    auto polyline(std::vector<Point> const& points, Stroke const& stroke) -> void override;
+    auto segments(std::vector<Point> const& points, Stroke const& stroke) -> void override;
+    auto polygons(std::vector<std::vector<Point>> const& polygons, Color const& fill, Stroke const& stroke = {}) -> void override;
+    auto circle(Point const& center, double radius, Color const& fill, Stroke const& stroke = {}) -> void override;
+    auto text(Point const& pos, std::string const& str, TextStyle const& style) -> void override;
+    auto textWidth(std::string const& str, TextStyle const& style) -> double override;
+
+    /// Finish the PDF document by writing the resources shared by its pages, the page tree, and the cross-reference table.
+    auto close() -> void;
+
+    /// Return the number of pages drawn so far.
+    auto pages() const -> std::size_t { return pageids.size(); }
+
+private:
+    /// Used to represent the graphics state set by the operators in the content of the page.
+    struct State
+    {
+        /// The operators that set the fill color, stroke color, line width, dash pattern, line join, and opacity.
+        std::string fill, stroke, width, dash, join, opacity;
+    };
+
+    /// Write a string to the output stream and keep track of its size (used for the cross-reference table).
+    auto write(std::string const& str) -> void;
+
+    /// Start writing an object with given number.
+    auto object(std::size_t id) -> void;
+
+    /// Add an operator to the content of the page, unless the graphics state already has it.
+    auto set(std::string& current, std::string const& op) -> void;
+
+    /// Set the graphics state for painting with a fill color and a stroke and return the painting operator (e.g., `B`).
+    auto paint(Color const& fill, Stroke const& stroke, bool round = false) -> std::string;
+
+    /// The output stream of the PDF document.
+    std::ostream& out;
+
+    /// The number of bytes written to the output stream so far.
+    std::size_t offset = 0;
+
+    /// The position in the output stream of each object written so far (indexed by object number).
+    std::vector<std::size_t> offsets;
+
+    /// The object numbers of the pages written so far.
+    std::vector<std::size_t> pageids;
+
+    /// The names of the standard fonts used in any page (e.g., `Helvetica`).
+    std::set<std::string> fonts;
+
+    /// The pairs of fill and stroke opacities used in any page (in thousandths).
+    std::set<std::pair<int, int>> opacities;
+
+    /// The content of the page being drawn.
+    std::string content;
+
+    /// The width and height of the page being drawn (in px).
+    int w = 0, h = 0;
+
+    /// The current graphics state, and the one saved when drawing was restricted to a clip path.
+    State state, saved;
+
+    /// Whether drawing is currently restricted to a clip path.
+    bool clipped = false;
+
+    /// Whether the document has been finished.
+    bool closed = false;
+};
+
+/// Write a figure in PDF format, rendered natively in C++ (see @ref render).
+/// @param out The output stream.
+/// @param specs The specification of the figure.
+/// @param width The width of the figure (in px).
+/// @param height The height of the figure (in px).
+RKP_EXPORT auto writePdf(std::ostream& out, FigureSpecs const& specs, int width, int height) -> void;
+
+/// Save a figure to a PDF file, rendered natively in C++ (see @ref writePdf).
+RKP_EXPORT auto savePdf(std::string const& file, FigureSpecs const& specs, int width, int height) -> void;
+
+/// Used to produce a single PDF file with many figures, one per page (e.g., a report with hundreds of figures).
+/// Figures are rendered natively in C++ (see @ref render) as they are added, regardless of the backend of the session,
+/// so there is no renderer to start and no intermediate files to merge. Each page is written to the file as soon as
+/// it is drawn, so that memory use does not grow with the number of pages, and the fonts are shared by all pages.
+class RKP_EXPORT PdfReport
+{
+public:
+    /// Construct a PdfReport object that writes a PDF file. Throws if the file cannot be opened.
+    explicit PdfReport(std::string const& file);
+
+    /// Destroy this PdfReport object after finishing the PDF file (see @ref close), ignoring any error.
+    ~PdfReport();
+
+    /// Render a figure and add it as the next page of the PDF file.
+    /// @param figure The figure to add.
+    /// @param width The width of the page (in px).
+    /// @param height The height of the page (in px).
+    auto add(Figure const& figure, int width=DEFAULT_FIGURE_WIDTH, int height=DEFAULT_FIGURE_HEIGHT) -> void;
+
+    /// Add the frames of an animated figure as consecutive pages of the PDF file (see Figure::beginFrame).
+    auto addFrames(Figure const& figure, int width=DEFAULT_FIGURE_WIDTH, int height=DEFAULT_FIGURE_HEIGHT) -> void;
+
+    /// Finish the PDF file, throwing an error if it could not be written.
+    auto close() -> void;
+
+    /// Return the number of pages added so far.
+    auto pages() const -> std::size_t;
+
+private:
+    struct Data;
+
+    /// The implementation details of the report.
+    std::unique_ptr<Data> data;
+};
+
+} // namespace reaktplot
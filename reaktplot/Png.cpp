@@ -0,0 +1,860 @@
+// reaktplot - a modern C++ scientific plotting library powered by plotly
+// https://github.com/reaktplot/reaktplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2022-2023 Allan Leal
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+// NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include "Png.hpp"
+
+// C++ includes
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <fstream>
+#include <functional>
+#include <limits>
+#include <map>
+#include <stdexcept>
+#include <unordered_map>
+
+// zlib includes
+#ifdef REAKTPLOT_HAS_ZLIB
+#include <zlib.h>
+#endif
+
+// reaktplot includes
+#include <reaktplot/Constants.hpp>
+#include <reaktplot/Renderer.hpp>
+
+namespace reaktplot {
+namespace {
+
+/// Used to represent the coverage of a glyph rasterized at some size, relative to the pen position.
+struct Mask
+{
+    /// The offset of the top left pixel of the mask from the pen position (in pixels).
+    int left = 0, top = 0;
+
+    /// The width and height of the mask (in pixels).
+    int width = 0, height = 0;
+
+    /// The coverage of each pixel (from 0 to 255).
+    std::vector<unsigned char> values;
+};
+
+/// The number of horizontal sub-pixel positions for which glyphs are rasterized.
+const int SUBPIXELS = 4;
+
+/// The maximum number of glyph masks kept in the cache of a thread.
+const std::size_t MAX_CACHED_MASKS = 4096;
+
+/// The size of the compressed data written in each IDAT chunk by a PngWriter (in bytes).
+const std::size_t IDAT_SIZE = 1 << 20;
+
+/// Used to accumulate the signed area covered by the edges of shapes in a region of pixels.
+/// The coverage of a pixel is then the absolute value of the sum of the values on its left in the row (including its own).
+struct Cells
+{
+    /// The accumulated values, in rows of `stride` values (with at least `width + 2` values).
+    float* values = nullptr;
+
+    /// The number of values between the starts of consecutive rows.
+    std::size_t stride = 0;
+
+    /// The width and height of the region (in pixels).
+    int width = 0, height = 0;
+
+    /// The first and last values changed in each row, if tracked (so that only those are scanned and reset afterwards).
+    int* first = nullptr;
+    int* last = nullptr;
+};
+
+/// Accumulate the signed area covered by a line within `0 <= x <= width` (the parts above or below the region are ignored).
+auto accumulate(Point p0, Point p1, Cells& cells) -> void
+{
+    if(p0.y == p1.y)
+        return;
+    auto const dir = p0.y < p1.y ? 1.0 : -1.0;
+    if(p0.y > p1.y)
+        std::swap(p0, p1);
+    auto const dxdy = (p1.x - p0.x) / (p1.y - p0.y);
+    auto x = p0.x;
+    if(p0.y < 0.0)
+        x -= p0.y * dxdy;
+    auto const ybegin = std::max(0, static_cast<int>(std::floor(p0.y)));
+    auto const yend = std::min(cells.height, static_cast<int>(std::ceil(p1.y)));
+    for(auto y = ybegin; y < yend; ++y)
+    {
+        auto* row = cells.values + static_cast<std::size_t>(y) * cells.stride;
+        auto const dy = std::min(y + 1.0, p1.y) - std::max(static_cast<double>(y), p0.y);
+        auto const xnext = x + dxdy * dy;
+        auto const d = dy * dir;
+        auto const x0 = std::min(x, xnext), x1 = std::max(x, xnext);
+        auto const x0floor = std::floor(x0);
+        auto const x0i = static_cast<int>(x0floor);
+        auto const x1ceil = std::ceil(x1);
+        auto const x1i = static_cast<int>(x1ceil);
+        if(x1i <= x0i + 1) // the line is within a single pixel of the row
+        {
+            auto const xmf = 0.5 * (x + xnext) - x0floor;
+            row[x0i] += static_cast<float>(d - d * xmf);
+            row[x0i + 1] += static_cast<float>(d * xmf);
+        }
+        else // the line crosses several pixels of the row, each covered in proportion
+        {
+            auto const s = 1.0 / (x1 - x0);
+            auto const x0f = x0 - x0floor;
+            auto const a0 = 0.5 * s * (1.0 - x0f) * (1.0 - x0f);
+            auto const x1f = x1 - x1ceil + 1.0;
+            auto const am = 0.5 * s * x1f * x1f;
+            row[x0i] += static_cast<float>(d * a0);
+            if(x1i == x0i + 2)
+                row[x0i + 1] += static_cast<float>(d * (1.0 - a0 - am));
+            else
+            {
+                auto const a1 = s * (1.5 - x0f);
+                row[x0i + 1] += static_cast<float>(d * (a1 - a0));
+                for(auto xi = x0i + 2; xi < x1i - 1; ++xi)
+                    row[xi] += static_cast<float>(d * s);
+                auto const a2 = a1 + (x1i - x0i - 3) * s;
+                row[x1i - 1] += static_cast<float>(d * (1.0 - a2 - am));
+            }
+            row[x1i] += static_cast<float>(d * am);
+        }
+        if(cells.first)
+        {
+            cells.first[y] = std::min(cells.first[y], x0i);
+            cells.last[y] = std::max(cells.last[y], std::max(x1i, x0i + 1));
+        }
+        x = xnext;
+    }
+}
+
+/// Accumulate the signed area covered by a line, with the parts left or right of the region moved onto its sides.
+auto accumulateClipped(Point p0, Point p1, Cells& cells) -> void
+{
+    auto const width = static_cast<double>(cells.width);
+    for(double const bound : { 0.0, width })
+    {
+        if((p0.x < bound && p1.x > bound) || (p0.x > bound && p1.x < bound))
+        {
+            auto const t = (bound - p0.x) / (p1.x - p0.x);
+            Point const m = { bound, p0.y + t * (p1.y - p0.y) };
+            accumulateClipped(p0, m, cells);
+            accumulateClipped(m, p1, cells);
+            return;
+        }
+    }
+    p0.x = std::clamp(p0.x, 0.0, width);
+    p1.x = std::clamp(p1.x, 0.0, width);
+    accumulate(p0, p1, cells);
+}
+
+/// Return the signed area of a polygon (positive if clockwise on the screen).
+auto area(std::vector<Point> const& polygon) -> double
+{
+    double res = 0.0;
+    for(std::size_t i = 0, n = polygon.size(); i < n; ++i)
+        res += polygon[i].x * polygon[(i + 1) % n].y - polygon[(i + 1) % n].x * polygon[i].y;
+    return 0.5 * res;
+}
+
+/// Return a polygon approximating a circle, clockwise on the screen.
+auto disk(Point const& center, double radius) -> std::vector<Point>
+{
+    auto const n = std::clamp(static_cast<int>(std::ceil(2 * PI * radius / 1.5)), 8, 256);
+    std::vector<Point> res(n);
+    for(int i = 0; i < n; ++i)
+        res[i] = { center.x + radius * std::cos(2 * PI * i / n), center.y + radius * std::sin(2 * PI * i / n) };
+    return res;
+}
+
+/// Return the table used to compute the CRC of PNG chunks.
+auto crctable() -> std::array<std::uint32_t, 256> const&
+{
+    static auto const table = []
+    {
+        std::array<std::uint32_t, 256> res{};
+        for(std::uint32_t n = 0; n < 256; ++n)
+        {
+            auto c = n;
+            for(int k = 0; k < 8; ++k)
+                c = c & 1 ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+            res[n] = c;
+        }
+        return res;
+    }();
+    return table;
+}
+
+/// Append a big-endian 32-bit integer to a byte string.
+auto append32(std::string& bytes, std::uint32_t value) -> void
+{
+    for(int shift = 24; shift >= 0; shift -= 8)
+        bytes += static_cast<char>(value >> shift & 0xFF);
+}
+
+/// Write a PNG chunk with given type and data.
+auto writeChunk(std::ostream& out, char const* type, std::string const& data) -> void
+{
+    std::string chunk;
+    append32(chunk, static_cast<std::uint32_t>(data.size()));
+    chunk.append(type, 4);
+    chunk += data;
+    auto const& table = crctable();
+    std::uint32_t crc = 0xFFFFFFFFu;
+    for(std::size_t i = 4; i < chunk.size(); ++i)
+        crc = table[(crc ^ static_cast<unsigned char>(chunk[i])) & 0xFF] ^ (crc >> 8);
+    append32(chunk, crc ^ 0xFFFFFFFFu);
+    out.write(chunk.data(), static_cast<std::streamsize>(chunk.size()));
+}
+
+/// Write a row of an image with the PNG filter (the difference to the pixel above or on the left) that compresses better.
+/// @param src The pixels of the row, with 4 bytes each.
+/// @param above The pixels of the row above, or null for the first row.
+/// @param width The number of pixels in the row.
+/// @param dst The filtered row, starting with the filter type, with `Channels` bytes per pixel.
+template<int Channels>
+auto filterRow(unsigned char const* src, unsigned char const* above, int width, unsigned char* dst) -> void
+{
+    static unsigned char const zeros[4] = {};
+    unsigned costup = 0, costsub = 0;
+    for(int x = 0; x < width; ++x)
+    {
+        auto const* left = x > 0 ? src + 4 * x - 4 : zeros;
+        auto const* top = above ? above + 4 * x : zeros;
+        for(int c = 0; c < Channels; ++c)
+        {
+            auto const up = static_cast<unsigned char>(src[4 * x + c] - top[c]);
+            auto const sub = static_cast<unsigned char>(src[4 * x + c] - left[c]);
+            dst[1 + Channels * x + c] = up;
+            costup += std::abs(static_cast<signed char>(up));
+            costsub += std::abs(static_cast<signed char>(sub));
+        }
+    }
+    dst[0] = 2; // the Up filter
+    if(costsub < costup)
+    {
+        dst[0] = 1; // the Sub filter
+        for(int x = 0; x < width; ++x)
+        {
+            auto const* left = x > 0 ? src + 4 * x - 4 : zeros;
+            for(int c = 0; c < Channels; ++c)
+                dst[1 + Channels * x + c] = static_cast<unsigned char>(src[4 * x + c] - left[c]);
+        }
+    }
+}
+
+/// Return data in zlib format, compressed if zlib is available and stored in uncompressed blocks otherwise.
+auto zlibStream(std::string const& data) -> std::string
+{
+#ifdef REAKTPLOT_HAS_ZLIB
+    // Run-length matching only, which is several times faster than the default strategy and compresses the long runs
+    // of equal bytes in filtered images of plots almost as well
+    z_stream stream{};
+    if(deflateInit2(&stream, Z_BEST_SPEED, Z_DEFLATED, 15, 8, Z_RLE) != Z_OK)
+        throw std::runtime_error("Could not compress the PNG image data.");
+    std::string res(deflateBound(&stream, static_cast<uLong>(data.size())), '\0');
+    stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(data.data()));
+    stream.avail_in = static_cast<uInt>(data.size());
+    stream.next_out = reinterpret_cast<Bytef*>(&res[0]);
+    stream.avail_out = static_cast<uInt>(res.size());
+    auto const status = deflate(&stream, Z_FINISH);
+    res.resize(stream.total_out);
+    deflateEnd(&stream);
+    if(status != Z_STREAM_END)
+        throw std::runtime_error("Could not compress the PNG image data.");
+    return res;
+#else
+    std::string res = "\x78\x01"; // a zlib header for a stream without compression
+    std::uint32_t a = 1, b = 0;
+    for(std::size_t pos = 0; pos < data.size() || pos == 0; pos += 65535)
+    {
+        auto const len = std::min<std::size_t>(65535, data.size() - pos);
+        res += static_cast<char>(pos + len == data.size() ? 1 : 0); // the final block has its first bit set
+        res += static_cast<char>(len & 0xFF);
+        res += static_cast<char>(len >> 8);
+        res += static_cast<char>(~len & 0xFF);
+        res += static_cast<char>((~len >> 8) & 0xFF);
+        res.append(data, pos, len);
+        if(len == 0)
+            break;
+    }
+    for(auto c : data)
+    {
+        a = (a + static_cast<unsigned char>(c)) % 65521;
+        b = (b + a) % 65521;
+    }
+    append32(res, b << 16 | a);
+    return res;
+#endif
+}
+
+} // namespace ""
+
+PngCanvas::PngCanvas(double scale, Font const& font)
+: scale(scale), font(font)
+{}
+
+auto PngCanvas::begin(int width, int height) -> void
+{
+    auto const fullw = std::max(1, static_cast<int>(std::lround(width * scale)));
+    auto const fullh = std::max(1, static_cast<int>(std::lround(height * scale)));
+    w = vw > 0 ? std::max(1, std::min(vw, fullw - vx)) : fullw;
+    h = vh > 0 ? std::max(1, std::min(vh, fullh - vy)) : fullh;
+    rgba.assign(static_cast<std::size_t>(w) * h * 4, 0);
+    coverage.assign((static_cast<std::size_t>(w) + 2) * h, 0.0f);
+    rowfirst.assign(h, std::numeric_limits<int>::max());
+    rowlast.assign(h, -1);
+    unclip();
+}
+
+auto PngCanvas::end() -> void
+{
+    unclip();
+}
+
+auto PngCanvas::viewport(int x, int y, int width, int height) -> void
+{
+    auto const whole = width <= 0 || height <= 0;
+    vx = whole ? 0 : std::max(x, 0);
+    vy = whole ? 0 : std::max(y, 0);
+    vw = whole ? 0 : width;
+    vh = whole ? 0 : height;
+}
+
+auto PngCanvas::clip(Rect const& r) -> void
+{
+    clipx0 = std::clamp(static_cast<int>(std::floor(r.x * scale)) - vx, 0, w);
+    clipy0 = std::clamp(static_cast<int>(std::floor(r.y * scale)) - vy, 0, h);
+    clipx1 = std::clamp(static_cast<int>(std::ceil((r.x + r.width) * scale)) - vx, 0, w);
+    clipy1 = std::clamp(static_cast<int>(std::ceil((r.y + r.height) * scale)) - vy, 0, h);
+}
+
+auto PngCanvas::unclip() -> void
+{
+    clipx0 = clipy0 = 0;
+    clipx1 = w;
+    clipy1 = h;
+}
+
+auto PngCanvas::rect(Rect const& r, Color const& fill, Stroke const& stroke) -> void
+{
+    auto const p0 = pixel({ r.x, r.y }), p1 = pixel({ r.x + r.width, r.y + r.height });
+    std::vector<Point> const corners = { {p0.x, p0.y}, {p1.x, p0.y}, {p1.x, p1.y}, {p0.x, p1.y} };
+    if(!fill.none())
+        this->fill({ corners }, fill);
+    this->stroke({ corners }, true, stroke);
+}
+
+auto PngCanvas::polyline(std::vector<Point> const& points, Stroke const& stroke) -> void
+{
+    std::vector<Point> line(points.size());
+    std::transform(points.begin(), points.end(), line.begin(), [&](Point const& p) { return pixel(p); });
+    this->stroke({ line }, false, stroke);
+}
+
+auto PngCanvas::segments(std::vector<Point> const& points, Stroke const& stroke) -> void
+{
+    std::vector<std::vector<Point>> lines;
+    for(std::size_t i = 0; i + 1 < points.size(); i += 2)
+        lines.push_back({ pixel(points[i]), pixel(points[i + 1]) });
+    this->stroke(lines, false, stroke);
+}
+
+auto PngCanvas::polygons(std::vector<std::vector<Point>> const& polygons, Color const& fill, Stroke const& stroke) -> void
+{
+    auto shapes = polygons;
+    for(auto& shape : shapes)
+        for(auto& p : shape)
+            p = pixel(p);
+    if(!fill.none())
+        this->fill(shapes, fill);
+    // A stroke of the fill color only hides the seams between adjacent polygons in other formats, which are not
+    // produced here (all polygons drawn together are accumulated before blending), so it is skipped
+    auto const seams = stroke.color.r == fill.r && stroke.color.g == fill.g && stroke.color.b == fill.b && stroke.width < 1.0;
+    if(!seams)
+        this->stroke(shapes, true, stroke);
+}
+
+auto PngCanvas::circle(Point const& center, double radius, Color const& fill, Stroke const& stroke) -> void
+{
+    auto const shape = disk(pixel(center), radius * scale);
+    if(!fill.none())
+        this->fill({ shape }, fill);
+    this->stroke({ shape }, true, stroke);
+}
+
+auto PngCanvas::text(Point const& pos, std::string const& str, TextStyle const& style) -> void
+{
+    if(str.empty() || style.color.none())
+        return;
+
+    auto const size = style.size * scale;
+    auto const width = font.width(str, size);
+    auto const shift = style.anchor == Anchor::Start ? 0.0 : style.anchor == Anchor::Middle ? 0.5 * width : width;
+    auto const angle = style.angle * PI / 180.0;
+    auto const cosa = std::cos(angle), sina = std::sin(angle);
+    Point const origin = { pixel(pos).x - shift * cosa, pixel(pos).y - shift * sina };
+
+    if(style.angle != 0.0) // rotated text is filled directly from the outlines of its glyphs
+    {
+        std::vector<std::vector<Point>> shapes;
+        double pen = 0.0;
+        for(auto c : decode(str))
+        {
+            auto const& glyph = font.glyph(font.index(c));
+            for(auto const& contour : glyph.contours)
+            {
+                shapes.emplace_back();
+                for(auto const& p : contour)
+                {
+                    auto const ox = pen + p.x * size, oy = -p.y * size;
+                    shapes.back().push_back({ origin.x + ox * cosa - oy * sina, origin.y + ox * sina + oy * cosa });
+                }
+            }
+            pen += glyph.advance * size;
+        }
+        return fill(shapes, style.color);
+    }
+
+    // Horizontal text is drawn with glyph masks rasterized once per glyph, size, and sub-pixel position
+    struct Key
+    {
+        Glyph const* glyph; int size, subpixel;
+        auto operator==(Key const& other) const -> bool { return glyph == other.glyph && size == other.size && subpixel == other.subpixel; }
+    };
+    struct Hash
+    {
+        auto operator()(Key const& key) const -> std::size_t { return std::hash<void const*>()(key.glyph) ^ (static_cast<std::size_t>(key.size) << 3 | key.subpixel) * 0x9E3779B97F4A7C15ull; }
+    };
+    thread_local std::unordered_map<Key, Mask, Hash> cache;
+
+    auto const sizeq = static_cast<int>(std::lround(size * 8)); // sizes are distinguished to 1/8 of a pixel
+    auto pen = origin.x;
+    auto const baseline = static_cast<int>(std::lround(origin.y));
+    for(auto c : decode(str))
+    {
+        auto const& glyph = font.glyph(font.index(c));
+        auto const penfloor = std::floor(pen);
+        auto const subpixel = std::min(SUBPIXELS - 1, static_cast<int>((pen - penfloor) * SUBPIXELS));
+        Key const key = { &glyph, sizeq, subpixel };
+        auto it = cache.find(key);
+        if(it == cache.end())
+        {
+            if(cache.size() >= MAX_CACHED_MASKS)
+                cache.clear();
+            Mask mask;
+            auto const s = sizeq / 8.0;
+            auto const dx = static_cast<double>(subpixel) / SUBPIXELS;
+            auto xmin = std::numeric_limits<double>::infinity(), xmax = -xmin, ymin = xmin, ymax = -xmin;
+            for(auto const& contour : glyph.contours)
+                for(auto const& p : contour)
+                {
+                    xmin = std::min(xmin, dx + p.x * s); xmax = std::max(xmax, dx + p.x * s);
+                    ymin = std::min(ymin, -p.y * s); ymax = std::max(ymax, -p.y * s);
+                }
+            if(!glyph.contours.empty())
+            {
+                mask.left = static_cast<int>(std::floor(xmin));
+                mask.top = static_cast<int>(std::floor(ymin));
+                mask.width = static_cast<int>(std::ceil(xmax)) - mask.left;
+                mask.height = static_cast<int>(std::ceil(ymax)) - mask.top;
+                std::vector<float> acc(static_cast<std::size_t>(mask.width + 2) * mask.height, 0.0f);
+                Cells cells{ acc.data(), static_cast<std::size_t>(mask.width + 2), mask.width, mask.height };
+                for(auto const& contour : glyph.contours)
+                    for(std::size_t i = 0, n = contour.size(); i < n; ++i)
+                    {
+                        auto const& p = contour[i];
+                        auto const& q = contour[(i + 1) % n];
+                        accumulateClipped({ dx + p.x * s - mask.left, -p.y * s - mask.top }, { dx + q.x * s - mask.left, -q.y * s - mask.top }, cells);
+                    }
+                mask.values.resize(static_cast<std::size_t>(mask.width) * mask.height);
+                for(int y = 0; y < mask.height; ++y)
+                {
+                    float sum = 0.0f;
+                    for(int x = 0; x < mask.width; ++x)
+                    {
+                        sum += acc[static_cast<std::size_t>(y) * (mask.width + 2) + x];
+                        mask.values[static_cast<std::size_t>(y) * mask.width + x] = static_cast<unsigned char>(std::lround(std::min(1.0f, std::abs(sum)) * 255));
+                    }
+                }
+            }
+            it = cache.emplace(key, std::move(mask)).first;
+        }
+        auto const& mask = it->second;
+        auto const left = static_cast<int>(penfloor) + mask.left, top = baseline + mask.top;
+        for(int y = std::max(0, clipy0 - top); y < mask.height && top + y < clipy1; ++y)
+            for(int x = std::max(0, clipx0 - left); x < mask.width && left + x < clipx1; ++x)
+                if(auto const value = mask.values[static_cast<std::size_t>(y) * mask.width + x])
+                    blend(left + x, top + y, style.color, value / 255.0);
+        pen += glyph.advance * size;
+    }
+}
+
+auto PngCanvas::textWidth(std::string const& str, TextStyle const& style) -> double
+{
+    return font.width(str, style.size);
+}
+
+auto PngCanvas::fill(std::vector<std::vector<Point>> const& polygons, Color const& color) -> void
+{
+    if(color.none())
+        return;
+
+    // The bounding box of the polygons within the clip region
+    auto xmin = std::numeric_limits<double>::infinity(), xmax = -xmin, ymin = xmin, ymax = -xmin;
+    for(auto const& polygon : polygons)
+        for(auto const& p : polygon)
+        {
+            if(!std::isfinite(p.x) || !std::isfinite(p.y))
+                return;
+            xmin = std::min(xmin, p.x); xmax = std::max(xmax, p.x);
+            ymin = std::min(ymin, p.y); ymax = std::max(ymax, p.y);
+        }
+    auto const x0 = std::max(clipx0, static_cast<int>(std::floor(std::max(xmin, -1.0))));
+    auto const y0 = std::max(clipy0, static_cast<int>(std::floor(std::max(ymin, -1.0))));
+    auto const x1 = std::min(clipx1, static_cast<int>(std::ceil(std::min(xmax, w + 1.0))));
+    auto const y1 = std::min(clipy1, static_cast<int>(std::ceil(std::min(ymax, h + 1.0))));
+    if(x1 <= x0 || y1 <= y0)
+        return;
+
+    // The coverage buffer is kept zeroed between shapes, by resetting the values changed in each row while scanning it
+    auto const stride = static_cast<std::size_t>(w) + 2;
+    Cells cells{ coverage.data() + y0 * stride + x0, stride, x1 - x0, y1 - y0, rowfirst.data() + y0, rowlast.data() + y0 };
+    for(auto const& polygon : polygons)
+        for(std::size_t i = 0, n = polygon.size(); i < n && n > 2; ++i)
+        {
+            auto const& p = polygon[i];
+            auto const& q = polygon[(i + 1) % n];
+            accumulateClipped({ p.x - x0, p.y - y0 }, { q.x - x0, q.y - y0 }, cells);
+        }
+
+    for(int y = 0; y < cells.height; ++y)
+    {
+        auto& first = cells.first[y];
+        auto& last = cells.last[y];
+        auto* row = cells.values + y * stride;
+        float sum = 0.0f;
+        for(auto x = first; x <= last; ++x)
+        {
+            sum += row[x];
+            row[x] = 0.0f;
+            auto const c = std::min(1.0f, std::abs(sum));
+            if(c < 1.0f / 512 || x >= cells.width)
+                continue;
+            if(c < 1.0f || color.a < 1.0)
+            {
+                blend(x0 + x, y0 + y, color, c);
+                continue;
+            }
+            auto end = x + 1; // the pixels after this one fully covered too (those without edges) are filled at once
+            while(end < cells.width && end <= last && row[end] == 0.0f)
+                ++end;
+            auto* p = rgba.data() + (static_cast<std::size_t>(y0 + y) * w + x0 + x) * 4;
+            for(auto k = x; k < end; ++k, p += 4)
+            {
+                p[0] = color.r;
+                p[1] = color.g;
+                p[2] = color.b;
+                p[3] = 255;
+            }
+            x = end - 1;
+        }
+        first = std::numeric_limits<int>::max();
+        last = -1;
+    }
+}
+
+auto PngCanvas::stroke(std::vector<std::vector<Point>> const& lines, bool closed, Stroke const& stroke) -> void
+{
+    if(stroke.none())
+        return;
+
+    auto const hw = 0.5 * stroke.width * scale;
+    auto pattern = stroke.dashes;
+    for(auto& length : pattern)
+        length *= scale;
+
+    std::vector<std::vector<Point>> shapes;
+    auto const add = [&](std::vector<Point> shape)
+    {
+        if(area(shape) < 0.0) // all pieces have the same orientation so that their overlaps do not cancel out
+            std::reverse(shape.begin(), shape.end());
+        shapes.push_back(std::move(shape));
+    };
+
+    for(auto line : lines)
+    {
+        if(closed && !line.empty())
+            line.push_back(line.front());
+        for(auto const& piece : pattern.empty() ? std::vector<std::vector<Point>>{ line } : dashed(line, pattern))
+        {
+            for(std::size_t i = 0; i + 1 < piece.size(); ++i)
+            {
+                auto const& a = piece[i];
+                auto const& b = piece[i + 1];
+                auto const len = std::hypot(b.x - a.x, b.y - a.y);
+                if(!(len > 0.0))
+                    continue;
+                auto const nx = -(b.y - a.y) / len * hw, ny = (b.x - a.x) / len * hw;
+                add({ { a.x + nx, a.y + ny }, { b.x + nx, b.y + ny }, { b.x - nx, b.y - ny }, { a.x - nx, a.y - ny } });
+                auto const last = i + 2 == piece.size();
+                if(hw > 0.75 && (!last || (closed && pattern.empty()))) // round joins, needed only for lines thicker than about a pixel
+                    add(disk(b, hw));
+            }
+        }
+    }
+
+    fill(shapes, stroke.color);
+}
+
+auto PngCanvas::blend(int x, int y, Color const& color, double coverage) -> void
+{
+    auto* p = rgba.data() + (static_cast<std::size_t>(y) * w + x) * 4;
+    auto const sa = color.a * coverage;
+    if(sa >= 1.0) // the most common case, inside an opaque shape
+    {
+        p[0] = color.r;
+        p[1] = color.g;
+        p[2] = color.b;
+        p[3] = 255;
+        return;
+    }
+    if(p[3] == 255) // the second most common case, drawing over an opaque pixel
+    {
+        p[0] = static_cast<unsigned char>(p[0] + (color.r - p[0]) * sa + 0.5);
+        p[1] = static_cast<unsigned char>(p[1] + (color.g - p[1]) * sa + 0.5);
+        p[2] = static_cast<unsigned char>(p[2] + (color.b - p[2]) * sa + 0.5);
+        return;
+    }
+    auto const da = p[3] / 255.0 * (1.0 - sa);
+    auto const oa = sa + da;
+    if(oa <= 0.0)
+        return;
+    p[0] = static_cast<unsigned char>((color.r * sa + p[0] * da) / oa + 0.5);
+    p[1] = static_cast<unsigned char>((color.g * sa + p[1] * da) / oa + 0.5);
+    p[2] = static_cast<unsigned char>((color.b * sa + p[2] * da) / oa + 0.5);
+    p[3] = static_cast<unsigned char>(oa * 255 + 0.5);
+}
+
+auto encodePng(std::ostream& out, std::vector<unsigned char> const& rgba, int width, int height) -> void
+{
+    if(width <= 0 || height <= 0 || rgba.size() != static_cast<std::size_t>(width) * height * 4)
+        throw std::invalid_argument("The size of the image does not match its number of pixels.");
+
+    auto opaque = true; // opaque images are written without the opacity channel, as kaleido does
+    for(std::size_t i = 3; i < rgba.size() && opaque; i += 4)
+        opaque = rgba[i] == 255;
+    auto const channels = opaque ? 3 : 4;
+
+    // The rows of the image, each with the filter (the difference to the pixel above or on the left) that compresses better
+    std::size_t const rowsize = static_cast<std::size_t>(width) * channels;
+    std::string raw((rowsize + 1) * height, '\0');
+    for(int y = 0; y < height; ++y)
+    {
+        auto const* src = rgba.data() + static_cast<std::size_t>(y) * width * 4;
+        auto const* above = y > 0 ? src - static_cast<std::size_t>(width) * 4 : nullptr;
+        auto* dst = reinterpret_cast<unsigned char*>(&raw[(rowsize + 1) * y]);
+        if(opaque) filterRow<3>(src, above, width, dst);
+        else filterRow<4>(src, above, width, dst);
+    }
+
+    std::string header;
+    append32(header, static_cast<std::uint32_t>(width));
+    append32(header, static_cast<std::uint32_t>(height));
+    header += '\x08'; // 8 bits per channel
+    header += static_cast<char>(opaque ? 2 : 6); // RGB or RGBA
+    header += std::string(3, '\0'); // deflate compression, adaptive filtering, no interlacing
+
+    out.write("\x89PNG\r\n\x1a\n", 8);
+    writeChunk(out, "IHDR", header);
+    writeChunk(out, "IDAT", zlibStream(raw));
+    writeChunk(out, "IEND", "");
+}
+
+struct PngWriter::Data
+{
+    /// The output stream of the PNG image.
+    std::ostream& out;
+
+    /// The width and height of the image (in pixels).
+    int width = 0, height = 0;
+
+    /// The number of rows written so far.
+    int rows = 0;
+
+    /// The last row written (used to filter the next one).
+    std::vector<unsigned char> above;
+
+    /// The compressed data not yet written in an IDAT chunk (or the uncompressed data not yet stored in a block without zlib).
+    std::string pending;
+
+#ifdef REAKTPLOT_HAS_ZLIB
+    /// The state of the compression of the image data.
+    z_stream stream{};
+#else
+    /// The sums of the Adler-32 checksum of the image data.
+    std::uint32_t a = 1, b = 0;
+#endif
+
+    /// Whether the image has been finished.
+    bool closed = false;
+
+    Data(std::ostream& out, int width, int height)
+    : out(out), width(width), height(height)
+    {}
+
+    /// Add filtered rows to the image data and write an IDAT chunk once enough compressed data is pending.
+    auto add(std::string const& raw, bool last) -> void
+    {
+#ifdef REAKTPLOT_HAS_ZLIB
+        char buffer[1 << 16];
+        stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(raw.data()));
+        stream.avail_in = static_cast<uInt>(raw.size());
+        int status = Z_OK;
+        do
+        {
+            stream.next_out = reinterpret_cast<Bytef*>(buffer);
+            stream.avail_out = sizeof(buffer);
+            status = deflate(&stream, last ? Z_FINISH : Z_NO_FLUSH);
+            if(status == Z_STREAM_ERROR)
+                throw std::runtime_error("Could not compress the PNG image data.");
+            pending.append(buffer, sizeof(buffer) - stream.avail_out);
+        }
+        while(stream.avail_in > 0 || (last && status != Z_STREAM_END));
+        if(pending.size() >= IDAT_SIZE || (last && !pending.empty()))
+        {
+            writeChunk(out, "IDAT", pending);
+            pending.clear();
+        }
+#else
+        for(auto c : raw)
+        {
+            a = (a + static_cast<unsigned char>(c)) % 65521;
+            b = (b + a) % 65521;
+        }
+        std::string blocks;
+        if(rows == 0)
+            blocks = "\x78\x01"; // a zlib header for a stream without compression
+        pending += raw;
+        std::size_t pos = 0;
+        for(; pending.size() - pos >= 65535 || (last && pos <= pending.size()); pos += 65535)
+        {
+            auto const len = std::min<std::size_t>(65535, pending.size() - pos);
+            auto const final = last && pos + len == pending.size();
+            blocks += static_cast<char>(final ? 1 : 0); // the final block has its first bit set
+            blocks += static_cast<char>(len & 0xFF);
+            blocks += static_cast<char>(len >> 8);
+            blocks += static_cast<char>(~len & 0xFF);
+            blocks += static_cast<char>((~len >> 8) & 0xFF);
+            blocks.append(pending, pos, len);
+            if(final)
+            {
+                append32(blocks, b << 16 | a);
+                pos = pending.size();
+                break;
+            }
+        }
+        pending.erase(0, pos);
+        if(!blocks.empty())
+            writeChunk(out, "IDAT", blocks);
+#endif
+    }
+};
+
+PngWriter::PngWriter(std::ostream& out, int width, int height)
+: data(new Data(out, width, height))
+{
+    if(width <= 0 || height <= 0)
+        throw std::invalid_argument("The size of the image must be positive.");
+
+#ifdef REAKTPLOT_HAS_ZLIB
+    if(deflateInit2(&data->stream, Z_BEST_SPEED, Z_DEFLATED, 15, 8, Z_RLE) != Z_OK) // as in @ref zlibStream
+        throw std::runtime_error("Could not compress the PNG image data.");
+#endif
+
+    std::string header;
+    append32(header, static_cast<std::uint32_t>(width));
+    append32(header, static_cast<std::uint32_t>(height));
+    header += '\x08'; // 8 bits per channel
+    header += '\x06'; // RGBA
+    header += std::string(3, '\0'); // deflate compression, adaptive filtering, no interlacing
+
+    out.write("\x89PNG\r\n\x1a\n", 8);
+    writeChunk(out, "IHDR", header);
+}
+
+PngWriter::~PngWriter()
+{
+#ifdef REAKTPLOT_HAS_ZLIB
+    deflateEnd(&data->stream);
+#endif
+}
+
+auto PngWriter::write(unsigned char const* rgba, int rows) -> void
+{
+    auto& d = *data;
+    if(d.closed || rows < 0 || d.rows + rows > d.height)
+        throw std::runtime_error("Could not write more rows than the PNG image has.");
+
+    auto const rowsize = static_cast<std::size_t>(d.width) * 4;
+    std::string raw((rowsize + 1) * rows, '\0');
+    for(int y = 0; y < rows; ++y)
+    {
+        auto const* src = rgba + rowsize * y;
+        auto const* above = y > 0 ? src - rowsize : d.rows > 0 ? d.above.data() : nullptr;
+        filterRow<4>(src, above, d.width, reinterpret_cast<unsigned char*>(&raw[(rowsize + 1) * y]));
+    }
+    if(rows > 0)
+        d.above.assign(rgba + rowsize * (rows - 1), rgba + rowsize * rows);
+
+    d.add(raw, d.rows + rows == d.height);
+    d.rows += rows;
+}
+
+auto PngWriter::close() -> void
+{
+    auto& d = *data;
+    if(d.closed)
+        return;
+    if(d.rows != d.height)
+        throw std::runtime_error("Could not finish the PNG image because only " + std::to_string(d.rows) + " of its " + std::to_string(d.height) + " rows were written.");
+    d.closed = true;
+    writeChunk(d.out, "IEND", "");
+}
+
+auto writePng(std::ostream& out, FigureSpecs const& specs, int width, int height, double scale) -> void
+{
+    thread_local std::map<double, PngCanvas> canvases; // reused, so that their buffers are not allocated again for every image
+    auto& canvas = canvases.try_emplace(scale, scale).first->second;
+    render(canvas, specs, width, height);
+    encodePng(out, canvas.pixels(), canvas.width(), canvas.height());
+}
+
+auto savePng(std::string const& file, FigureSpecs const& specs, int width, int height, double scale) -> void
+{
+    std::ofstream out(file, std::ios::binary);
+    if(!out)
+        throw std::runtime_error("Could not open file " + file + " for writing.");
+    writePng(out, specs, width, height, scale);
+}
+
+} // namespace reaktplot
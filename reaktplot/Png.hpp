@@ -0,0 +1,160 @@
+// reaktplot - a modern C++ scientific plotting library powered by plotly
+// https://github.com/reaktplot/reaktplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2022-2023 Allan Leal
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+// NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#pragma once
+
+// C++ includes
+#include <memory>
+#include <ostream>
+#include <string>
+#include <vector>
+
+// reaktplot includes
+#include <reaktplot/Canvas.hpp>
+#include <reaktplot/Font.hpp>
+#include <reaktplot/Macros.hpp>
+#include <reaktplot/Specs.hpp>
+
+namespace reaktplot {
+
+/// Used to draw figures on an image with anti-aliasing, for output in PNG format.
+/// Shapes are filled one scanline at a time with the exact area of each pixel they cover (so that adjacent polygons
+/// drawn together show no seams), and text is drawn with the glyphs of a TrueType font (see @ref defaultFont), which
+/// are rasterized once per size and kept in a cache shared by all canvases in the same thread.
+class RKP_EXPORT PngCanvas : public Canvas
+{
+public:
+    /// Construct a PngCanvas object.
+    /// @param scale The number of pixels in the image per px in the figure (e.g., 2 for high-resolution images).
+    /// @param font The font used to draw text.
+    explicit PngCanvas(double scale = 1.0, Font const& font = defaultFont());
+
+    auto begin(int width, int height) -> void override;
+    auto end() -> void override;
+    auto clip(Rect const& rect) -> void override;
+    auto unclip() -> void override;
+    auto rect(Rect const& rect, Color const& fill, Stroke const& stroke = {}) -> void override;
+    auto polyline(std::vector<Point> const& points, Stroke const& stroke) -> void override;
+    auto segments(std::vector<Point> const& points, Stroke const& stroke) -> void override;
+    auto polygons(std::vector<std::vector<Point>> const& polygons, Color const& fill, Stroke const& stroke = {}) -> void override;
+    auto circle(Point const& center, double radius, Color const& fill, Stroke const& stroke = {}) -> void override;
+    auto text(Point const& pos, std::string const& str, TextStyle const& style) -> void override;
+    auto textWidth(std::string const& str, TextStyle const& style) -> double override;
+
+    /// Restrict the image of the next figures to a rectangle of the whole image (in pixels), so that figures too large to
+    /// fit in memory at once can be drawn as tiles of the whole image, each with the exact pixels it has in it.
+    /// The rectangle is cut at the right and bottom sides of the whole image, and a zero width or height means the whole image.
+    auto viewport(int x, int y, int width, int height) -> void;
+
+    /// Return the width of the image (in pixels).
+    auto width() const -> int { return w; }
+
+    /// Return the height of the image (in pixels).
+    auto height() const -> int { return h; }
+
+    /// Return the pixels of the image, row by row from the top, with 4 bytes each (red, green, blue, and opacity).
+    auto pixels() const -> std::vector<unsigned char> const& { return rgba; }
+
+private:
+    /// Return a point in the figure (in px) in pixels of the image.
+    auto pixel(Point const& p) const -> Point { return { p.x * scale - vx, p.y * scale - vy }; }
+
+    /// Fill polygons given in pixels of the image with the nonzero rule.
+    auto fill(std::vector<std::vector<Point>> const& polygons, Color const& color) -> void;
+
+    /// Draw the outline of lines given in pixels of the image.
+    auto stroke(std::vector<std::vector<Point>> const& lines, bool closed, Stroke const& stroke) -> void;
+
+    /// Blend a color into a pixel with given coverage (from 0 to 1).
+    auto blend(int x, int y, Color const& color, double coverage) -> void;
+
+    /// The number of pixels in the image per px in the figure.
+    double scale = 1.0;
+
+    /// The font used to draw text.
+    Font font;
+
+    /// The width and height of the image (in pixels).
+    int w = 0, h = 0;
+
+    /// The position of the image in the whole image, and its requested width and height (in pixels, see @ref viewport).
+    int vx = 0, vy = 0, vw = 0, vh = 0;
+
+    /// The pixels of the image.
+    std::vector<unsigned char> rgba;
+
+    /// The region of the image where drawing is allowed (in pixels).
+    int clipx0 = 0, clipy0 = 0, clipx1 = 0, clipy1 = 0;
+
+    /// The buffer in which the area covered by shapes is accumulated (reused between shapes).
+    std::vector<float> coverage;
+
+    /// The first and last values changed in each row of the coverage buffer.
+    std::vector<int> rowfirst, rowlast;
+};
+
+/// Write an image in PNG format.
+/// The image is compressed with zlib if reaktplot was built with it, and stored uncompressed otherwise.
+/// @param out The output stream.
+/// @param rgba The pixels of the image, row by row from the top, with 4 bytes each (red, green, blue, and opacity).
+/// @param width The width of the image (in pixels).
+/// @param height The height of the image (in pixels).
+RKP_EXPORT auto encodePng(std::ostream& out, std::vector<unsigned char> const& rgba, int width, int height) -> void;
+
+/// Used to write an image in PNG format a few rows at a time, for images too large to be kept in memory at once.
+/// The rows are filtered and compressed as they are written (with zlib if reaktplot was built with it, and stored
+/// uncompressed otherwise), and the compressed data is written to the output stream in chunks of bounded size. Since
+/// it is not known in advance whether all pixels are opaque, the image is always written with the opacity channel.
+class RKP_EXPORT PngWriter
+{
+public:
+    /// Construct a PngWriter object that writes an image with given size (in pixels) to an output stream.
+    PngWriter(std::ostream& out, int width, int height);
+
+    /// Destroy this PngWriter object.
+    ~PngWriter();
+
+    /// Write the next rows of the image, from the top, with 4 bytes per pixel (red, green, blue, and opacity).
+    auto write(unsigned char const* rgba, int rows) -> void;
+
+    /// Finish the image, throwing an error if not all of its rows have been written.
+    auto close() -> void;
+
+private:
+    struct Data;
+
+    /// The implementation details of the writer.
+    std::unique_ptr<Data> data;
+};
+
+/// Write a figure in PNG format, rendered natively in C++ (see @ref render).
+/// @param out The output stream.
+/// @param specs The specification of the figure.
+/// @param width The width of the figure (in px).
+/// @param height The height of the figure (in px).
+/// @param scale The number of pixels in the image per px in the figure.
+RKP_EXPORT auto writePng(std::ostream& out, FigureSpecs const& specs, int width, int height, double scale = 1.0) -> void;
+
+/// Save a figure to a PNG file, rendered natively in C++ (see @ref writePng).
+RKP_EXPORT auto savePng(std::string const& file, FigureSpecs const& specs, int width, int height, double scale = 1.0) -> void;
+
+} // namespace reaktplot
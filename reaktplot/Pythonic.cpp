@@ -22,10 +22,21 @@
 
 #include "Pythonic.hpp"
 
+// C++ includes
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
 // pybind11 includes
 #include <pybind11/embed.h>
+#include <pybind11/numpy.h>
+#include <pybind11/stl.h>
 namespace py = pybind11;
 
+// reaktplot includes
+#include <reaktplot/Queue.hpp>
+
 namespace reaktplot {
 namespace {
 
@@ -46,16 +57,309 @@ auto rkp() -> py::module
     return py::globals()["rkp"];
 }
 
+/// Import plotly and optionally start the image renderer, printing any Python error (requires the GIL).
+auto warm(bool renderer) -> void
+{
+    try { rkp().attr("warmup")(renderer); }
+    catch(py::error_already_set& e) { e.restore(); PyErr_Print(); } // errors show up again when plotly is actually used
+}
+
+/// The flag indicating the Python interpreter has been finalized and Python objects can no longer be released.
+std::atomic<bool> finalized = false;
+
+/// Used to start the embedded Python interpreter once and to execute Python operations in the calling thread
+/// or in a dedicated interpreter thread fed by a lock-free queue.
+class Interpreter
+{
+private:
+    /// The mutex protecting the start of the interpreter and of the helper and interpreter threads.
+    std::mutex mutex;
+
+    /// The flag indicating the interpreter has been started.
+    bool started = false;
+
+    /// The state of the thread that started the interpreter in the calling thread, saved when releasing the GIL.
+    PyThreadState* state = nullptr;
+
+    /// The helper thread importing plotly during a warm-up.
+    std::thread helper;
+
+    /// The queue of operations to be executed in the interpreter thread.
+    Queue<std::function<void()>> queue{1024};
+
+    /// The interpreter thread, if enabled.
+    std::thread worker;
+
+    /// The id of the interpreter thread, published once it is started so that it can be read without the mutex (default if not enabled).
+    std::atomic<std::thread::id> workerid = std::thread::id();
+
+    /// The flag indicating the interpreter thread should stop once the queue is empty.
+    std::atomic<bool> stopping = false;
+
+    /// The flag indicating the interpreter thread is waiting for operations.
+    std::atomic<bool> sleeping = false;
+
+    /// The mutex used with the condition variable below to put the interpreter thread to sleep.
+    std::mutex sleepmutex;
+
+    /// The condition variable used to wake up the interpreter thread.
+    std::condition_variable wakeup;
+
+    /// Initialize the Python interpreter in the calling thread and release the GIL, unless already initialized (requires the mutex).
+    /// @return The state of the calling thread to be restored before finalizing the interpreter, or null if not initialized here.
+    auto initialize() -> PyThreadState*
+    {
+        started = true;
+        if(Py_IsInitialized()) // e.g., reaktplot is used from a Python extension module
+            return nullptr;
+        py::initialize_interpreter();
+        return PyEval_SaveThread(); // release the GIL so that any thread can acquire it
+    }
+
+    /// Execute the operations in the queue until asked to stop.
+    auto run() -> void
+    {
+        PyThreadState* owned = nullptr;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if(!started)
+                owned = initialize();
+        }
+        std::function<void()> fn;
+        while(true)
+        {
+            if(!queue.empty())
+            {
+                py::gil_scoped_acquire gil; // own the GIL while draining the queue
+                while(queue.pop(fn))
+                {
+                    try { fn(); } catch(...) {} // operations report their errors through futures
+                    fn = nullptr; // release any Python object captured by the operation while holding the GIL
+                }
+                continue;
+            }
+            if(stopping.load())
+                break;
+            std::unique_lock<std::mutex> lock(sleepmutex);
+            sleeping.store(true);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            wakeup.wait(lock, [&] { return !queue.empty() || stopping.load(); });
+            sleeping.store(false);
+        }
+        if(owned)
+        {
+            PyEval_RestoreThread(owned);
+            py::finalize_interpreter();
+            finalized = true;
+        }
+    }
+
+public:
+    /// Destroy this Interpreter object by stopping its threads and finalizing the Python interpreter.
+    ~Interpreter()
+    {
+        if(helper.joinable())
+            helper.join();
+        if(worker.joinable())
+        {
+            {
+                std::lock_guard<std::mutex> lock(sleepmutex); // so that the interpreter thread is either waiting or yet to check the flag
+                stopping = true;
+            }
+            wakeup.notify_one();
+            worker.join();
+        }
+        if(state)
+        {
+            PyEval_RestoreThread(state);
+            py::finalize_interpreter();
+        }
+        finalized = true;
+    }
+
+    /// Start the Python interpreter in the calling thread, if not started yet.
+    auto start() -> void
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if(!started)
+            state = initialize();
+    }
+
+    /// Start the interpreter thread, if not started yet.
+    auto enableThread() -> void
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if(!worker.joinable())
+        {
+            worker = std::thread([this] { run(); });
+            workerid.store(worker.get_id());
+        }
+    }
+
+    /// Import plotly (and optionally start the image renderer) on a helper thread or in the interpreter thread.
+    auto warmup(bool renderer) -> void
+    {
+        if(workerid.load() != std::thread::id())
+            return post([renderer] { warm(renderer); });
+        start();
+        std::lock_guard<std::mutex> lock(mutex);
+        if(!helper.joinable())
+            helper = std::thread([renderer] { py::gil_scoped_acquire gil; warm(renderer); });
+    }
+
+    /// Execute a function with the GIL held in the interpreter thread (without waiting for it) or in the calling thread.
+    auto post(std::function<void()> fn) -> void
+    {
+        if(auto const id = workerid.load(); id != std::thread::id() && id != std::this_thread::get_id())
+        {
+            while(!queue.push(fn))
+                std::this_thread::yield(); // the queue is full: wait for the interpreter thread to catch up
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if(sleeping.load())
+            {
+                std::lock_guard<std::mutex> lock(sleepmutex);
+                wakeup.notify_one();
+            }
+            return;
+        }
+        start();
+        py::gil_scoped_acquire gil;
+        fn();
+    }
+};
+
+/// Return the embedded Python interpreter.
+auto interpreter() -> Interpreter&
+{
+    static Interpreter instance;
+    return instance;
+}
+
+/// Return a Python list with given numbers.
+auto pylist(double const* values, std::size_t size) -> py::list
+{
+    py::list list(size);
+    for(std::size_t i = 0; i < size; ++i)
+        list[i] = py::float_(values[i]);
+    return list;
+}
+
+/// Return true if numpy can be imported (requires the GIL).
+auto hasNumpy() -> bool
+{
+    static bool const available = []
+    {
+        try { py::module::import("numpy"); return true; }
+        catch(py::error_already_set&) { return false; }
+    }();
+    return available;
+}
+
+/// Return a Python object with the numbers in a column (requires the GIL).
+/// The numbers are handed over as a read-only numpy array that views the column's memory and keeps it alive, so that
+/// no copy is made while holding the GIL. Without numpy, the numbers are copied into a Python list (of lists for a matrix).
+auto pynumbers(Column const& col) -> py::object
+{
+    using Numbers = std::shared_ptr<std::vector<double> const>;
+
+    if(hasNumpy())
+    {
+        auto owner = new Numbers(col.shared());
+        py::capsule base(owner, [](void* ptr) { delete static_cast<Numbers*>(ptr); });
+        std::vector<py::ssize_t> shape = { py::ssize_t(col.rows()) };
+        if(col.isMatrix())
+            shape.push_back(py::ssize_t(col.cols()));
+        py::array_t<double> array(shape, (*owner)->data(), base);
+        array.attr("flags").attr("writeable") = false;
+        return array;
+    }
+
+    if(!col.isMatrix())
+        return pylist(col.numbers().data(), col.size());
+    py::list rows(col.rows());
+    for(std::size_t i = 0; i < col.rows(); ++i)
+        rows[i] = pylist(col.numbers().data() + i * col.cols(), col.cols());
+    return rows;
+}
+
 } // namespace ""
 
+auto warmup(bool renderer) -> void
+{
+    interpreter().warmup(renderer);
+}
+
+auto useInterpreterThread() -> void
+{
+    interpreter().enableThread();
+}
+
 Pythonic::Pythonic()
 {
-    static py::scoped_interpreter guard;
+    execute([] {});
+}
+
+auto Pythonic::post(std::function<void()> fn) -> void
+{
+    interpreter().post(std::move(fn));
+}
+
+auto Pythonic::share(py::object obj) -> std::shared_ptr<py::object>
+{
+    return std::shared_ptr<py::object>(new py::object(std::move(obj)), [](py::object* ptr)
+    {
+        if(finalized)
+        {
+            ptr->release(); // the Python object cannot be released anymore
+            delete ptr;
+            return;
+        }
+        Pythonic::post([ptr] { delete ptr; });
+    });
+}
+
+auto Pythonic::pyobject(Value const& value) -> py::object
+{
+    return std::visit([](auto const& val) -> py::object
+    {
+        using T = std::decay_t<decltype(val)>;
+        if constexpr(std::is_same_v<T, std::nullptr_t>)
+            return py::none();
+        else if constexpr(std::is_same_v<T, bool>)
+            return py::bool_(val);
+        else if constexpr(std::is_same_v<T, long long>)
+            return py::int_(val);
+        else if constexpr(std::is_same_v<T, double>)
+            return py::float_(val);
+        else if constexpr(std::is_same_v<T, std::string>)
+            return py::str(val);
+        else if constexpr(std::is_same_v<T, Column>)
+            return val.isStrings() ? py::cast(val.strings()) : pynumbers(val);
+        else if constexpr(std::is_same_v<T, List>)
+        {
+            py::list list(val.size());
+            for(std::size_t i = 0; i < val.size(); ++i)
+                list[i] = pyobject(val[i]);
+            return list;
+        }
+        else
+        {
+            py::dict dict;
+            for(auto const& [key, item] : val)
+                dict[py::str(key)] = pyobject(item);
+            return dict;
+        }
+    }, value.variant());
 }
 
 auto Pythonic::createFigure() -> py::object
 {
-    return rkp().attr("Figure")();
+    return rkp().attr("Figure")(true); // fast mode: the C++ API already constrains the inputs, so plotly validation is skipped
+}
+
+auto Pythonic::createRenderSession(std::size_t maxrenders, double maxmemory) -> py::object
+{
+    return rkp().attr("RenderSession")(maxrenders, maxmemory);
 }
 
 auto Pythonic::createFontSpecs() -> py::object
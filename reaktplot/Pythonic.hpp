@@ -22,25 +22,91 @@
 
 #pragma once
 
+// C++ includes
+#include <cstddef>
+#include <functional>
+#include <future>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
 // pybind11 includes
 #include <pybind11/pybind11.h>
 namespace py = pybind11;
 
 // reaktplot includes
 #include <reaktplot/Macros.hpp>
+#include <reaktplot/Value.hpp>
 
 namespace reaktplot {
 
-/// Used to get Python objects from the plotly python library.
+/// Start the Python interpreter and import plotly on a helper thread so that the first figure finds everything ready.
+/// This function returns immediately. The Python interpreter is started in the calling thread (or in the interpreter
+/// thread, see @ref useInterpreterThread), the GIL is released, and plotly is imported on the helper thread while the
+/// caller carries on, ideally with a long computation that produces figures at the end.
+/// @param renderer Whether the image renderer (kaleido) should also be started with a dummy render.
+RKP_EXPORT auto warmup(bool renderer = false) -> void;
+
+/// Execute all Python operations of reaktplot in a single dedicated interpreter thread.
+/// Once enabled, every Python operation (e.g., in Figure::save) is sent as a command through a lock-free queue to the
+/// interpreter thread, which owns the GIL while executing it, so that figures can be built and saved from any number
+/// of threads (e.g., OpenMP or TBB workers). Call this before the first figure is saved or shown so that the
+/// interpreter is also started and finalized in that thread. The interpreter thread stays alive until the program exits.
+RKP_EXPORT auto useInterpreterThread() -> void;
+
+/// Used to get Python objects from the plotly python library and to execute Python operations.
+/// All functions that manipulate Python objects require the GIL and must be called within @ref Pythonic::execute
+/// or @ref Pythonic::submit, which take care of starting the interpreter and acquiring the GIL.
 class RKP_EXPORT Pythonic
 {
 public:
     /// Construct a default Pythonic object initializing the Python interpreter once.
     Pythonic();
 
-    /// Create a Python object of type `reaktplot.Figure`.
+    /// Execute a function using the Python interpreter and wait for its result.
+    /// The function runs with the GIL held, in the calling thread or in the interpreter thread if enabled with
+    /// @ref useInterpreterThread. Python errors are rethrown as `std::runtime_error`.
+    template<typename Fn>
+    static auto execute(Fn&& fn) -> std::invoke_result_t<Fn>
+    {
+        return submit(std::forward<Fn>(fn)).get();
+    }
+
+    /// Submit a function to be executed using the Python interpreter and return a future to its result.
+    /// The function runs with the GIL held, in the interpreter thread if enabled with @ref useInterpreterThread,
+    /// otherwise in the calling thread before this function returns. Python errors are rethrown as `std::runtime_error`.
+    template<typename Fn>
+    static auto submit(Fn&& fn) -> std::future<std::invoke_result_t<Fn>>
+    {
+        using R = std::invoke_result_t<Fn>;
+        auto task = std::make_shared<std::packaged_task<R()>>([fn = std::forward<Fn>(fn)]() mutable -> R
+        {
+            try { return fn(); }
+            catch(py::error_already_set const& e) { throw std::runtime_error(e.what()); }
+        });
+        auto result = task->get_future();
+        post([task] { (*task)(); });
+        return result;
+    }
+
+    /// Post a function to be executed using the Python interpreter with the GIL held, without waiting for it.
+    /// If the interpreter thread is not enabled, the function is executed in the calling thread right away.
+    static auto post(std::function<void()> fn) -> void;
+
+    /// Return a shared handle to a Python object that can be safely copied and destroyed from any thread.
+    /// The Python object is released with the GIL held once the last handle is destroyed.
+    static auto share(py::object obj) -> std::shared_ptr<py::object>;
+
+    /// Convert a value into a Python object (e.g., a Dict into a `dict`, a Column into a `list`).
+    static auto pyobject(Value const& value) -> py::object;
+
+    /// Create a Python object of type `reaktplot.Figure` in fast mode (traces and layout kept as plain dicts).
     static auto createFigure() -> py::object;
 
+    /// Create a Python object of type `reaktplot.RenderSession` with the given recycling limits (zero means no limit).
+    static auto createRenderSession(std::size_t maxrenders, double maxmemory) -> py::object;
+
     /// Create a Python object of type `reaktplot.FontSpecs`.
     static auto createFontSpecs() -> py::object;
 
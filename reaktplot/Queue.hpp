@@ -0,0 +1,149 @@
+// reaktplot - a modern C++ scientific plotting library powered by plotly
+// https://github.com/reaktplot/reaktplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2022-2023 Allan Leal
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+// NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#pragma once
+
+// C++ includes
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+namespace reaktplot {
+
+/// Used as a bounded lock-free queue with multiple producers and multiple consumers.
+/// Each cell in the ring buffer carries a sequence number telling whether it is ready to be written by a producer
+/// or read by a consumer, so that producers and consumers only contend on the atomic head and tail positions.
+/// The capacity is rounded up to a power of two.
+template<typename T>
+class Queue
+{
+private:
+    /// Used to store an item in the ring buffer with its sequence number.
+    struct Cell
+    {
+        /// The sequence number of the cell.
+        std::atomic<std::size_t> sequence;
+
+        /// The item stored in the cell.
+        T item;
+    };
+
+    /// The size of a cache line used to keep the head and tail positions apart.
+    static constexpr std::size_t CACHE_LINE_SIZE = 64;
+
+    /// The cells of the ring buffer.
+    std::unique_ptr<Cell[]> cells;
+
+    /// The mask used to wrap a position into the ring buffer (its capacity minus one).
+    std::size_t const mask;
+
+    /// The position where the next item is pushed.
+    alignas(CACHE_LINE_SIZE) std::atomic<std::size_t> tail{0};
+
+    /// The position where the next item is popped.
+    alignas(CACHE_LINE_SIZE) std::atomic<std::size_t> head{0};
+
+    /// Return the smallest power of two not less than a given number.
+    static auto ceil2(std::size_t n) -> std::size_t
+    {
+        std::size_t result = 2;
+        while(result < n)
+            result <<= 1;
+        return result;
+    }
+
+public:
+    /// Construct a Queue object with given capacity.
+    explicit Queue(std::size_t capacity)
+    : cells(new Cell[ceil2(capacity)]), mask(ceil2(capacity) - 1)
+    {
+        for(std::size_t i = 0; i <= mask; ++i)
+            cells[i].sequence.store(i, std::memory_order_relaxed);
+    }
+
+    Queue(Queue const&) = delete;
+
+    auto operator=(Queue const&) -> Queue& = delete;
+
+    /// Return the maximum number of items in the queue.
+    auto capacity() const -> std::size_t { return mask + 1; }
+
+    /// Push an item into the queue, moving from it only if there was room (return false if the queue is full).
+    auto push(T& item) -> bool
+    {
+        auto pos = tail.load(std::memory_order_relaxed);
+        while(true)
+        {
+            auto& cell = cells[pos & mask];
+            auto const seq = cell.sequence.load(std::memory_order_acquire);
+            auto const diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos);
+            if(diff == 0)
+            {
+                if(tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                {
+                    cell.item = std::move(item);
+                    cell.sequence.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            }
+            else if(diff < 0)
+                return false;
+            else
+                pos = tail.load(std::memory_order_relaxed);
+        }
+    }
+
+    /// Pop an item from the queue (return false if the queue is empty).
+    auto pop(T& item) -> bool
+    {
+        auto pos = head.load(std::memory_order_relaxed);
+        while(true)
+        {
+            auto& cell = cells[pos & mask];
+            auto const seq = cell.sequence.load(std::memory_order_acquire);
+            auto const diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos + 1);
+            if(diff == 0)
+            {
+                if(head.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                {
+                    item = std::move(cell.item);
+                    cell.item = T();
+                    cell.sequence.store(pos + mask + 1, std::memory_order_release);
+                    return true;
+                }
+            }
+            else if(diff < 0)
+                return false;
+            else
+                pos = head.load(std::memory_order_relaxed);
+        }
+    }
+
+    /// Return true if the queue has no items (the answer may be outdated as soon as it is returned).
+    auto empty() const -> bool
+    {
+        return head.load(std::memory_order_acquire) == tail.load(std::memory_order_acquire);
+    }
+};
+
+} // namespace reaktplot
@@ -0,0 +1,223 @@
+// reaktplot - a modern C++ scientific plotting library powered by plotly
+// https://github.com/reaktplot/reaktplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2022-2023 Allan Leal
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+// NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include "RenderCache.hpp"
+
+// C++ includes
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <iomanip>
+#include <ostream>
+#include <random>
+#include <stdexcept>
+#include <streambuf>
+#include <string>
+#include <utility>
+
+// reaktplot includes
+#include <reaktplot/Html.hpp>
+#include <reaktplot/Json.hpp>
+#include <reaktplot/Renderer.hpp>
+
+#if !defined(REAKTPLOT_VERSION)
+#define REAKTPLOT_VERSION "unknown"
+#endif
+
+namespace reaktplot {
+namespace {
+
+namespace fs = std::filesystem;
+
+/// The render cache used by Figure::save, if any.
+std::atomic<RenderCache*> currentcache = nullptr;
+
+/// Used to compute a 128-bit hash of all characters written to an output stream, without storing them.
+/// The hash is made of two 64-bit hashes computed in a single pass: FNV-1a and a multiply-xorshift hash.
+class HashBuffer : public std::streambuf
+{
+public:
+    /// Return the hash of the characters written so far as 32 hexadecimal digits.
+    auto digest() const -> std::string
+    {
+        char hex[33];
+        std::snprintf(hex, sizeof(hex), "%016llx%016llx", static_cast<unsigned long long>(a), static_cast<unsigned long long>(b));
+        return hex;
+    }
+
+protected:
+    auto overflow(int_type c) -> int_type override
+    {
+        if(!traits_type::eq_int_type(c, traits_type::eof()))
+            update(traits_type::to_char_type(c));
+        return traits_type::not_eof(c);
+    }
+
+    auto xsputn(char const* s, std::streamsize n) -> std::streamsize override
+    {
+        for(std::streamsize i = 0; i < n; ++i)
+            update(s[i]);
+        return n;
+    }
+
+private:
+    /// Add a character to the hash.
+    auto update(char c) -> void
+    {
+        auto const byte = static_cast<std::uint64_t>(static_cast<unsigned char>(c));
+        a = (a ^ byte) * 0x100000001b3ull;
+        b = (b ^ byte) * 0xff51afd7ed558ccdull;
+        b ^= b >> 32;
+    }
+
+    /// The FNV-1a hash.
+    std::uint64_t a = 0xcbf29ce484222325ull;
+
+    /// The multiply-xorshift hash.
+    std::uint64_t b = 0x9e3779b97f4a7c15ull;
+};
+
+/// Return the extension of a file (e.g., `png`).
+auto extension(std::string const& file) -> std::string
+{
+    return file.substr(file.find_last_of('.') + 1);
+}
+
+/// Return the key of a figure saved to a file (see RenderCache::key), with the HTML options used for HTML files.
+auto hashed(FigureSpecs const& specs, std::string const& file, int width, int height, double scale, HtmlOptions const& html) -> std::string
+{
+    auto const ext = extension(file);
+
+    HashBuffer buffer;
+    std::ostream out(&buffer);
+    out << std::setprecision(17);
+    out << REAKTPLOT_VERSION << '\n' << ext << '\n' << width << '\n' << height << '\n' << scale << '\n' << int(backend()) << '\n';
+
+    if(ext == "html")
+        out << int(html.mode) << '\n' << html.plotlyjs << '\n' << html.json.typedarrays << html.json.theme << '\n';
+
+    writeJson(out, specs);
+    out.flush();
+
+    return buffer.digest() + "." + ext;
+}
+
+} // namespace ""
+
+RenderCache::RenderCache(std::string directory, RenderCacheOptions const& options)
+: dir(std::move(directory)), options(options)
+{
+    std::error_code ec;
+    fs::create_directories(dir, ec);
+    if(ec)
+        throw std::runtime_error("Could not create render cache directory " + dir + ": " + ec.message());
+}
+
+auto RenderCache::key(FigureSpecs const& specs, std::string const& file, int width, int height, double scale) const -> std::string
+{
+    return hashed(specs, file, width, height, scale, htmlOptions());
+}
+
+auto RenderCache::key(FigureSpecs const& specs, std::string const& file, int width, int height, HtmlOptions const& html) const -> std::string
+{
+    return hashed(specs, file, width, height, 1.0, html);
+}
+
+auto RenderCache::fetch(std::string const& key, std::string const& file) -> bool
+{
+    std::error_code ec;
+
+    if(options.hardlinks)
+        fs::remove(file, ec); // the file may be a hard link to a cached file, which must not be overwritten in place
+
+    auto const cached = fs::path(dir) / key;
+
+    auto found = fs::exists(cached, ec);
+
+    if(found && options.hardlinks)
+        fs::create_hard_link(cached, file, ec);
+
+    if(found && (!options.hardlinks || ec))
+    {
+        ec.clear();
+        fs::copy_file(cached, file, fs::copy_options::overwrite_existing, ec);
+    }
+
+    found = found && !ec;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    ++(found ? counts.hits : counts.misses);
+    return found;
+}
+
+auto RenderCache::store(std::string const& key, std::string const& file) -> void
+{
+    // The file is first copied to a temporary file in the cache directory, which is then renamed, so that other threads
+    // and processes never see a partially written file. Errors are ignored, since the figure was saved anyway.
+    thread_local std::mt19937_64 random(std::random_device{}());
+    auto const cached = fs::path(dir) / key;
+    auto const temporary = fs::path(dir) / (key + ".tmp" + std::to_string(random()));
+
+    std::error_code ec;
+
+    if(options.hardlinks)
+        fs::create_hard_link(file, temporary, ec);
+
+    if(!options.hardlinks || ec)
+    {
+        ec.clear();
+        fs::copy_file(file, temporary, fs::copy_options::overwrite_existing, ec);
+    }
+
+    if(!ec)
+        fs::rename(temporary, cached, ec);
+
+    if(ec)
+        fs::remove(temporary, ec);
+}
+
+auto RenderCache::clear() -> void
+{
+    std::error_code ec;
+    for(auto const& entry : fs::directory_iterator(dir, ec))
+        if(entry.is_regular_file(ec))
+            fs::remove(entry.path(), ec);
+}
+
+auto RenderCache::stats() const -> RenderCacheStats
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return counts;
+}
+
+auto setRenderCache(RenderCache* cache) -> void
+{
+    currentcache = cache;
+}
+
+auto renderCache() -> RenderCache*
+{
+    return currentcache;
+}
+
+} // namespace reaktplot
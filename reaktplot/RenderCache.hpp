@@ -0,0 +1,109 @@
+// reaktplot - a modern C++ scientific plotting library powered by plotly
+// https://github.com/reaktplot/reaktplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2022-2023 Allan Leal
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+// NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#pragma once
+
+// C++ includes
+#include <cstddef>
+#include <mutex>
+#include <string>
+
+// reaktplot includes
+#include <reaktplot/Html.hpp>
+#include <reaktplot/Macros.hpp>
+#include <reaktplot/Specs.hpp>
+
+namespace reaktplot {
+
+/// The options of a RenderCache.
+struct RenderCacheOptions
+{
+    /// Whether cached files are hard-linked instead of copied to the saved files (falling back to a copy if not possible).
+    /// Hard links save time and disk space, but a saved file then shares its contents with the cache, so it must not be
+    /// modified in place by other programs (Figure::save removes it before saving the figure to it again).
+    bool hardlinks = false;
+};
+
+/// The numbers of files found and not found in a RenderCache.
+struct RenderCacheStats
+{
+    /// The number of saved files copied from the cache instead of being rendered.
+    std::size_t hits = 0;
+
+    /// The number of saved files not found in the cache, and thus rendered.
+    std::size_t misses = 0;
+};
+
+/// Used to skip rendering figures identical to ones already saved, by keeping the saved files in a directory on disk.
+/// Each file is cached under a key made of a hash of the figure in plotly's JSON format, the extension of the file,
+/// the size and scale of the figure, the backend (and HTML options for HTML files), and the version of reaktplot.
+/// When Figure::save finds a cached file with the same key, it copies (or hard-links) it instead of rendering the
+/// figure. The cache directory can be shared by many runs and processes, since files are added to it atomically.
+class RKP_EXPORT RenderCache
+{
+public:
+    /// Construct a RenderCache object keeping its files in a given directory, created if needed.
+    explicit RenderCache(std::string directory, RenderCacheOptions const& options = {});
+
+    /// Return the key under which a figure saved to a file with given size and scale is cached.
+    auto key(FigureSpecs const& specs, std::string const& file, int width, int height, double scale) const -> std::string;
+
+    /// Return the key under which a figure saved to an HTML file with given size and HTML options is cached.
+    auto key(FigureSpecs const& specs, std::string const& file, int width, int height, HtmlOptions const& html) const -> std::string;
+
+    /// Save the cached file with given key to a file, if any, and return true if found (counted as a hit or a miss).
+    auto fetch(std::string const& key, std::string const& file) -> bool;
+
+    /// Add a saved file to the cache under a given key.
+    auto store(std::string const& key, std::string const& file) -> void;
+
+    /// Remove all files from the cache.
+    auto clear() -> void;
+
+    /// Return the numbers of files found and not found in the cache so far.
+    auto stats() const -> RenderCacheStats;
+
+    /// Return the directory where the cached files are kept.
+    auto directory() const -> std::string const& { return dir; }
+
+private:
+    /// The directory where the cached files are kept.
+    std::string dir;
+
+    /// The options of the cache.
+    RenderCacheOptions options;
+
+    /// The mutex protecting the statistics below.
+    mutable std::mutex mutex;
+
+    /// The numbers of files found and not found in the cache so far.
+    RenderCacheStats counts;
+};
+
+/// Set the render cache used by Figure::save, or disable caching with a null pointer (the default).
+/// The render cache must outlive all figures saved with it, including those still being saved by a render pool.
+RKP_EXPORT auto setRenderCache(RenderCache* cache) -> void;
+
+/// Return the render cache used by Figure::save, or null if caching is disabled.
+RKP_EXPORT auto renderCache() -> RenderCache*;
+
+} // namespace reaktplot
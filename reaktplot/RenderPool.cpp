@@ -0,0 +1,375 @@
+// reaktplot - a modern C++ scientific plotting library powered by plotly
+// https://github.com/reaktplot/reaktplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2022-2023 Allan Leal
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+// NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include "RenderPool.hpp"
+
+// C++ includes
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <condition_variable>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <spawn.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include <unistd.h>
+extern char** environ;
+#endif
+
+// reaktplot includes
+#include <reaktplot/Json.hpp>
+
+namespace reaktplot {
+namespace {
+
+/// The render pool used by Figure::save, if any.
+std::atomic<RenderPool*> currentpool = nullptr;
+
+/// A figure to be saved by a worker process.
+struct Job
+{
+    /// The position of the figure in the order the figures were saved.
+    std::size_t seq = 0;
+
+    /// The name of the file of the figure.
+    std::string file;
+
+    /// The line sent to the worker process (the figure and its file, size, and scale in JSON format).
+    std::string line;
+
+    /// The function called once the figure is saved.
+    RenderPool::Callback callback;
+};
+
+/// A figure saved by a worker process whose callback has not been called yet.
+struct Done
+{
+    /// The name of the file of the figure.
+    std::string file;
+
+    /// The function called once the figure is saved.
+    RenderPool::Callback callback;
+
+    /// The error that occurred while saving the figure, if any.
+    std::exception_ptr error;
+};
+
+/// Used to start a worker process and to exchange lines with it through a socket connected to its standard input and output.
+class Worker
+{
+public:
+    /// Construct a Worker object starting a worker process.
+    Worker(std::vector<std::string> const& command)
+    {
+#if defined(_WIN32)
+        throw std::runtime_error("Could not start render worker: worker processes are only supported on POSIX systems.");
+#else
+        int fds[2];
+        if(socketpair(AF_UNIX, SOCK_STREAM, 0, fds) != 0)
+            throw std::runtime_error("Could not create socket for render worker: " + std::string(std::strerror(errno)));
+        fcntl(fds[0], F_SETFD, FD_CLOEXEC); // not inherited by other processes (e.g., other workers), which would keep this worker alive
+        fcntl(fds[1], F_SETFD, FD_CLOEXEC);
+        std::vector<char*> argv;
+        for(auto const& arg : command)
+            argv.push_back(const_cast<char*>(arg.c_str()));
+        argv.push_back(nullptr);
+        posix_spawn_file_actions_t actions;
+        posix_spawn_file_actions_init(&actions);
+        posix_spawn_file_actions_adddup2(&actions, fds[1], 0);
+        posix_spawn_file_actions_adddup2(&actions, fds[1], 1);
+        posix_spawn_file_actions_addclose(&actions, fds[0]);
+        posix_spawn_file_actions_addclose(&actions, fds[1]);
+        auto const status = posix_spawnp(&pid, argv[0], &actions, nullptr, argv.data(), environ);
+        posix_spawn_file_actions_destroy(&actions);
+        close(fds[1]);
+        if(status != 0)
+        {
+            close(fds[0]);
+            throw std::runtime_error("Could not start render worker " + command[0] + ": " + std::strerror(status));
+        }
+        fd = fds[0];
+#endif
+    }
+
+    /// Destroy this Worker object by closing its socket, which makes the worker process exit, and waiting for it.
+    ~Worker()
+    {
+#if !defined(_WIN32)
+        close(fd);
+        waitpid(pid, nullptr, 0);
+#endif
+    }
+
+    /// Send a line to the worker process and return the line it sends back, or false if the worker process exited.
+    auto exchange(std::string const& line, std::string& reply) -> bool
+    {
+#if !defined(_WIN32)
+        for(std::size_t sent = 0; sent < line.size();)
+        {
+            auto const n = send(fd, line.data() + sent, line.size() - sent, MSG_NOSIGNAL);
+            if(n < 0 && errno == EINTR)
+                continue;
+            if(n <= 0)
+                return false;
+            sent += n;
+        }
+        reply.clear();
+        char c;
+        while(true)
+        {
+            auto const n = recv(fd, &c, 1, 0);
+            if(n < 0 && errno == EINTR)
+                continue;
+            if(n <= 0)
+                return false;
+            if(c == '\n')
+                return true;
+            reply += c;
+        }
+#else
+        return false;
+#endif
+    }
+
+private:
+#if !defined(_WIN32)
+    /// The id of the worker process.
+    pid_t pid = 0;
+#endif
+
+    /// The socket connected to the standard input and output of the worker process.
+    int fd = -1;
+};
+
+/// Return the command that starts a worker process.
+auto workerCommand(RenderPoolOptions const& options) -> std::vector<std::string>
+{
+    auto python = options.python;
+    if(python.empty())
+        if(auto const env = std::getenv("REAKTPLOT_PYTHON"))
+            python = env;
+    if(python.empty())
+        python = "python3";
+    return { python, "-m", "reaktplot.RenderWorker", std::to_string(options.session.maxRenders), std::to_string(options.session.maxMemory) };
+}
+
+} // namespace
+
+struct RenderPool::Data
+{
+    /// The command that starts a worker process.
+    std::vector<std::string> command;
+
+    /// The maximum number of figures waiting or being rendered.
+    std::size_t capacity = 0;
+
+    /// The threads feeding the worker processes, one per worker process.
+    std::vector<std::thread> threads;
+
+    /// The mutex protecting the members below.
+    std::mutex mutex;
+
+    /// The condition variable notified when a figure is saved or the pool is stopping.
+    std::condition_variable changed;
+
+    /// The figures waiting for a worker process.
+    std::deque<Job> jobs;
+
+    /// The figures saved by the worker processes whose callbacks have not been called yet, by position.
+    std::map<std::size_t, Done> done;
+
+    /// The number of figures saved with the pool.
+    std::size_t submitted = 0;
+
+    /// The number of figures whose callbacks have been called.
+    std::size_t delivered = 0;
+
+    /// The flag indicating a thread is calling callbacks.
+    bool delivering = false;
+
+    /// The flag indicating the threads should stop once there are no more figures waiting.
+    bool stopping = false;
+
+    /// The first error of a figure saved without a callback, to be rethrown to the caller.
+    std::exception_ptr error;
+
+    /// Save the figures waiting for a worker process with a worker process until the pool is stopping.
+    auto run(std::unique_ptr<Worker> worker) -> void
+    {
+        std::string reply;
+        while(true)
+        {
+            Job job;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                changed.wait(lock, [&] { return !jobs.empty() || stopping; });
+                if(jobs.empty())
+                    return;
+                job = std::move(jobs.front());
+                jobs.pop_front();
+            }
+            std::exception_ptr failure;
+            try
+            {
+                if(!worker)
+                    worker = std::make_unique<Worker>(command);
+                if(!worker->exchange(job.line, reply))
+                {
+                    worker.reset(); // started anew for the next figure
+                    throw std::runtime_error("Could not save figure to file " + job.file + ": the render worker exited unexpectedly.");
+                }
+                if(reply != "ok")
+                    throw std::runtime_error("Could not save figure to file " + job.file + ": " + reply.substr(reply.find(' ') + 1));
+            }
+            catch(...) { failure = std::current_exception(); }
+            finish(std::move(job), failure);
+        }
+    }
+
+    /// Register a figure as saved and call the callbacks of the figures saved so far, in order, if no other thread is doing so.
+    auto finish(Job job, std::exception_ptr failure) -> void
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        done[job.seq] = { std::move(job.file), std::move(job.callback), failure };
+        if(delivering)
+            return;
+        delivering = true;
+        for(auto it = done.find(delivered); it != done.end(); it = done.find(delivered))
+        {
+            auto item = std::move(it->second);
+            done.erase(it);
+            lock.unlock();
+            if(item.callback)
+            {
+                try { item.callback(item.file, item.error); }
+                catch(...) { item.error = std::current_exception(); item.callback = nullptr; }
+            }
+            lock.lock();
+            if(item.error && !item.callback && !error)
+                error = item.error;
+            ++delivered;
+            changed.notify_all();
+        }
+        delivering = false;
+    }
+
+    /// Rethrow the first error of a figure saved without a callback, if any (requires the mutex).
+    auto rethrow() -> void
+    {
+        if(error)
+            std::rethrow_exception(std::exchange(error, nullptr));
+    }
+};
+
+RenderPool::RenderPool(RenderPoolOptions const& options)
+: data(new Data)
+{
+    auto const workers = options.workers ? options.workers : std::max(std::thread::hardware_concurrency(), 1u);
+    data->command = workerCommand(options);
+    data->capacity = options.capacity ? options.capacity : 2 * workers;
+    std::vector<std::unique_ptr<Worker>> started;
+    for(std::size_t i = 0; i < workers; ++i)
+        started.push_back(std::make_unique<Worker>(data->command)); // errors in starting the workers are thrown here
+    for(auto& worker : started)
+        data->threads.emplace_back([this, worker = std::move(worker)]() mutable { data->run(std::move(worker)); });
+}
+
+RenderPool::~RenderPool()
+{
+    RenderPool* self = this;
+    currentpool.compare_exchange_strong(self, nullptr);
+    {
+        std::lock_guard<std::mutex> lock(data->mutex);
+        data->stopping = true;
+    }
+    data->changed.notify_all();
+    for(auto& thread : data->threads)
+        thread.join();
+}
+
+auto RenderPool::save(Figure const& figure, std::string const& file, int width, int height, double scale, Callback callback) -> void
+{
+    std::ostringstream out; // the figure is serialized here so that it can be changed once this function returns
+    {
+        JsonWriter writer(out);
+        writer.raw("{\"file\":");
+        writer.write(file);
+        writer.raw(",\"width\":");
+        writer.write(double(width));
+        writer.raw(",\"height\":");
+        writer.write(double(height));
+        writer.raw(",\"scale\":");
+        writer.write(scale);
+        writer.raw(",\"figure\":");
+    }
+    writeJson(out, figure.specs());
+    out << "}\n";
+    auto line = out.str();
+
+    std::unique_lock<std::mutex> lock(data->mutex);
+    data->rethrow();
+    data->changed.wait(lock, [&] { return data->submitted - data->delivered < data->capacity; });
+    data->jobs.push_back({ data->submitted++, file, std::move(line), std::move(callback) });
+    lock.unlock();
+    data->changed.notify_all();
+}
+
+auto RenderPool::wait() -> void
+{
+    std::unique_lock<std::mutex> lock(data->mutex);
+    data->changed.wait(lock, [&] { return data->delivered == data->submitted; });
+    data->rethrow();
+}
+
+auto RenderPool::workers() const -> std::size_t
+{
+    return data->threads.size();
+}
+
+auto RenderPool::pending() const -> std::size_t
+{
+    std::lock_guard<std::mutex> lock(data->mutex);
+    return data->submitted - data->delivered;
+}
+
+auto setRenderPool(RenderPool* pool) -> void
+{
+    currentpool = pool;
+}
+
+auto renderPool() -> RenderPool*
+{
+    return currentpool;
+}
+
+} // namespace reaktplot
@@ -0,0 +1,102 @@
+// reaktplot - a modern C++ scientific plotting library powered by plotly
+// https://github.com/reaktplot/reaktplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2022-2023 Allan Leal
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+// NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#pragma once
+
+// C++ includes
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <string>
+
+// reaktplot includes
+#include <reaktplot/Figure.hpp>
+#include <reaktplot/Macros.hpp>
+#include <reaktplot/RenderSession.hpp>
+
+namespace reaktplot {
+
+/// The options of a RenderPool.
+struct RenderPoolOptions
+{
+    /// The number of worker processes (zero means one per hardware thread).
+    std::size_t workers = 0;
+
+    /// The number of figures that can be waiting or being rendered before RenderPool::save blocks (zero means twice the number of workers).
+    std::size_t capacity = 0;
+
+    /// The Python interpreter used to start the worker processes (empty means the environment variable `REAKTPLOT_PYTHON`, or else `python3`).
+    std::string python;
+
+    /// The options of the render session of each worker process.
+    RenderSessionOptions session;
+};
+
+/// Used to save figures in parallel with a pool of worker processes, each with its own Python interpreter and renderer.
+/// Rendering with plotly in the embedded Python interpreter is serial. A RenderPool starts worker processes running
+/// `python -m reaktplot.RenderWorker` and sends each saved figure, serialized to plotly's JSON format, to the next
+/// available worker. The figure is serialized before RenderPool::save returns, so it can be changed or destroyed
+/// right away. Once the given capacity of figures is waiting or being rendered, RenderPool::save blocks until a
+/// worker finishes (back-pressure). Completion callbacks are called in the order the figures were saved, one at a time,
+/// from the threads of the pool. Errors of figures saved without a callback are rethrown by the next call to
+/// RenderPool::save or RenderPool::wait. A worker that exits unexpectedly fails its figure and is started anew.
+/// Worker processes are only available on POSIX systems.
+class RKP_EXPORT RenderPool
+{
+public:
+    /// The function called once a figure is saved, with the name of its file and the error, if any, that occurred.
+    using Callback = std::function<void(std::string const& file, std::exception_ptr error)>;
+
+    /// Construct a RenderPool object starting its worker processes.
+    explicit RenderPool(RenderPoolOptions const& options = {});
+
+    /// Destroy this RenderPool object after waiting for all figures to be saved and stopping its worker processes.
+    ~RenderPool();
+
+    /// Save a figure to an image file with the next available worker process, blocking if the pool is at capacity.
+    auto save(Figure const& figure, std::string const& file, int width=DEFAULT_FIGURE_WIDTH, int height=DEFAULT_FIGURE_HEIGHT, double scale=DEFAULT_FIGURE_SCALE, Callback callback = {}) -> void;
+
+    /// Wait until all figures saved so far are saved and their callbacks called, rethrowing any error without a callback.
+    auto wait() -> void;
+
+    /// Return the number of worker processes.
+    auto workers() const -> std::size_t;
+
+    /// Return the number of figures waiting or being rendered.
+    auto pending() const -> std::size_t;
+
+private:
+    struct Data;
+
+    /// The implementation details of the pool, shared with its threads.
+    std::unique_ptr<Data> data;
+};
+
+/// Set the render pool used by Figure::save for the image files rendered by plotly (null to render them in this process).
+/// Figures are then saved asynchronously and errors are rethrown by the next Figure::save or RenderPool::wait.
+RKP_EXPORT auto setRenderPool(RenderPool* pool) -> void;
+
+/// Return the render pool used by Figure::save, or null if figures are rendered in this process.
+RKP_EXPORT auto renderPool() -> RenderPool*;
+
+} // namespace reaktplot
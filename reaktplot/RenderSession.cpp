@@ -0,0 +1,117 @@
+// reaktplot - a modern C++ scientific plotting library powered by plotly
+// https://github.com/reaktplot/reaktplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2022-2023 Allan Leal
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+// NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include "RenderSession.hpp"
+
+// reaktplot includes
+#include <reaktplot/Pythonic.hpp>
+
+namespace reaktplot {
+
+RenderSession::RenderSession(RenderSessionOptions const& options)
+{
+    session = Pythonic::execute([&] { return Pythonic::share(Pythonic::createRenderSession(options.maxRenders, options.maxMemory)); });
+}
+
+auto RenderSession::start() -> void
+{
+    Pythonic::execute([&] { session->attr("start")(); });
+}
+
+auto RenderSession::warmup() -> void
+{
+    Pythonic::execute([&] { session->attr("warmup")(); });
+}
+
+auto RenderSession::stop() -> void
+{
+    Pythonic::execute([&] { session->attr("stop")(); });
+}
+
+auto RenderSession::recycle() -> void
+{
+    Pythonic::execute([&] { session->attr("recycle")(); });
+}
+
+auto RenderSession::setOptions(RenderSessionOptions const& options) -> void
+{
+    Pythonic::execute([&] {
+        session->attr("maxrenders") = options.maxRenders;
+        session->attr("maxmemory") = options.maxMemory;
+    });
+}
+
+auto RenderSession::options() const -> RenderSessionOptions
+{
+    return Pythonic::execute([&] {
+        RenderSessionOptions options;
+        options.maxRenders = session->attr("maxrenders").cast<std::size_t>();
+        options.maxMemory = session->attr("maxmemory").cast<double>();
+        return options;
+    });
+}
+
+auto RenderSession::running() const -> bool
+{
+    return Pythonic::execute([&] { return session->attr("running").cast<bool>(); });
+}
+
+auto RenderSession::renders() const -> std::size_t
+{
+    return Pythonic::execute([&] { return session->attr("renders").cast<std::size_t>(); });
+}
+
+auto RenderSession::recycles() const -> std::size_t
+{
+    return Pythonic::execute([&] { return session->attr("recycles").cast<std::size_t>(); });
+}
+
+auto RenderSession::memory() const -> double
+{
+    return Pythonic::execute([&] { return session->attr("memory")().cast<double>(); });
+}
+
+auto RenderSession::save(py::object const& pyfig, std::string const& file, int width, int height, double scale) const -> void
+{
+    session->attr("save")(pyfig, file, width, height, scale);
+}
+
+auto RenderSession::save(py::object const& pyfig, std::vector<RenderTarget> const& targets) const -> void
+{
+    py::list outputs;
+    for(auto const& target : targets)
+        outputs.append(py::make_tuple(target.file, target.width, target.height, target.scale));
+    session->attr("saveAll")(pyfig, outputs);
+}
+
+auto RenderSession::image(py::object const& pyfig, std::string const& format, int width, int height, double scale) const -> std::string
+{
+    return session->attr("image")(pyfig, format, width, height, scale).cast<std::string>();
+}
+
+auto renderSession() -> RenderSession&
+{
+    static RenderSession session;
+    return session;
+}
+
+} // namespace reaktplot
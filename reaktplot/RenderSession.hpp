@@ -0,0 +1,133 @@
+// reaktplot - a modern C++ scientific plotting library powered by plotly
+// https://github.com/reaktplot/reaktplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2022-2023 Allan Leal
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+// NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#pragma once
+
+// C++ includes
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+// pybind11 includes
+#include <pybind11/pybind11.h>
+namespace py = pybind11;
+
+// reaktplot includes
+#include <reaktplot/Default.hpp>
+#include <reaktplot/Macros.hpp>
+
+namespace reaktplot {
+
+/// The options of a RenderSession that determine when its image renderer is recycled.
+struct RenderSessionOptions
+{
+    /// The number of renders after which the renderer is recycled (zero means never).
+    std::size_t maxRenders = 0;
+
+    /// The resident memory (in MB) of the renderer processes above which the renderer is recycled (zero means never).
+    double maxMemory = 0.0;
+};
+
+/// An image file to be saved in a batch (see Figure::saveAll), with the size and scale of the figure in it.
+struct RenderTarget
+{
+    /// Construct a RenderTarget object (e.g., `{"thumbnail.png", 160, 100}`).
+    RenderTarget(std::string file, int width = DEFAULT_FIGURE_WIDTH, int height = DEFAULT_FIGURE_HEIGHT, double scale = DEFAULT_FIGURE_SCALE)
+    : file(std::move(file)), width(width), height(height), scale(scale) {}
+
+    /// Construct a RenderTarget object from the name of its file.
+    RenderTarget(char const* file) : RenderTarget(std::string(file)) {}
+
+    /// The name of the file with extension `.png`, `.jpeg`, 'jpg', `.webp`, `.svg`, `.pdf`, `.eps`, `.html`, or `.json`.
+    std::string file;
+
+    /// The width of the figure (in px).
+    int width = DEFAULT_FIGURE_WIDTH;
+
+    /// The height of the figure (in px).
+    int height = DEFAULT_FIGURE_HEIGHT;
+
+    /// The scaling factor applied to the figure.
+    double scale = DEFAULT_FIGURE_SCALE;
+};
+
+/// Used to start the image renderer of plotly (kaleido) once and reuse it across all figures saved by plotly.
+/// The renderer is a headless browser whose memory keeps growing as figures are rendered. The session restarts it
+/// after a number of renders or once it uses too much memory, as set in RenderSessionOptions. Copies of a
+/// RenderSession object share the same session. All methods can be called from any thread.
+class RKP_EXPORT RenderSession
+{
+public:
+    /// Construct a RenderSession object without starting the renderer.
+    explicit RenderSession(RenderSessionOptions const& options = {});
+
+    /// Start the renderer, if not running yet.
+    auto start() -> void;
+
+    /// Start the renderer and render a tiny dummy figure so that the first actual figure does not pay for it.
+    auto warmup() -> void;
+
+    /// Stop the renderer, if running, releasing all of its memory.
+    auto stop() -> void;
+
+    /// Stop the renderer so that it is started anew on the next render.
+    auto recycle() -> void;
+
+    /// Set the options that determine when the renderer is recycled.
+    auto setOptions(RenderSessionOptions const& options) -> void;
+
+    /// Return the options that determine when the renderer is recycled.
+    auto options() const -> RenderSessionOptions;
+
+    /// Return true if the renderer is running.
+    auto running() const -> bool;
+
+    /// Return the number of renders since the renderer was last started.
+    auto renders() const -> std::size_t;
+
+    /// Return the number of times the renderer has been recycled.
+    auto recycles() const -> std::size_t;
+
+    /// Return the resident memory (in MB) used by the renderer processes (zero if unknown or not running).
+    auto memory() const -> double;
+
+    /// Save a Python object of type `reaktplot.Figure` to an image file with the renderer (requires the GIL).
+    auto save(py::object const& pyfig, std::string const& file, int width, int height, double scale) const -> void;
+
+    /// Save a Python object of type `reaktplot.Figure` to many image files with the renderer (requires the GIL).
+    /// The figure is brought up to date and serialized once, and all images are then produced from it in one batch.
+    auto save(py::object const& pyfig, std::vector<RenderTarget> const& targets) const -> void;
+
+    /// Return a Python object of type `reaktplot.Figure` rendered as the contents of an image file in given format (requires the GIL).
+    auto image(py::object const& pyfig, std::string const& format, int width, int height, double scale) const -> std::string;
+
+private:
+    /// The shared handle to the Python object of type `reaktplot.RenderSession`.
+    std::shared_ptr<py::object> session;
+};
+
+/// Return the render session used by Figure::save for the image files rendered by plotly.
+RKP_EXPORT auto renderSession() -> RenderSession&;
+
+} // namespace reaktplot
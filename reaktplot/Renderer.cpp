@@ -0,0 +1,1497 @@
+// reaktplot - a modern C++ scientific plotting library powered by plotly
+// https://github.com/reaktplot/reaktplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2022-2023 Allan Leal
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+// NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include "Renderer.hpp"
+
+// C++ includes
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+#include <map>
+#include <string>
+#include <utility>
+
+// reaktplot includes
+#include <reaktplot/Constants.hpp>
+#include <reaktplot/Json.hpp>
+
+namespace reaktplot {
+namespace {
+
+using Numbers = std::vector<double>;
+
+/// The not-a-number value used for missing data.
+const auto NaN = std::numeric_limits<double>::quiet_NaN();
+
+/// The number of milliseconds in a second, minute, hour, and day.
+const double SECOND = 1000.0, MINUTE = 60 * SECOND, HOUR = 60 * MINUTE, DAY = 24 * HOUR;
+
+/// The abbreviated names of the months.
+const char* const MONTHS[] = {"Jan", "Feb", "Mar", "Apr", "May", "Jun", "Jul", "Aug", "Sep", "Oct", "Nov", "Dec"};
+
+/// The backend of the session, or -1 if not yet set.
+std::atomic<int> sessionbackend = -1;
+
+//======================================================================================================================
+// UTILITIES TO READ THE FIGURE DICTIONARY
+//======================================================================================================================
+
+/// Return the value at a path of keys separated by dots (e.g., `title.font.size`), or null if not found.
+auto at(Dict const& dict, std::string const& path) -> Value const*
+{
+    Dict const* node = &dict;
+    for(std::size_t begin = 0;;)
+    {
+        auto const end = path.find('.', begin);
+        auto const* value = node->find(path.substr(begin, end == std::string::npos ? end : end - begin));
+        if(!value || end == std::string::npos)
+            return value;
+        if(!value->is<Dict>())
+            return nullptr;
+        node = &value->as<Dict>();
+        begin = end + 1;
+    }
+}
+
+/// Return the number at a path of keys, or a default value if not found.
+auto number(Dict const& dict, std::string const& path, double dflt) -> double
+{
+    auto const* value = at(dict, path);
+    if(value && value->is<double>()) return value->as<double>();
+    if(value && value->is<long long>()) return static_cast<double>(value->as<long long>());
+    return dflt;
+}
+
+/// Return the string at a path of keys, or a default value if not found.
+auto text(Dict const& dict, std::string const& path, std::string const& dflt) -> std::string
+{
+    auto const* value = at(dict, path);
+    return value && value->is<std::string>() ? value->as<std::string>() : dflt;
+}
+
+/// Return the boolean at a path of keys, or a default value if not found.
+auto boolean(Dict const& dict, std::string const& path, bool dflt) -> bool
+{
+    auto const* value = at(dict, path);
+    return value && value->is<bool>() ? value->as<bool>() : dflt;
+}
+
+/// Return the dictionary at a path of keys, or an empty one if not found.
+auto dict(Dict const& dict, std::string const& path) -> Dict
+{
+    auto const* value = at(dict, path);
+    return value && value->is<Dict>() ? value->as<Dict>() : Dict();
+}
+
+/// Return the color at a path of keys, or a default color if not found.
+auto colorAt(Dict const& dict, std::string const& path, Color const& dflt) -> Color
+{
+    auto const* value = at(dict, path);
+    return value && value->is<std::string>() ? color(value->as<std::string>()) : dflt;
+}
+
+/// Return a dictionary with the entries of another merged into it, recursively for nested dictionaries.
+auto merged(Dict const& base, Dict const& other) -> Dict
+{
+    Dict res = base;
+    for(auto const& [key, value] : other)
+    {
+        auto const* existing = res.find(key);
+        if(existing && existing->is<Dict>() && value.is<Dict>())
+            res.set(key, merged(existing->as<Dict>(), value.as<Dict>()));
+        else res.set(key, value);
+    }
+    return res;
+}
+
+/// Return the font at a path of keys, with missing properties taken from a default font.
+auto font(Dict const& dict, std::string const& path, TextStyle const& dflt) -> TextStyle
+{
+    TextStyle style = dflt;
+    style.family = text(dict, path + ".family", dflt.family);
+    style.size = number(dict, path + ".size", dflt.size);
+    style.color = colorAt(dict, path + ".color", dflt.color);
+    return style;
+}
+
+//======================================================================================================================
+// UTILITIES FOR NUMBERS AND DATES
+//======================================================================================================================
+
+/// Return a number formatted with given number of decimal places, using the minus sign as plotly does.
+auto format(double value, int decimals) -> std::string
+{
+    char chars[64];
+    std::snprintf(chars, sizeof(chars), "%.*f", std::max(decimals, 0), value);
+    std::string str = chars;
+    if(str.find_first_not_of("-0.") == std::string::npos) // e.g., -0.00
+        str.erase(0, str[0] == '-' ? 1 : 0);
+    if(!str.empty() && str[0] == '-')
+        str.replace(0, 1, "−");
+    return str;
+}
+
+/// Return the number of decimal places needed to show the multiples of a step.
+auto decimals(double step) -> int
+{
+    return std::max(0, static_cast<int>(-std::floor(std::log10(std::abs(step)) + 1e-9)));
+}
+
+/// Return the SI suffix used by plotly for a power of ten multiple of 3 (e.g., `k` for 3, `μ` for -6).
+auto suffix(int exponent) -> std::string
+{
+    switch(exponent)
+    {
+    case 15: return "P"; case 12: return "T"; case 9: return "B"; case 6: return "M"; case 3: return "k";
+    case -3: return "m"; case -6: return "μ"; case -9: return "n"; case -12: return "p"; case -15: return "f";
+    default: return "e" + std::to_string(exponent);
+    }
+}
+
+/// Return the exponent (a multiple of 3) used to label numbers of given magnitude with an SI suffix, or zero if none.
+auto siExponent(double magnitude) -> int
+{
+    if(!(magnitude > 0.0))
+        return 0;
+    auto const e = static_cast<int>(std::floor(std::log10(magnitude) + 1e-9));
+    if(e >= 4 || e <= -4)
+        return 3 * static_cast<int>(std::floor(e / 3.0));
+    return 0;
+}
+
+/// Return a number formatted as a tick label for ticks with given step and SI exponent.
+auto label(double value, double step, int exponent) -> std::string
+{
+    auto const scale = std::pow(10.0, exponent);
+    auto str = format(value / scale, decimals(step / scale));
+    if(str.find('.') != std::string::npos) // trailing zeros are not shown, as in plotly (e.g., 1 and 1.5 instead of 1.0 and 1.5)
+    {
+        str.erase(str.find_last_not_of('0') + 1);
+        if(str.back() == '.')
+            str.pop_back();
+    }
+    if(exponent != 0 && std::abs(value) > 0.5 * std::abs(step))
+        str += suffix(exponent);
+    return str;
+}
+
+/// Return the number of days since 1970-01-01 of a date in the proleptic Gregorian calendar.
+auto daysFromCivil(long long y, unsigned m, unsigned d) -> long long
+{
+    y -= m <= 2;
+    auto const era = (y >= 0 ? y : y - 399) / 400;
+    auto const yoe = static_cast<unsigned>(y - era * 400);
+    auto const doy = (153 * (m + (m > 2 ? -3 : 9)) + 2) / 5 + d - 1;
+    auto const doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    return era * 146097 + static_cast<long long>(doe) - 719468;
+}
+
+/// Return the year, month, and day of a date given as the number of days since 1970-01-01.
+auto civilFromDays(long long z, long long& y, unsigned& m, unsigned& d) -> void
+{
+    z += 719468;
+    auto const era = (z >= 0 ? z : z - 146096) / 146097;
+    auto const doe = static_cast<unsigned>(z - era * 146097);
+    auto const yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+    auto const doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+    auto const mp = (5 * doy + 2) / 153;
+    d = doy - (153 * mp + 2) / 5 + 1;
+    m = mp < 10 ? mp + 3 : mp - 9;
+    y = static_cast<long long>(yoe) + era * 400 + (m <= 2);
+}
+
+/// Parse a date such as `2020-01-31`, `2020-01-31 12:30`, or `2020-01-31T12:30:15.5` into milliseconds since 1970-01-01.
+auto parseDate(std::string const& str, double& ms) -> bool
+{
+    int y = 0, mo = 1, d = 1, h = 0, mi = 0;
+    double s = 0.0;
+    char sep = 0;
+    auto const n = std::sscanf(str.c_str(), "%d-%d-%d%c%d:%d:%lf", &y, &mo, &d, &sep, &h, &mi, &s);
+    if(n < 2 || mo < 1 || mo > 12 || d < 1 || d > 31 || str.size() < 7 || str[4] != '-')
+        return false;
+    if(n >= 4 && sep != ' ' && sep != 'T')
+        return false;
+    ms = daysFromCivil(y, mo, d) * DAY + h * HOUR + mi * MINUTE + s * SECOND;
+    return true;
+}
+
+/// Return a date given in milliseconds since 1970-01-01 formatted with `%Y`, `%b`, `%e`, `%H`, `%M`, and `%S` specifiers.
+auto formatDate(double ms, std::string const& fmt) -> std::string
+{
+    auto const days = static_cast<long long>(std::floor(ms / DAY));
+    auto const rest = static_cast<long long>(std::llround(ms - days * DAY)) / 1000;
+    long long y = 0;
+    unsigned m = 0, d = 0;
+    civilFromDays(days, y, m, d);
+    char chars[16];
+    std::string str;
+    for(std::size_t i = 0; i < fmt.size(); ++i)
+    {
+        if(fmt[i] != '%' || i + 1 == fmt.size()) { str += fmt[i]; continue; }
+        switch(fmt[++i])
+        {
+        case 'Y': str += std::to_string(y); break;
+        case 'b': str += MONTHS[m - 1]; break;
+        case 'e': str += std::to_string(d); break;
+        case 'H': std::snprintf(chars, sizeof(chars), "%02lld", rest / 3600); str += chars; break;
+        case 'M': std::snprintf(chars, sizeof(chars), "%02lld", rest / 60 % 60); str += chars; break;
+        case 'S': std::snprintf(chars, sizeof(chars), "%02lld", rest % 60); str += chars; break;
+        default: str += fmt[i];
+        }
+    }
+    return str;
+}
+
+/// Return the step between ticks rounded up to 1, 2, or 5 times a power of ten, as plotly does.
+auto niceStep(double rough) -> double
+{
+    if(!(rough > 0.0) || !std::isfinite(rough))
+        return 1.0;
+    auto const base = std::pow(10.0, std::floor(std::log10(rough)));
+    auto const r = rough / base;
+    return base * (r <= 2.0 ? 2.0 : r <= 5.0 ? 5.0 : 10.0);
+}
+
+//======================================================================================================================
+// COLORSCALES
+//======================================================================================================================
+
+/// Used to represent a colorscale as a list of colors at increasing positions from 0 to 1.
+using Colorscale = std::vector<std::pair<double, Color>>;
+
+/// The colorscales of plotly that can be given by name.
+auto colorscales() -> std::map<std::string, std::vector<std::pair<double, char const*>>> const&
+{
+    static std::map<std::string, std::vector<std::pair<double, char const*>>> const scales = {
+        {"greys", {{0, "rgb(0,0,0)"}, {1, "rgb(255,255,255)"}}},
+        {"ylgnbu", {{0, "rgb(8,29,88)"}, {0.125, "rgb(37,52,148)"}, {0.25, "rgb(34,94,168)"}, {0.375, "rgb(29,145,192)"}, {0.5, "rgb(65,182,196)"}, {0.625, "rgb(127,205,187)"}, {0.75, "rgb(199,233,180)"}, {0.875, "rgb(237,248,217)"}, {1, "rgb(255,255,217)"}}},
+        {"ylorrd", {{0, "rgb(128,0,38)"}, {0.125, "rgb(189,0,38)"}, {0.25, "rgb(227,26,28)"}, {0.375, "rgb(252,78,42)"}, {0.5, "rgb(253,141,60)"}, {0.625, "rgb(254,178,76)"}, {0.75, "rgb(254,217,118)"}, {0.875, "rgb(255,237,160)"}, {1, "rgb(255,255,204)"}}},
+        {"bluered", {{0, "rgb(0,0,255)"}, {1, "rgb(255,0,0)"}}},
+        {"rdbu", {{0, "rgb(5,10,172)"}, {0.35, "rgb(106,137,247)"}, {0.5, "rgb(190,190,190)"}, {0.6, "rgb(220,170,132)"}, {0.7, "rgb(230,145,90)"}, {1, "rgb(178,10,28)"}}},
+        {"reds", {{0, "rgb(220,220,220)"}, {0.2, "rgb(245,195,157)"}, {0.4, "rgb(245,160,105)"}, {1, "rgb(178,10,28)"}}},
+        {"blues", {{0, "rgb(5,10,172)"}, {0.35, "rgb(40,60,190)"}, {0.5, "rgb(70,100,245)"}, {0.6, "rgb(90,120,245)"}, {0.7, "rgb(106,137,247)"}, {1, "rgb(220,220,220)"}}},
+        {"picnic", {{0, "rgb(0,0,255)"}, {0.1, "rgb(51,153,255)"}, {0.2, "rgb(102,204,255)"}, {0.3, "rgb(153,204,255)"}, {0.4, "rgb(204,204,255)"}, {0.5, "rgb(255,255,255)"}, {0.6, "rgb(255,204,255)"}, {0.7, "rgb(255,153,255)"}, {0.8, "rgb(255,102,204)"}, {0.9, "rgb(255,102,102)"}, {1, "rgb(255,0,0)"}}},
+        {"rainbow", {{0, "rgb(150,0,90)"}, {0.125, "rgb(0,0,200)"}, {0.25, "rgb(0,25,255)"}, {0.375, "rgb(0,152,255)"}, {0.5, "rgb(44,255,150)"}, {0.625, "rgb(151,255,0)"}, {0.75, "rgb(255,234,0)"}, {0.875, "rgb(255,111,0)"}, {1, "rgb(255,0,0)"}}},
+        {"portland", {{0, "rgb(12,51,131)"}, {0.25, "rgb(10,136,186)"}, {0.5, "rgb(242,211,56)"}, {0.75, "rgb(242,143,56)"}, {1, "rgb(217,30,30)"}}},
+        {"jet", {{0, "rgb(0,0,131)"}, {0.125, "rgb(0,60,170)"}, {0.375, "rgb(5,255,255)"}, {0.625, "rgb(255,255,0)"}, {0.875, "rgb(250,0,0)"}, {1, "rgb(128,0,0)"}}},
+        {"hot", {{0, "rgb(0,0,0)"}, {0.3, "rgb(230,0,0)"}, {0.6, "rgb(255,210,0)"}, {1, "rgb(255,255,255)"}}},
+        {"blackbody", {{0, "rgb(0,0,0)"}, {0.2, "rgb(230,0,0)"}, {0.4, "rgb(230,210,0)"}, {0.7, "rgb(255,255,255)"}, {1, "rgb(160,200,255)"}}},
+        {"earth", {{0, "rgb(0,0,130)"}, {0.1, "rgb(0,180,180)"}, {0.2, "rgb(40,210,40)"}, {0.4, "rgb(230,230,50)"}, {0.6, "rgb(120,70,20)"}, {1, "rgb(255,255,255)"}}},
+        {"electric", {{0, "rgb(0,0,0)"}, {0.15, "rgb(30,0,100)"}, {0.4, "rgb(120,0,100)"}, {0.6, "rgb(160,90,0)"}, {0.8, "rgb(230,200,0)"}, {1, "rgb(255,250,220)"}}},
+        {"viridis", {{0, "#440154"}, {0.0627, "#48186a"}, {0.1255, "#472d7b"}, {0.1882, "#424086"}, {0.2510, "#3b528b"}, {0.3137, "#33638d"}, {0.3765, "#2c728e"}, {0.4392, "#26828e"}, {0.5020, "#21918c"}, {0.5647, "#1fa088"}, {0.6275, "#28ae80"}, {0.6902, "#3fbc73"}, {0.7529, "#5ec962"}, {0.8157, "#84d44b"}, {0.8784, "#addc30"}, {0.9412, "#d8e219"}, {1, "#fde725"}}},
+    };
+    return scales;
+}
+
+/// Return the colorscale of a trace, given by name or as a list of positions and colors (plotly's default is RdBu).
+auto colorscale(Dict const& trace) -> Colorscale
+{
+    Colorscale scale;
+    auto const* value = at(trace, "colorscale");
+    auto reverse = boolean(trace, "reversescale", false);
+    std::string name = value && value->is<std::string>() ? value->as<std::string>() : "RdBu";
+    std::transform(name.begin(), name.end(), name.begin(), [](unsigned char c) { return std::tolower(c); });
+    if(name.size() > 2 && name.substr(name.size() - 2) == "_r")
+    {
+        name.resize(name.size() - 2);
+        reverse = !reverse;
+    }
+    if(value && value->is<List>())
+    {
+        for(auto const& item : value->as<List>())
+            if(item.is<List>() && item.as<List>().size() == 2 && item.as<List>()[1].is<std::string>())
+            {
+                auto const& pos = item.as<List>()[0];
+                auto const t = pos.is<double>() ? pos.as<double>() : pos.is<long long>() ? pos.as<long long>() : 0.0;
+                scale.emplace_back(t, color(item.as<List>()[1].as<std::string>()));
+            }
+    }
+    if(scale.empty())
+    {
+        auto const& scales = colorscales();
+        auto const it = scales.find(name);
+        for(auto const& [t, str] : (it != scales.end() ? it->second : scales.at("rdbu")))
+            scale.emplace_back(t, color(str));
+    }
+    if(reverse)
+    {
+        std::reverse(scale.begin(), scale.end());
+        for(auto& entry : scale)
+            entry.first = 1.0 - entry.first;
+    }
+    return scale;
+}
+
+/// Return the color of a colorscale at a position from 0 to 1.
+auto sample(Colorscale const& scale, double t) -> Color
+{
+    t = std::clamp(std::isfinite(t) ? t : 0.0, 0.0, 1.0);
+    for(std::size_t i = 1; i < scale.size(); ++i)
+        if(t <= scale[i].first)
+        {
+            auto const span = scale[i].first - scale[i - 1].first;
+            return mix(scale[i - 1].second, scale[i].second, span > 0.0 ? (t - scale[i - 1].first) / span : 0.0);
+        }
+    return scale.back().second;
+}
+
+//======================================================================================================================
+// AXES
+//======================================================================================================================
+
+/// Used to represent a tick on an axis.
+struct Tick
+{
+    /// The position of the tick in axis units.
+    double u = 0.0;
+
+    /// The label of the tick.
+    std::string label;
+};
+
+/// Used to represent an axis and map data values to pixel positions.
+struct Axis
+{
+    /// The letter of the axis (`x` or `y`).
+    char letter = 'x';
+
+    /// The options of the axis (e.g., `type`, `range`, `showgrid`).
+    Dict opts;
+
+    /// The type of the axis (`linear`, `log`, `date`, or `category`).
+    std::string type = "linear";
+
+    /// The categories on the axis in order of appearance (for a category axis).
+    std::vector<std::string> categories;
+
+    /// The minimum and maximum data values on the axis in axis units (log10 of the values for a log axis).
+    double dmin = NaN, dmax = NaN;
+
+    /// Whether the data range is padded by 5% of the axis length.
+    bool padded = false;
+
+    /// The extra padding (in px) needed by markers at the ends of the axis.
+    double ppad = 0.0;
+
+    /// The range of the axis in axis units.
+    double lo = 0.0, hi = 1.0;
+
+    /// The pixel positions of the ends of the range.
+    double p0 = 0.0, p1 = 1.0;
+
+    /// The ticks of the axis.
+    std::vector<Tick> ticks;
+
+    /// Return the pixel position of a value in axis units.
+    auto px(double u) const -> double { return p0 + (u - lo) * (p1 - p0) / (hi - lo); }
+
+    /// Return the length of the axis (in px).
+    auto length() const -> double { return std::abs(p1 - p0); }
+
+    /// Return a value of a range or tick option (a number or a string) in axis units.
+    auto unit(Value const& value) -> double
+    {
+        if(value.is<double>() || value.is<long long>())
+        {
+            auto const v = value.is<double>() ? value.as<double>() : static_cast<double>(value.as<long long>());
+            return type == "log" && !opts.find("range") ? (v > 0.0 ? std::log10(v) : NaN) : v;
+        }
+        if(value.is<std::string>())
+        {
+            double ms = 0.0;
+            if(type == "date" && parseDate(value.as<std::string>(), ms))
+                return ms;
+            if(type == "category")
+                return category(value.as<std::string>());
+        }
+        return NaN;
+    }
+
+    /// Return the index of a category, adding it if new.
+    auto category(std::string const& name) -> double
+    {
+        auto const it = std::find(categories.begin(), categories.end(), name);
+        if(it != categories.end())
+            return static_cast<double>(it - categories.begin());
+        categories.push_back(name);
+        return static_cast<double>(categories.size() - 1);
+    }
+
+    /// Return the values of a data column in axis units, or their indices if the column is empty.
+    auto units(Column const* column, std::size_t size) -> Numbers
+    {
+        Numbers res(column ? column->size() : size);
+        for(std::size_t i = 0; i < res.size(); ++i)
+        {
+            if(!column) { res[i] = static_cast<double>(i); continue; }
+            if(column->isStrings())
+            {
+                auto const& str = column->strings()[i];
+                double ms = 0.0;
+                res[i] = type == "date" ? (parseDate(str, ms) ? ms : NaN) : type == "category" ? category(str) : std::atof(str.c_str());
+                continue;
+            }
+            auto const v = column->numbers()[i];
+            res[i] = type == "log" ? (v > 0.0 ? std::log10(v) : NaN) : type == "category" ? category(format(v, decimals(v == 0 ? 1 : v))) : v;
+        }
+        return res;
+    }
+
+    /// Update the minimum and maximum data values on the axis with given values.
+    auto extend(Numbers const& values, bool pad, double markerpad) -> void
+    {
+        for(auto const v : values)
+            if(std::isfinite(v))
+            {
+                dmin = std::isnan(dmin) ? v : std::min(dmin, v);
+                dmax = std::isnan(dmax) ? v : std::max(dmax, v);
+            }
+        padded = padded || pad;
+        ppad = std::max(ppad, markerpad);
+    }
+};
+
+/// Return the type of an axis given as option or guessed from the first data column on it, as plotly does.
+auto axisType(Dict const& opts, Column const* column) -> std::string
+{
+    auto const type = text(opts, "type", "-");
+    if(type != "-")
+        return type;
+    if(!column || !column->isStrings())
+        return "linear";
+    double ms = 0.0;
+    for(auto const& str : column->strings())
+        if(!str.empty() && !parseDate(str, ms))
+            return "category";
+    return "date";
+}
+
+/// Set the range of an axis from its options or from its data, with the padding plotly uses.
+auto setRange(Axis& axis) -> void
+{
+    auto const* range = at(axis.opts, "range");
+    if(range && range->is<List>() && range->as<List>().size() == 2)
+    {
+        auto const& values = range->as<List>();
+        auto const lo = axis.unit(values[0]);
+        auto const hi = axis.unit(values[1]);
+        if(std::isfinite(lo) && std::isfinite(hi) && lo != hi)
+        {
+            axis.lo = lo;
+            axis.hi = hi;
+            return;
+        }
+    }
+
+    auto lo = std::isfinite(axis.dmin) ? axis.dmin : axis.type == "log" ? 0.0 : axis.type == "date" ? daysFromCivil(2000, 1, 1) * DAY : -1.0;
+    auto hi = std::isfinite(axis.dmax) ? axis.dmax : axis.type == "log" ? 1.0 : axis.type == "date" ? daysFromCivil(2001, 1, 1) * DAY : 4.0;
+
+    if(lo == hi)
+    {
+        auto const delta = axis.type == "date" ? DAY : axis.type == "category" ? 0.5 : lo == 0.0 ? 1.0 : std::abs(lo) * 0.1;
+        lo -= delta;
+        hi += delta;
+    }
+    else
+    {
+        auto const pad = (axis.padded ? 0.05 * axis.length() : 0.0) + axis.ppad;
+        auto const len = axis.length();
+        if(pad > 0.0 && len > 2 * pad)
+        {
+            auto const delta = pad * (hi - lo) / (len - 2 * pad);
+            lo -= delta;
+            hi += delta;
+        }
+    }
+
+    axis.lo = lo;
+    axis.hi = hi;
+
+    if(text(axis.opts, "autorange", "") == "reversed")
+        std::swap(axis.lo, axis.hi);
+}
+
+/// Set the ticks of an axis, following the automatic tick rules of plotly (or the tick options of the axis).
+auto setTicks(Axis& axis) -> void
+{
+    axis.ticks.clear();
+
+    auto const lo = std::min(axis.lo, axis.hi);
+    auto const hi = std::max(axis.lo, axis.hi);
+    auto const span = hi - lo;
+    auto const prefix = text(axis.opts, "tickprefix", "");
+    auto const suffix = text(axis.opts, "ticksuffix", "");
+
+    auto const* tickvals = at(axis.opts, "tickvals");
+    if(text(axis.opts, "tickmode", tickvals ? "array" : "auto") == "array" && tickvals)
+    {
+        auto const* ticktext = at(axis.opts, "ticktext");
+        Numbers values;
+        if(tickvals->is<Column>())
+            values = axis.units(&tickvals->as<Column>(), 0);
+        else if(tickvals->is<List>())
+            for(auto const& v : tickvals->as<List>())
+                values.push_back(axis.type == "log" && (v.is<double>() || v.is<long long>()) ? axis.unit(v) : axis.unit(v));
+        for(std::size_t i = 0; i < values.size(); ++i)
+        {
+            if(!(values[i] >= lo && values[i] <= hi))
+                continue;
+            std::string str;
+            if(ticktext && ticktext->is<Column>() && i < ticktext->as<Column>().size() && ticktext->as<Column>().isStrings())
+                str = ticktext->as<Column>().strings()[i];
+            else if(ticktext && ticktext->is<List>() && i < ticktext->as<List>().size() && ticktext->as<List>()[i].is<std::string>())
+                str = ticktext->as<List>()[i].as<std::string>();
+            else str = axis.type == "log" ? label(std::pow(10.0, values[i]), std::pow(10.0, values[i]), 0) : label(values[i], span / 10, 0);
+            axis.ticks.push_back({values[i], prefix + str + suffix});
+        }
+        return;
+    }
+
+    auto const minpx = axis.letter == 'x' ? 80.0 : 40.0;
+    auto nt = std::clamp(axis.length() / minpx, 4.0, 9.0) + 1.0;
+    if(auto const nticks = number(axis.opts, "nticks", 0.0); nticks > 0.0)
+        nt = nticks;
+
+    auto const add = [&](double u, std::string const& str)
+    {
+        if(u >= lo - 1e-9 * span && u <= hi + 1e-9 * span)
+            axis.ticks.push_back({u, prefix + str + suffix});
+    };
+
+    if(axis.type == "category")
+    {
+        auto const n = axis.categories.size();
+        auto const step = std::max<std::size_t>(1, static_cast<std::size_t>(std::ceil(n / nt)));
+        for(std::size_t i = 0; i < n; i += step)
+            add(static_cast<double>(i), axis.categories[i]);
+        return;
+    }
+
+    if(axis.type == "log")
+    {
+        auto const rough = span / nt;
+        if(rough > 0.7) // ticks at powers of ten
+        {
+            auto const step = std::max(1.0, std::ceil(niceStep(rough) - 1e-9));
+            for(auto e = std::ceil(lo / step - 1e-9) * step; e <= hi + 1e-9; e += step)
+            {
+                auto const v = std::pow(10.0, std::round(e));
+                add(e, label(v, v, siExponent(v)));
+            }
+        }
+        else // ticks at 1, 2, 5 (or all digits) times powers of ten
+        {
+            std::vector<int> const digits = rough > 0.3 ? std::vector<int>{1, 2, 5} : std::vector<int>{1, 2, 3, 4, 5, 6, 7, 8, 9};
+            for(auto e = std::floor(lo); e <= std::ceil(hi); e += 1.0)
+                for(auto d : digits)
+                {
+                    auto const v = d * std::pow(10.0, e);
+                    add(std::log10(v), label(v, std::pow(10.0, e), siExponent(v)));
+                }
+        }
+        return;
+    }
+
+    if(axis.type == "date")
+    {
+        auto const rough = span / nt;
+        double const steps[] = { SECOND, 2 * SECOND, 5 * SECOND, 10 * SECOND, 15 * SECOND, 30 * SECOND, MINUTE, 2 * MINUTE,
+            5 * MINUTE, 10 * MINUTE, 15 * MINUTE, 30 * MINUTE, HOUR, 2 * HOUR, 3 * HOUR, 6 * HOUR, 12 * HOUR, DAY, 2 * DAY, 7 * DAY, 14 * DAY };
+        for(auto step : steps)
+        {
+            if(step < rough)
+                continue;
+            auto const origin = step >= 7 * DAY ? daysFromCivil(2000, 1, 2) * DAY : 0.0; // weeks start on Sundays, as in plotly
+            auto const fmt = step >= DAY ? "%b %e" : step >= MINUTE ? "%H:%M" : "%H:%M:%S";
+            for(auto u = origin + std::ceil((lo - origin) / step) * step; u <= hi; u += step)
+                add(u, formatDate(u, fmt));
+            return;
+        }
+        auto const months = rough / (30.4375 * DAY);
+        int const step = months <= 1 ? 1 : months <= 2 ? 2 : months <= 3 ? 3 : months <= 6 ? 6 : 12 * static_cast<int>(std::max(1.0, niceStep(months / 12) / 2 * 2 >= months / 12 ? (months / 12 <= 1 ? 1 : niceStep(months / 12)) : niceStep(months / 12)));
+        long long y = 0;
+        unsigned m = 0, d = 0;
+        civilFromDays(static_cast<long long>(std::floor(lo / DAY)), y, m, d);
+        for(auto month = y * 12 + (m - 1); ; ++month)
+        {
+            if(month % step)
+                continue;
+            auto const u = daysFromCivil(month / 12, month % 12 + 1, 1) * DAY;
+            if(u > hi)
+                break;
+            add(u, formatDate(u, step >= 12 ? "%Y" : "%b %Y"));
+        }
+        return;
+    }
+
+    auto step = niceStep(span / nt);
+    auto tick0 = number(axis.opts, "tick0", 0.0);
+    if(auto const dtick = number(axis.opts, "dtick", 0.0); dtick > 0.0)
+        step = dtick;
+    auto const exponent = text(axis.opts, "exponentformat", "B") == "none" ? 0 : siExponent(std::max(std::abs(lo), std::abs(hi)));
+    for(auto u = tick0 + std::ceil((lo - tick0) / step - 1e-9) * step; u <= hi + 1e-9 * span; u += step)
+        add(std::abs(u) < 1e-12 * span ? 0.0 : u, label(std::abs(u) < 1e-12 * span ? 0.0 : u, step, exponent));
+}
+
+//======================================================================================================================
+// TRACES
+//======================================================================================================================
+
+/// Used to store a trace prepared for drawing.
+struct Trace
+{
+    /// The options of the trace, with the defaults of the template.
+    Dict opts;
+
+    /// The type of the trace (e.g., `scatter`, `contour`).
+    std::string type;
+
+    /// The x and y values of the trace in axis units.
+    Numbers x, y;
+
+    /// The z values of a contour trace (row-major).
+    Numbers z;
+
+    /// The number of rows and columns of the z values of a contour trace.
+    std::size_t rows = 0, cols = 0;
+
+    /// The default color of the trace (from the colorway of the layout).
+    Color color;
+
+    /// The contour levels of a contour trace.
+    Numbers levels;
+
+    /// The step between the contour levels of a contour trace.
+    double step = 1.0;
+
+    /// The colorscale of a contour trace.
+    Colorscale scale;
+
+    /// Whether the trace has lines and markers.
+    bool lines = false, markers = false;
+};
+
+/// Return the column at a key of a trace, or null if not a column.
+auto columnAt(Dict const& trace, std::string const& key) -> Column const*
+{
+    auto const* value = trace.find(key);
+    return value && value->is<Column>() ? &value->as<Column>() : nullptr;
+}
+
+/// Return the vertices of a marker symbol (other than a circle) centered at the origin with given radius.
+auto symbol(std::string const& name, double r) -> std::vector<Point>
+{
+    auto const regular = [r](int n, double scale, double phase)
+    {
+        std::vector<Point> pts;
+        for(int i = 0; i < n; ++i)
+        {
+            auto const a = phase + 2 * PI * i / n;
+            pts.push_back({ scale * r * std::sin(a), -scale * r * std::cos(a) });
+        }
+        return pts;
+    };
+    auto const rotate = [](std::vector<Point> pts, double angle)
+    {
+        auto const c = std::cos(angle), s = std::sin(angle);
+        for(auto& p : pts)
+            p = { c * p.x - s * p.y, s * p.x + c * p.y };
+        return pts;
+    };
+    if(name == "square")
+        return { {-r, -r}, {r, -r}, {r, r}, {-r, r} };
+    if(name == "diamond")
+        return regular(4, 1.3, 0.0);
+    if(name == "triangle-up" || name == "triangle-down" || name == "triangle-left" || name == "triangle-right")
+    {
+        auto const rt = 2 * r / std::sqrt(3.0);
+        std::vector<Point> const up = { {-rt, r / 2}, {rt, r / 2}, {0.0, -r} };
+        auto const angle = name == "triangle-up" ? 0.0 : name == "triangle-right" ? PI / 2 : name == "triangle-down" ? PI : -PI / 2;
+        return rotate(up, angle);
+    }
+    if(name == "cross" || name == "x")
+    {
+        auto const a = 1.2 * r, b = 0.4 * r;
+        std::vector<Point> const cross = { {a, b}, {b, b}, {b, a}, {-b, a}, {-b, b}, {-a, b}, {-a, -b}, {-b, -b}, {-b, -a}, {b, -a}, {b, -b}, {a, -b} };
+        return name == "cross" ? cross : rotate(cross, PI / 4);
+    }
+    if(name == "pentagon")
+        return regular(5, 1.05, 0.0);
+    if(name == "hexagon")
+        return regular(6, 1.05, 0.0);
+    if(name == "star")
+    {
+        std::vector<Point> pts;
+        for(int i = 0; i < 10; ++i)
+        {
+            auto const a = PI * i / 5;
+            auto const s = i % 2 ? 0.55 * r : 1.3 * r;
+            pts.push_back({ s * std::sin(a), -s * std::cos(a) });
+        }
+        return pts;
+    }
+    return {};
+}
+
+/// Draw a marker of a scatter trace at a given position.
+auto drawMarker(Canvas& canvas, Trace const& trace, Point const& p) -> void
+{
+    auto name = text(trace.opts, "marker.symbol", "circle");
+    auto const open = name.find("-open") != std::string::npos;
+    name = name.substr(0, name.find('-', name.rfind("triangle-", 0) == 0 ? 9 : 0));
+    auto const r = number(trace.opts, "marker.size", 6.0) / 2;
+    auto fill = colorAt(trace.opts, "marker.color", trace.color);
+    fill.a *= number(trace.opts, "marker.opacity", 1.0);
+    Stroke stroke{ colorAt(trace.opts, "marker.line.color", open ? fill : Color{68, 68, 68}), number(trace.opts, "marker.line.width", open ? 2.0 : 0.0) };
+    if(open)
+        fill.a = 0.0;
+    auto pts = symbol(name, r);
+    if(pts.empty())
+        return canvas.circle(p, r, fill, stroke);
+    for(auto& q : pts)
+        q = { p.x + q.x, p.y + q.y };
+    canvas.polygons({ pts }, fill, stroke);
+}
+
+/// Return the stroke used for the lines of a scatter trace.
+auto lineStroke(Trace const& trace) -> Stroke
+{
+    auto const width = number(trace.opts, "line.width", 2.0);
+    return { colorAt(trace.opts, "line.color", trace.color), width, dashes(text(trace.opts, "line.dash", "solid"), width) };
+}
+
+/// Draw a scatter trace (lines, markers, or both).
+auto drawScatter(Canvas& canvas, Trace const& trace, Axis const& xaxis, Axis const& yaxis) -> void
+{
+    auto const n = std::min(trace.x.size(), trace.y.size());
+    if(trace.lines)
+    {
+        auto const stroke = lineStroke(trace);
+        std::vector<Point> points;
+        auto const flush = [&]
+        {
+            if(points.size() > 1)
+                canvas.polyline(points, stroke);
+            points.clear();
+        };
+        for(std::size_t i = 0; i < n; ++i)
+        {
+            if(!std::isfinite(trace.x[i]) || !std::isfinite(trace.y[i])) { flush(); continue; } // gaps are not connected, as in plotly
+            points.push_back({ xaxis.px(trace.x[i]), yaxis.px(trace.y[i]) });
+        }
+        flush();
+    }
+    if(trace.markers)
+        for(std::size_t i = 0; i < n; ++i)
+            if(std::isfinite(trace.x[i]) && std::isfinite(trace.y[i]))
+                drawMarker(canvas, trace, { xaxis.px(trace.x[i]), yaxis.px(trace.y[i]) });
+}
+
+/// Fill the missing z values of a contour trace (e.g., NaN) from their neighbours, as plotly does with `interp2d`.
+/// The missing values next to known ones are first set to the average of those, and then all missing values are
+/// relaxed to the average of their neighbours until they settle, so that gaps are filled smoothly instead of left empty.
+auto fillGaps(Trace& trace) -> void
+{
+    auto& z = trace.z;
+    auto const rows = trace.rows, cols = trace.cols;
+    if(z.size() != rows * cols)
+        return;
+
+    std::vector<std::size_t> empties;
+    std::vector<bool> known(z.size());
+    auto zmin = NaN, zmax = NaN;
+    for(std::size_t k = 0; k < z.size(); ++k)
+    {
+        known[k] = std::isfinite(z[k]);
+        if(!known[k])
+            empties.push_back(k);
+        else
+        {
+            zmin = std::isnan(zmin) ? z[k] : std::min(zmin, z[k]);
+            zmax = std::isnan(zmax) ? z[k] : std::max(zmax, z[k]);
+        }
+    }
+    if(empties.empty() || empties.size() == z.size())
+        return;
+
+    auto const average = [&](std::size_t k, bool knownonly)
+    {
+        auto const i = k / cols, j = k % cols;
+        auto sum = 0.0;
+        auto count = 0;
+        auto const add = [&](std::size_t m) { if(!knownonly || known[m]) { sum += z[m]; ++count; } };
+        if(i > 0) add(k - cols);
+        if(i + 1 < rows) add(k + cols);
+        if(j > 0) add(k - 1);
+        if(j + 1 < cols) add(k + 1);
+        return count ? sum / count : NaN;
+    };
+
+    // The first guess spreads the known values into the gaps, one layer of neighbours at a time
+    auto pending = empties;
+    while(!pending.empty())
+    {
+        std::vector<std::pair<std::size_t, double>> guessed;
+        std::vector<std::size_t> rest;
+        for(auto k : pending)
+        {
+            auto const value = average(k, true);
+            if(std::isnan(value)) rest.push_back(k);
+            else guessed.emplace_back(k, value);
+        }
+        for(auto const& [k, value] : guessed)
+        {
+            z[k] = value;
+            known[k] = true;
+        }
+        pending = std::move(rest);
+    }
+
+    // The missing values are then relaxed to the average of their neighbours (with the same tolerance as plotly)
+    auto const tolerance = 0.01 * std::max(zmax - zmin, 1e-300);
+    for(int iteration = 0; iteration < 100; ++iteration)
+    {
+        auto change = 0.0;
+        for(auto k : empties)
+        {
+            auto const value = average(k, false);
+            change = std::max(change, std::abs(value - z[k]));
+            z[k] = value;
+        }
+        if(change < tolerance)
+            break;
+    }
+}
+
+/// Set the contour levels and colorscale of a contour trace, as plotly does with `autocontour`.
+auto setLevels(Trace& trace) -> void
+{
+    auto zmin = NaN, zmax = NaN;
+    for(auto z : trace.z)
+        if(std::isfinite(z))
+        {
+            zmin = std::isnan(zmin) ? z : std::min(zmin, z);
+            zmax = std::isnan(zmax) ? z : std::max(zmax, z);
+        }
+    if(std::isnan(zmin))
+        return;
+    if(zmin == zmax)
+    {
+        zmin -= 0.5;
+        zmax += 0.5;
+    }
+
+    auto start = number(trace.opts, "contours.start", NaN);
+    auto end = number(trace.opts, "contours.end", NaN);
+    auto step = number(trace.opts, "contours.size", NaN);
+    if(!(step > 0.0) || !std::isfinite(start) || !std::isfinite(end))
+    {
+        step = niceStep((zmax - zmin) / number(trace.opts, "ncontours", 15.0));
+        start = std::floor(zmin / step + 1.0 + 1e-9) * step; // the first level strictly above the minimum
+        end = std::ceil(zmax / step - 1.0 - 1e-9) * step; // the last level strictly below the maximum
+    }
+
+    trace.step = step;
+    trace.levels.clear();
+    for(auto level = start; level <= end + 1e-9 * step; level += step)
+        trace.levels.push_back(level);
+    if(trace.levels.empty())
+        trace.levels.push_back(0.5 * (zmin + zmax));
+    trace.scale = colorscale(trace.opts);
+}
+
+/// Return the polygon clipped to the region where the interpolated values are above (or below) a level.
+auto clipPolygon(std::vector<std::pair<Point, double>> const& poly, double level, bool above) -> std::vector<std::pair<Point, double>>
+{
+    std::vector<std::pair<Point, double>> res;
+    auto const inside = [&](double z) { return above ? z >= level : z < level; };
+    for(std::size_t i = 0; i < poly.size(); ++i)
+    {
+        auto const& [p, zp] = poly[i];
+        auto const& [q, zq] = poly[(i + 1) % poly.size()];
+        if(inside(zp))
+            res.push_back(poly[i]);
+        if(inside(zp) != inside(zq))
+        {
+            auto const t = (level - zp) / (zq - zp);
+            res.push_back({ { p.x + t * (q.x - p.x), p.y + t * (q.y - p.y) }, level });
+        }
+    }
+    return res;
+}
+
+/// Draw a contour trace (filled bands, heatmap, or lines, with optional labels).
+auto drawContour(Canvas& canvas, Trace const& trace, Axis const& xaxis, Axis const& yaxis, TextStyle const& textstyle) -> void
+{
+    auto const rows = trace.rows, cols = trace.cols;
+    if(rows < 2 || cols < 2 || trace.levels.empty())
+        return;
+
+    auto const coloring = text(trace.opts, "contours.coloring", "fill");
+    auto const heatmap = coloring == "heatmap";
+    auto const& levels = trace.levels;
+    auto const n = levels.size();
+    auto const cmin = levels.front() - trace.step / 2, cmax = levels.back() + trace.step / 2;
+
+    auto const point = [&](std::size_t i, std::size_t j) -> Point
+    {
+        return { xaxis.px(j < trace.x.size() ? trace.x[j] : static_cast<double>(j)), yaxis.px(i < trace.y.size() ? trace.y[i] : static_cast<double>(i)) };
+    };
+
+    // The levels separating the filled bands (the contour levels, or many levels for a smooth heatmap)
+    Numbers bounds = levels;
+    if(heatmap)
+    {
+        bounds.clear();
+        for(int k = 1; k < 64; ++k)
+            bounds.push_back(cmin + (cmax - cmin) * k / 64.0);
+    }
+    auto const nb = bounds.size();
+    auto const band = [&](double z) { return static_cast<std::size_t>(std::upper_bound(bounds.begin(), bounds.end(), z) - bounds.begin()); };
+
+    std::vector<std::vector<std::vector<Point>>> bands(nb + 1);
+    std::vector<std::vector<Point>> lines(n);
+
+    auto const filled = coloring == "fill" || heatmap;
+
+    auto const addPolygon = [&](std::size_t b, std::vector<Point> pts)
+    {
+        double area = 0.0;
+        for(std::size_t k = 0; k < pts.size(); ++k)
+            area += pts[k].x * pts[(k + 1) % pts.size()].y - pts[(k + 1) % pts.size()].x * pts[k].y;
+        if(area < 0.0) // all polygons have the same orientation so that shared edges cancel out without seams
+            std::reverse(pts.begin(), pts.end());
+        bands[b].push_back(std::move(pts));
+    };
+
+    // Consecutive cells in a row entirely within the same band are filled with a single polygon, which has far fewer edges
+    std::size_t runstart = 0, runband = 0;
+    bool inrun = false;
+    auto const flushRun = [&](std::size_t i, std::size_t jend)
+    {
+        if(!inrun)
+            return;
+        std::vector<Point> pts;
+        for(auto j = runstart; j <= jend; ++j)
+            pts.push_back(point(i, j));
+        for(auto j = jend + 1; j-- > runstart;)
+            pts.push_back(point(i + 1, j));
+        addPolygon(runband, std::move(pts));
+        inrun = false;
+    };
+
+    for(std::size_t i = 0; i + 1 < rows; ++i)
+    {
+        for(std::size_t j = 0; j + 1 < cols; ++j)
+        {
+            std::pair<Point, double> const corners[4] = {
+                { point(i, j), trace.z[i * cols + j] }, { point(i, j + 1), trace.z[i * cols + j + 1] },
+                { point(i + 1, j + 1), trace.z[(i + 1) * cols + j + 1] }, { point(i + 1, j), trace.z[(i + 1) * cols + j] } };
+
+            auto const zmin = std::min({ corners[0].second, corners[1].second, corners[2].second, corners[3].second });
+            auto const zmax = std::max({ corners[0].second, corners[1].second, corners[2].second, corners[3].second });
+            if(filled && std::isfinite(zmin) && std::isfinite(zmax) && band(zmin) == band(zmax)
+                && std::upper_bound(levels.begin(), levels.end(), zmin) == std::upper_bound(levels.begin(), levels.end(), zmax))
+            {
+                if(inrun && runband != band(zmin))
+                    flushRun(i, j);
+                if(!inrun)
+                {
+                    inrun = true;
+                    runstart = j;
+                    runband = band(zmin);
+                }
+                continue; // no contour line crosses the cell
+            }
+            flushRun(i, j);
+
+            for(int t = 0; t < 2; ++t)
+            {
+                std::vector<std::pair<Point, double>> const tri = t == 0
+                    ? std::vector<std::pair<Point, double>>{ corners[0], corners[1], corners[2] }
+                    : std::vector<std::pair<Point, double>>{ corners[0], corners[2], corners[3] };
+                if(!std::isfinite(tri[0].second) || !std::isfinite(tri[1].second) || !std::isfinite(tri[2].second))
+                    continue; // only when the trace has no finite z value at all (see fillGaps)
+                auto const zlo = std::min({ tri[0].second, tri[1].second, tri[2].second });
+                auto const zhi = std::max({ tri[0].second, tri[1].second, tri[2].second });
+
+                if(filled)
+                {
+                    auto const blo = band(zlo), bhi = band(zhi);
+                    for(auto b = blo; b <= bhi; ++b)
+                    {
+                        auto poly = tri;
+                        if(b > blo) poly = clipPolygon(poly, bounds[b - 1], true);
+                        if(b < bhi) poly = clipPolygon(poly, bounds[b], false);
+                        if(poly.size() < 3)
+                            continue;
+                        std::vector<Point> pts;
+                        for(auto const& vertex : poly)
+                            pts.push_back(vertex.first);
+                        addPolygon(b, std::move(pts));
+                    }
+                }
+
+                for(std::size_t k = 0; k < n; ++k)
+                {
+                    auto const level = levels[k];
+                    if(level < zlo || level > zhi)
+                        continue;
+                    std::vector<Point> crossings;
+                    for(int e = 0; e < 3; ++e)
+                    {
+                        auto const& [p, zp] = tri[e];
+                        auto const& [q, zq] = tri[(e + 1) % 3];
+                        if((zp >= level) != (zq >= level))
+                        {
+                            auto const s = (level - zp) / (zq - zp);
+                            crossings.push_back({ p.x + s * (q.x - p.x), p.y + s * (q.y - p.y) });
+                        }
+                    }
+                    if(crossings.size() == 2)
+                        lines[k].insert(lines[k].end(), crossings.begin(), crossings.end());
+                }
+            }
+        }
+        flushRun(i, cols - 1);
+    }
+
+    for(std::size_t b = 0; b <= nb; ++b)
+        if(!bands[b].empty())
+        {
+            auto const fill = sample(trace.scale, heatmap ? (b + 0.5) / (nb + 1) : static_cast<double>(b) / nb);
+            canvas.polygons(bands[b], fill, { fill, 0.3 });
+        }
+
+    auto const showlines = boolean(trace.opts, "contours.showlines", true);
+    if(showlines || coloring == "lines" || coloring == "none")
+        for(std::size_t k = 0; k < n; ++k)
+        {
+            auto const t = (levels[k] - cmin) / (cmax - cmin);
+            auto const dflt = coloring == "lines" ? sample(trace.scale, t) : Color{68, 68, 68};
+            auto const width = number(trace.opts, "line.width", coloring == "lines" ? 1.0 : 0.5);
+            canvas.segments(lines[k], { coloring == "lines" ? dflt : colorAt(trace.opts, "line.color", dflt), width, dashes(text(trace.opts, "line.dash", "solid"), width) });
+        }
+
+    if(boolean(trace.opts, "contours.showlabels", false))
+    {
+        auto style = font(trace.opts, "contours.labelfont", textstyle);
+        style.anchor = Anchor::Middle;
+        Point const center = { 0.5 * (xaxis.p0 + xaxis.p1), 0.5 * (yaxis.p0 + yaxis.p1) };
+        for(std::size_t k = 0; k < n; ++k)
+        {
+            if(lines[k].empty())
+                continue;
+            std::size_t best = 0;
+            auto bestdist = std::numeric_limits<double>::infinity();
+            for(std::size_t s = 0; s + 1 < lines[k].size(); s += 2)
+            {
+                auto const mx = 0.5 * (lines[k][s].x + lines[k][s + 1].x), my = 0.5 * (lines[k][s].y + lines[k][s + 1].y);
+                auto const dist = std::hypot(mx - center.x, my - center.y);
+                if(dist < bestdist) { bestdist = dist; best = s; }
+            }
+            Point const p = { 0.5 * (lines[k][best].x + lines[k][best + 1].x), 0.5 * (lines[k][best].y + lines[k][best + 1].y) + 0.35 * style.size };
+            canvas.text(p, label(levels[k], trace.step, 0), style);
+        }
+    }
+}
+
+/// Return the maximum width of the labels of ticks.
+auto labelWidth(Canvas& canvas, std::vector<Tick> const& ticks, TextStyle const& style) -> double
+{
+    double width = 0.0;
+    for(auto const& tick : ticks)
+        width = std::max(width, canvas.textWidth(tick.label, style));
+    return width;
+}
+
+} // namespace ""
+
+auto setBackend(Backend backend) -> void
+{
+    sessionbackend = static_cast<int>(backend);
+}
+
+auto backend() -> Backend
+{
+    if(sessionbackend < 0)
+    {
+        auto const* env = std::getenv("REAKTPLOT_BACKEND");
+        sessionbackend = static_cast<int>(env && std::string(env) == "native" ? Backend::Native : Backend::Plotly);
+    }
+    return static_cast<Backend>(sessionbackend.load());
+}
+
+auto render(Canvas& canvas, FigureSpecs const& specs, int width, int height) -> void
+{
+    auto const figure = plotlyFigure(specs, true, false); // the frames are not drawn
+    auto const& data = figure.find("data")->as<List>();
+    auto const tmpl = dict(figure.find("layout")->as<Dict>(), "template");
+    auto const layout = merged(dict(tmpl, "layout"), figure.find("layout")->as<Dict>());
+
+    //------------------------------------------------------------------------------------------------------------------
+    // The fonts and colors of the figure
+    //------------------------------------------------------------------------------------------------------------------
+    TextStyle basefont;
+    basefont.family = "\"Open Sans\", verdana, arial, sans-serif";
+    basefont.color = color("#444");
+    basefont = font(layout, "font", basefont);
+
+    auto const paper = colorAt(layout, "paper_bgcolor", color("#fff"));
+    auto const plotbg = colorAt(layout, "plot_bgcolor", color("#fff"));
+
+    std::vector<Color> colorway;
+    if(auto const* value = at(layout, "colorway"); value && value->is<List>())
+        for(auto const& item : value->as<List>())
+            if(item.is<std::string>())
+                colorway.push_back(color(item.as<std::string>()));
+    if(colorway.empty())
+        for(auto str : { "#1f77b4", "#ff7f0e", "#2ca02c", "#d62728", "#9467bd", "#8c564b", "#e377c2", "#7f7f7f", "#bcbd22", "#17becf" })
+            colorway.push_back(color(str));
+
+    //------------------------------------------------------------------------------------------------------------------
+    // The axes and the traces with their data in axis units
+    //------------------------------------------------------------------------------------------------------------------
+    Axis xaxis, yaxis;
+    xaxis.letter = 'x';
+    yaxis.letter = 'y';
+    xaxis.opts = dict(layout, "xaxis");
+    yaxis.opts = dict(layout, "yaxis");
+
+    Column const* firstx = nullptr;
+    Column const* firsty = nullptr;
+    for(auto const& item : data)
+    {
+        if(!item.is<Dict>()) continue;
+        if(!firstx) firstx = columnAt(item.as<Dict>(), "x");
+        if(!firsty) firsty = columnAt(item.as<Dict>(), "y");
+    }
+    xaxis.type = axisType(xaxis.opts, firstx);
+    yaxis.type = axisType(yaxis.opts, firsty);
+
+    std::vector<Trace> traces;
+    for(std::size_t index = 0; index < data.size(); ++index)
+    {
+        if(!data[index].is<Dict>())
+            continue;
+        Trace trace;
+        trace.opts = data[index].as<Dict>();
+        trace.type = text(trace.opts, "type", "scatter");
+        if(auto const* defaults = at(tmpl, "data." + trace.type); defaults && defaults->is<List>() && !defaults->as<List>().empty() && defaults->as<List>()[0].is<Dict>())
+            trace.opts = merged(defaults->as<List>()[0].as<Dict>(), trace.opts);
+        if(!boolean(trace.opts, "visible", true))
+            continue;
+        trace.color = colorway[index % colorway.size()];
+
+        auto const* z = columnAt(trace.opts, "z");
+        auto const* x = columnAt(trace.opts, "x");
+        auto const* y = columnAt(trace.opts, "y");
+
+        if(trace.type == "contour")
+        {
+            if(!z || !z->isMatrix())
+                continue;
+            trace.rows = z->rows();
+            trace.cols = z->cols();
+            trace.z = z->numbers();
+            trace.x = xaxis.units(x, trace.cols);
+            trace.y = yaxis.units(y, trace.rows);
+            trace.x.resize(std::min(trace.x.size(), trace.cols));
+            trace.y.resize(std::min(trace.y.size(), trace.rows));
+            xaxis.extend(trace.x, false, 0.0);
+            yaxis.extend(trace.y, false, 0.0);
+            fillGaps(trace);
+            setLevels(trace);
+        }
+        else if(trace.type == "scatter" || trace.type == "scattergl")
+        {
+            auto const size = x ? x->size() : y ? y->size() : 0;
+            trace.x = xaxis.units(x, size);
+            trace.y = yaxis.units(y, size);
+            auto const mode = text(trace.opts, "mode", size < 20 ? "lines+markers" : "lines");
+            trace.lines = mode.find("lines") != std::string::npos;
+            trace.markers = mode.find("markers") != std::string::npos;
+            auto const markerpad = trace.markers ? number(trace.opts, "marker.size", 6.0) / 2 : 0.0;
+            xaxis.extend(trace.x, trace.markers, markerpad);
+            yaxis.extend(trace.y, true, markerpad);
+        }
+        else continue; // trace types not produced by Figure are skipped
+
+        traces.push_back(std::move(trace));
+    }
+
+    //------------------------------------------------------------------------------------------------------------------
+    // The legend, colorbar, and margins
+    //------------------------------------------------------------------------------------------------------------------
+    auto const legendfont = font(layout, "legend.font", basefont);
+    auto const legendtitle = text(layout, "legend.title.text", "");
+    auto const legendtitlefont = font(layout, "legend.title.font", legendfont);
+
+    std::vector<Trace const*> entries;
+    for(auto const& trace : traces)
+        if(trace.type != "contour" && boolean(trace.opts, "showlegend", true))
+            entries.push_back(&trace);
+    auto const showlegend = boolean(layout, "showlegend", entries.size() > 1) && !entries.empty();
+
+    double legendwidth = 0.0;
+    if(showlegend)
+    {
+        for(auto const* entry : entries)
+            legendwidth = std::max(legendwidth, 40.0 + canvas.textWidth(text(entry->opts, "name", ""), legendfont));
+        legendwidth = std::max(legendwidth, canvas.textWidth(legendtitle, legendtitlefont)) + 10.0;
+    }
+
+    Trace const* colorbar = nullptr;
+    for(auto const& trace : traces)
+        if(trace.type == "contour" && boolean(trace.opts, "showscale", true) && !trace.levels.empty())
+            colorbar = &trace;
+
+    Axis cbaxis;
+    cbaxis.letter = 'y';
+    auto const cbfont = font(colorbar ? colorbar->opts : Dict(), "colorbar.tickfont", basefont);
+    auto const cbthickness = colorbar ? number(colorbar->opts, "colorbar.thickness", 30.0) : 0.0;
+    double cbwidth = 0.0;
+
+    auto const margin = dict(layout, "margin");
+    auto const ml = number(margin, "l", 80.0), mt = number(margin, "t", 100.0), mb = number(margin, "b", 80.0);
+    auto mr = number(margin, "r", 80.0);
+
+    auto const autoexpand = boolean(margin, "autoexpand", true);
+    auto const plotwidth0 = width - ml - mr;
+
+    Rect plot = { ml, mt, std::max(1.0, width - ml - mr), std::max(1.0, height - mt - mb) };
+
+    if(colorbar) // the colorbar labels must be known to reserve space for them
+    {
+        cbaxis.lo = colorbar->levels.front() - colorbar->step / 2;
+        cbaxis.hi = colorbar->levels.back() + colorbar->step / 2;
+        cbaxis.p0 = plot.y + plot.height;
+        cbaxis.p1 = plot.y;
+        setTicks(cbaxis);
+        cbwidth = cbthickness + 6.0 + labelWidth(canvas, cbaxis.ticks, cbfont) + 10.0;
+    }
+
+    if(autoexpand && (showlegend || colorbar)) // the legend and colorbar push the right margin as needed, as in plotly
+        mr = std::max(mr, 0.02 * plotwidth0 + legendwidth + cbwidth);
+
+    plot.width = std::max(1.0, width - ml - mr);
+
+    //------------------------------------------------------------------------------------------------------------------
+    // The ranges and ticks of the axes
+    //------------------------------------------------------------------------------------------------------------------
+    xaxis.p0 = plot.x;
+    xaxis.p1 = plot.x + plot.width;
+    yaxis.p0 = plot.y + plot.height;
+    yaxis.p1 = plot.y;
+
+    setRange(xaxis);
+    setRange(yaxis);
+    setTicks(xaxis);
+    setTicks(yaxis);
+
+    //------------------------------------------------------------------------------------------------------------------
+    // Drawing
+    //------------------------------------------------------------------------------------------------------------------
+    canvas.begin(width, height);
+
+    canvas.rect({ 0.0, 0.0, static_cast<double>(width), static_cast<double>(height) }, paper);
+    canvas.rect(plot, plotbg);
+
+    auto const drawGrid = [&](Axis const& axis)
+    {
+        auto const axiscolor = colorAt(axis.opts, "color", color("#444"));
+        if(boolean(axis.opts, "showgrid", axis.type != "category"))
+        {
+            Stroke const stroke{ colorAt(axis.opts, "gridcolor", mix(axiscolor, plotbg, 0.855)), number(axis.opts, "gridwidth", 1.0), dashes(text(axis.opts, "griddash", "solid"), 1.0) };
+            std::vector<Point> pts;
+            for(auto const& tick : axis.ticks)
+            {
+                auto const p = axis.px(tick.u);
+                if(axis.letter == 'x') { pts.push_back({ p, plot.y }); pts.push_back({ p, plot.y + plot.height }); }
+                else { pts.push_back({ plot.x, p }); pts.push_back({ plot.x + plot.width, p }); }
+            }
+            canvas.segments(pts, stroke);
+        }
+        if(axis.type == "linear" && boolean(axis.opts, "zeroline", true) && std::min(axis.lo, axis.hi) < 0.0 && std::max(axis.lo, axis.hi) > 0.0)
+        {
+            Stroke const stroke{ colorAt(axis.opts, "zerolinecolor", axiscolor), number(axis.opts, "zerolinewidth", 1.0) };
+            auto const p = axis.px(0.0);
+            if(axis.letter == 'x') canvas.segments({ { p, plot.y }, { p, plot.y + plot.height } }, stroke);
+            else canvas.segments({ { plot.x, p }, { plot.x + plot.width, p } }, stroke);
+        }
+    };
+
+    drawGrid(xaxis);
+    drawGrid(yaxis);
+
+    canvas.clip(plot);
+    for(auto const& trace : traces)
+    {
+        if(trace.type == "contour")
+            drawContour(canvas, trace, xaxis, yaxis, basefont);
+        else drawScatter(canvas, trace, xaxis, yaxis);
+    }
+    canvas.unclip();
+
+    auto const drawAxis = [&](Axis const& axis)
+    {
+        auto const axiscolor = colorAt(axis.opts, "color", color("#444"));
+        auto const ticks = text(axis.opts, "ticks", "");
+        auto const ticklen = ticks.empty() ? 0.0 : number(axis.opts, "ticklen", 5.0);
+        auto const tickout = ticks == "outside" ? ticklen : 0.0;
+        auto const isx = axis.letter == 'x';
+        auto const edge = isx ? plot.y + plot.height : plot.x;
+
+        if(boolean(axis.opts, "showline", false))
+        {
+            Stroke const stroke{ colorAt(axis.opts, "linecolor", axiscolor), number(axis.opts, "linewidth", 1.0) };
+            if(isx) canvas.segments({ { plot.x, edge }, { plot.x + plot.width, edge } }, stroke);
+            else canvas.segments({ { edge, plot.y }, { edge, plot.y + plot.height } }, stroke);
+        }
+
+        if(!ticks.empty())
+        {
+            Stroke const stroke{ colorAt(axis.opts, "tickcolor", axiscolor), number(axis.opts, "tickwidth", 1.0) };
+            auto const sign = ticks == "outside" ? 1.0 : -1.0;
+            std::vector<Point> pts;
+            for(auto const& tick : axis.ticks)
+            {
+                auto const p = axis.px(tick.u);
+                if(isx) { pts.push_back({ p, edge }); pts.push_back({ p, edge + sign * ticklen }); }
+                else { pts.push_back({ edge, p }); pts.push_back({ edge - sign * ticklen, p }); }
+            }
+            canvas.segments(pts, stroke);
+        }
+
+        auto tickfont = font(axis.opts, "tickfont", basefont);
+        double labelsize = 0.0;
+        if(boolean(axis.opts, "showticklabels", true))
+        {
+            tickfont.anchor = isx ? Anchor::Middle : Anchor::End;
+            tickfont.angle = number(axis.opts, "tickangle", 0.0);
+            for(auto const& tick : axis.ticks)
+            {
+                auto const p = axis.px(tick.u);
+                if(isx) canvas.text({ p, edge + tickout + 3.0 + tickfont.size }, tick.label, tickfont);
+                else canvas.text({ edge - tickout - 6.0, p + 0.35 * tickfont.size }, tick.label, tickfont);
+            }
+            labelsize = isx ? tickfont.size + 3.0 : labelWidth(canvas, axis.ticks, tickfont) + 6.0;
+        }
+
+        auto const title = text(axis.opts, "title.text", "");
+        if(!title.empty())
+        {
+            auto titlefont = font(axis.opts, "title.font", basefont);
+            titlefont.anchor = Anchor::Middle;
+            auto const standoff = number(axis.opts, "title.standoff", 15.0);
+            if(isx)
+                canvas.text({ plot.x + plot.width / 2, edge + tickout + labelsize + standoff + 0.75 * titlefont.size }, title, titlefont);
+            else
+            {
+                titlefont.angle = -90.0;
+                canvas.text({ edge - tickout - labelsize - standoff - 0.25 * titlefont.size, plot.y + plot.height / 2 }, title, titlefont);
+            }
+        }
+    };
+
+    drawAxis(xaxis);
+    drawAxis(yaxis);
+
+    auto const title = text(layout, "title.text", "");
+    if(!title.empty())
+    {
+        auto titlefont = font(layout, "title.font", TextStyle{ basefont.family, basefont.size * 1.4, basefont.color });
+        auto const x = number(layout, "title.x", 0.5);
+        auto const xref = text(layout, "title.xref", "container");
+        auto const xanchor = text(layout, "title.xanchor", "auto");
+        titlefont.anchor = xanchor == "left" ? Anchor::Start : xanchor == "right" ? Anchor::End : xanchor == "center" ? Anchor::Middle
+            : x < 1.0 / 3.0 ? Anchor::Start : x > 2.0 / 3.0 ? Anchor::End : Anchor::Middle;
+        auto const px = xref == "paper" ? plot.x + x * plot.width : x * width;
+        auto const yref = text(layout, "title.yref", "container");
+        auto const* yvalue = at(layout, "title.y");
+        auto py = yref == "paper" ? plot.y - titlefont.size : mt / 2; // the vertical center of the title ("auto" position)
+        if(yvalue && (yvalue->is<double>() || yvalue->is<long long>()))
+            py = yref == "paper" ? plot.y + (1.0 - number(layout, "title.y", 1.0)) * plot.height : (1.0 - number(layout, "title.y", 1.0)) * height;
+        canvas.text({ px, py + 0.35 * titlefont.size }, title, titlefont);
+    }
+
+    auto x = plot.x + plot.width + 0.02 * plotwidth0;
+
+    if(showlegend)
+    {
+        auto const rowheight = std::max(legendfont.size * 1.3 + 4.0, 20.0);
+        auto y = plot.y;
+        auto const rows = entries.size() + (legendtitle.empty() ? 0 : 1);
+        canvas.rect({ x, y, legendwidth, rows * rowheight + 10.0 }, colorAt(layout, "legend.bgcolor", paper), { colorAt(layout, "legend.bordercolor", color("#444")), number(layout, "legend.borderwidth", 0.0) });
+        y += 5.0;
+        if(!legendtitle.empty())
+        {
+            canvas.text({ x + 5.0, y + rowheight / 2 + 0.35 * legendtitlefont.size }, legendtitle, legendtitlefont);
+            y += rowheight;
+        }
+        for(auto const* entry : entries)
+        {
+            auto const cy = y + rowheight / 2;
+            if(entry->lines)
+            {
+                auto stroke = lineStroke(*entry);
+                stroke.width = std::min(stroke.width, 5.0);
+                canvas.polyline({ { x + 5.0, cy }, { x + 35.0, cy } }, stroke);
+            }
+            if(entry->markers)
+            {
+                Trace marker = *entry;
+                marker.opts.set("marker", merged(dict(entry->opts, "marker"), Dict{{ "size", std::min(number(entry->opts, "marker.size", 6.0), 16.0) }}));
+                drawMarker(canvas, marker, { x + 20.0, cy });
+            }
+            canvas.text({ x + 40.0, cy + 0.35 * legendfont.size }, text(entry->opts, "name", ""), legendfont);
+            y += rowheight;
+        }
+        x += legendwidth;
+    }
+
+    if(colorbar)
+    {
+        auto const& levels = colorbar->levels;
+        auto const n = levels.size();
+        auto const heatmap = text(colorbar->opts, "contours.coloring", "fill") == "heatmap";
+        auto const bands = heatmap ? std::size_t(64) : n + 1;
+        for(std::size_t b = 0; b < bands; ++b)
+        {
+            auto const lo = heatmap ? cbaxis.lo + (cbaxis.hi - cbaxis.lo) * b / bands : b == 0 ? cbaxis.lo : levels[b - 1];
+            auto const hi = heatmap ? cbaxis.lo + (cbaxis.hi - cbaxis.lo) * (b + 1) / bands : b == n ? cbaxis.hi : levels[b];
+            auto const fill = sample(colorbar->scale, heatmap ? (b + 0.5) / bands : static_cast<double>(b) / n);
+            canvas.rect({ x, cbaxis.px(hi), cbthickness, cbaxis.px(lo) - cbaxis.px(hi) + 0.5 }, fill);
+        }
+        auto style = cbfont;
+        for(auto const& tick : cbaxis.ticks)
+            canvas.text({ x + cbthickness + 6.0, cbaxis.px(tick.u) + 0.35 * style.size }, tick.label, style);
+    }
+
+    canvas.end();
+}
+
+} // namespace reaktplot
@@ -0,0 +1,56 @@
+// reaktplot - a modern C++ scientific plotting library powered by plotly
+// https://github.com/reaktplot/reaktplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2022-2023 Allan Leal
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+// NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#pragma once
+
+// reaktplot includes
+#include <reaktplot/Canvas.hpp>
+#include <reaktplot/Macros.hpp>
+#include <reaktplot/Specs.hpp>
+
+namespace reaktplot {
+
+/// Used to specify how static images (e.g., SVG, PNG, and PDF files) are produced by Figure::save.
+enum class Backend
+{
+    Plotly, ///< The images are rendered by plotly and kaleido (a headless Chromium) through the Python interpreter.
+    Native, ///< The images are rendered natively in C++ (see @ref render), without the Python interpreter.
+};
+
+/// Set how static images are produced by Figure::save in this session.
+RKP_EXPORT auto setBackend(Backend backend) -> void;
+
+/// Return how static images are produced by Figure::save in this session.
+/// The default is Backend::Plotly, unless the environment variable `REAKTPLOT_BACKEND` is `native`.
+RKP_EXPORT auto backend() -> Backend;
+
+/// Draw a figure on a canvas, following the layout rules of plotly as closely as possible.
+/// The supported traces are those produced by Figure (lines, markers, lines with markers, and contours) on linear,
+/// logarithmic, date, and category axes, with titles, legends, colorbars, and the layout properties set through the
+/// Figure setters (e.g., fonts, colors, margins, grid lines, tick options, and axis ranges).
+/// @param canvas The canvas on which the figure is drawn.
+/// @param specs The specification of the figure.
+/// @param width The width of the figure (in px).
+/// @param height The height of the figure (in px).
+RKP_EXPORT auto render(Canvas& canvas, FigureSpecs const& specs, int width, int height) -> void;
+
+} // namespace reaktplot
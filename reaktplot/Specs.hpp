@@ -23,7 +23,9 @@
 #pragma once
 
 // C++ includes
+#include <cstddef>
 #include <string>
+#include <vector>
 
 // pybind11 includes
 #include <pybind11/pybind11.h>
@@ -32,152 +34,214 @@ namespace py = pybind11;
 // reaktplot includes
 #include <reaktplot/Macros.hpp>
 #include <reaktplot/Pythonic.hpp>
+#include <reaktplot/Value.hpp>
 
 namespace reaktplot {
 
 /// Used to specify the attributes of a font for a text in a figure.
-class RKP_EXPORT FontSpecs : public Pythonic
+class RKP_EXPORT FontSpecs
 {
 private:
-    /// The Python object of type `reaktplot.FontSpecs`.
-    py::object obj;
+    /// The attributes of the font keyed by plotly attribute names, as in `reaktplot.FontSpecs.options`.
+    Dict obj;
 
 public:
     /// Construct a default FontSpecs object.
-    FontSpecs()
-    : obj(Pythonic::createFontSpecs())
-    {}
+    FontSpecs() = default;
+
+    /// Return the attributes of the font keyed by plotly attribute names.
+    auto options() const -> Dict const& { return obj; }
 
-    /// Return the underlying `reakplot.FontSpecs` Python object.
-    auto pyspecs() const -> py::object const& { return obj; }
+    /// Return a new `reaktplot.FontSpecs` Python object with these attributes (requires the GIL, see Pythonic::execute).
+    auto pyspecs() const -> py::object { auto specs = Pythonic::createFontSpecs(); specs.attr("options") = Pythonic::pyobject(obj); return specs; }
 
     /// Sets the size of the font (in px).
     /// @param value The size of the font (in px)
-    auto size(int const& value) -> FontSpecs& { obj.attr("size")(value); return *this; }
+    auto size(int const& value) -> FontSpecs& { obj.set("size", value); return *this; }
 
     /// Sets the color of the text.
     /// @param value The color value (e.g., '#ff0000', 'rgb(100, 150, 200)', 'coral', 'darkblue')
-    auto color(std::string const& value) -> FontSpecs& { obj.attr("color")(value); return *this; }
+    auto color(std::string const& value) -> FontSpecs& { obj.set("color", value); return *this; }
 
     /// Sets the font family for the text.
     /// @param value The font family value (e.g., 'Arial', 'Sans-Serif', 'Droid Sans')
-    auto family(std::string const& value) -> FontSpecs& { obj.attr("family")(value); return *this; }
+    auto family(std::string const& value) -> FontSpecs& { obj.set("family", value); return *this; }
 };
 
 /// Used to specify the attributes of a line plot in a figure.
-class RKP_EXPORT LineSpecs : public Pythonic
+class RKP_EXPORT LineSpecs
 {
 private:
-    /// The Python object of type `reaktplot.LineSpecs`.
-    py::object obj;
+    /// The attributes of the line keyed by plotly attribute names, as in `reaktplot.LineSpecs.options`.
+    Dict obj;
 
 public:
     /// Construct a default LineSpecs object.
-    LineSpecs()
-    : obj(Pythonic::createLineSpecs())
-    {}
+    LineSpecs() = default;
+
+    /// Return the attributes of the line keyed by plotly attribute names.
+    auto options() const -> Dict const& { return obj; }
 
-    /// Return the underlying `reakplot.LineSpecs` Python object.
-    auto pyspecs() const -> py::object const& { return obj; }
+    /// Return a new `reaktplot.LineSpecs` Python object with these attributes (requires the GIL, see Pythonic::execute).
+    auto pyspecs() const -> py::object { auto specs = Pythonic::createLineSpecs(); specs.attr("options") = Pythonic::pyobject(obj); return specs; }
 
     /// Sets the width of the line element (in px).
     /// @param value The width of the line (in px)
-    auto width(int const& value) -> LineSpecs& { obj.attr("width")(value); return *this; }
+    auto width(int const& value) -> LineSpecs& { obj.set("width", value); return *this; }
 
     /// Sets the color of the line.
     /// @param value The color value (e.g., '#ff0000', 'rgb(100, 150, 200)', 'coral', 'darkblue')
-    auto color(std::string const& value) -> LineSpecs& { obj.attr("color")(value); return *this; }
+    auto color(std::string const& value) -> LineSpecs& { obj.set("color", value); return *this; }
 };
 
 /// Used to specify the attributes of a marker plot in a figure.
-class RKP_EXPORT MarkerSpecs : public Pythonic
+class RKP_EXPORT MarkerSpecs
 {
 private:
-    /// The Python object of type `reaktplot.MarkerSpecs`.
-    py::object obj;
+    /// The attributes of the marker keyed by plotly attribute names, as in `reaktplot.MarkerSpecs.options`.
+    Dict obj;
 
 public:
     /// Construct a default MarkerSpecs object.
-    MarkerSpecs()
-    : obj(Pythonic::createMarkerSpecs())
-    {}
+    MarkerSpecs() = default;
+
+    /// Return the attributes of the marker keyed by plotly attribute names.
+    auto options() const -> Dict const& { return obj; }
 
-    /// Return the underlying `reakplot.MarkerSpecs` Python object.
-    auto pyspecs() const -> py::object const& { return obj; }
+    /// Return a new `reaktplot.MarkerSpecs` Python object with these attributes (requires the GIL, see Pythonic::execute).
+    auto pyspecs() const -> py::object { auto specs = Pythonic::createMarkerSpecs(); specs.attr("options") = Pythonic::pyobject(obj); return specs; }
 
     /// Sets the marker size (in px).
     /// The size property is a number and may be specified as:
     ///     * An int or float in the interval [0, inf]
     ///     * A tuple, list, or one-dimensional numpy array of the above
     /// @param value The size of the marker (in px)
-    auto size(int const& value) -> MarkerSpecs& { obj.attr("size")(value); return *this; }
+    auto size(int const& value) -> MarkerSpecs& { obj.set("size", value); return *this; }
 
     /// Sets the marker symbol type.
     /// @param value The marker symbol (e.g, "circle", "diamond", "square", "circle-open")
-    auto symbol(std::string const& value) -> MarkerSpecs& { obj.attr("symbol")(value); return *this; }
+    auto symbol(std::string const& value) -> MarkerSpecs& { obj.set("symbol", value); return *this; }
 
     /// Sets the color of the marker.
     /// @param value The color value (e.g., '#ff0000', 'rgb(100, 150, 200)', 'coral', 'darkblue')
-    auto color(std::string const& value) -> MarkerSpecs& { obj.attr("color")(value); return *this; }
+    auto color(std::string const& value) -> MarkerSpecs& { obj.set("color", value); return *this; }
 
     /// Sets the properties of the border line of the marker.
     /// @param value The line specs of the border of the marker
-    auto line(LineSpecs const& value) -> MarkerSpecs& { obj.attr("line")(value.pyspecs()); return *this; }
+    auto line(LineSpecs const& value) -> MarkerSpecs& { obj.set("line", value.options()); return *this; }
 
     /// Sets the marker opacity.
     /// @param value The opacity value as a float number in [0, 1]
-    auto opacity(float const& value) -> MarkerSpecs& { obj.attr("opacity")(value); return *this; }
+    auto opacity(float const& value) -> MarkerSpecs& { obj.set("opacity", value); return *this; }
 };
 
 /// Used to specify the attributes of a contour plot in a figure.
-class RKP_EXPORT ContourSpecs : public Pythonic
+class RKP_EXPORT ContourSpecs
 {
 private:
-    /// The Python object of type `reaktplot.ContourSpecs`.
-    py::object obj;
+    /// The attributes of the contour keyed by plotly attribute names, as in `reaktplot.ContourSpecs.options`.
+    Dict obj;
 
 public:
     /// Construct a default ContourSpecs object.
     ContourSpecs()
-    : obj(Pythonic::createContourSpecs())
+    : obj{{"colorscale", "Portland"}} // set Portland as the default color scale for contour plots
     {}
 
-    /// Return the underlying `reakplot.ContourSpecs` Python object.
-    auto pyspecs() const -> py::object const& { return obj; }
+    /// Return the attributes of the contour keyed by plotly attribute names.
+    auto options() const -> Dict const& { return obj; }
+
+    /// Return a new `reaktplot.ContourSpecs` Python object with these attributes (requires the GIL, see Pythonic::execute).
+    auto pyspecs() const -> py::object { auto specs = Pythonic::createContourSpecs(); specs.attr("options") = Pythonic::pyobject(obj); return specs; }
 
     /// Sets the colorscale of the contour plot. [Check available colorscale names](https://plotly.com/python/builtin-colorscales/).
     /// @param value The name of the colorscale
-    auto colorscale(std::string const& value) -> ContourSpecs& { obj.attr("colorscale")(value); return *this; }
+    auto colorscale(std::string const& value) -> ContourSpecs& { obj.set("colorscale", value); return *this; }
 
     /// Sets the coloring mode of the contour plot to fill.
-    auto coloringModeFill() -> ContourSpecs& { obj.attr("coloringModeFill")(); return *this; }
+    auto coloringModeFill() -> ContourSpecs& { obj.set("contours_coloring", "fill"); return *this; }
 
     /// Sets the coloring mode of the contour plot to heatmap.
-    auto coloringModeHeatmap() -> ContourSpecs& { obj.attr("coloringModeHeatmap")(); return *this; }
+    auto coloringModeHeatmap() -> ContourSpecs& { obj.set("contours_coloring", "heatmap"); return *this; }
 
     /// Sets the number of contour lines in the plot.
     /// @param value The number of contour lines in the plot.
-    auto numContours(int const& value) -> ContourSpecs& { obj.attr("numContours")(value); return *this; }
+    auto numContours(int const& value) -> ContourSpecs& { obj.set("ncontours", value); return *this; }
 
     /// Sets or unsets the display of labels along the contour lines.
     /// @param value The flag indicating to show or not labels along contour lines.
-    auto showLabels(bool const& value) -> ContourSpecs& { obj.attr("showLabels")(value); return *this; }
+    auto showLabels(bool const& value) -> ContourSpecs& { obj.set("contours_showlabels", value); return *this; }
 
     /// Sets or unsets the display of lines in the contour plot (has effect only for fill coloring mode!).
     /// @param value The flag indicating to show or not lines in the contour plot.
-    auto showLines(bool const& value) -> ContourSpecs& { obj.attr("showLines")(value); return *this; }
+    auto showLines(bool const& value) -> ContourSpecs& { obj.set("contours_showlines", value); return *this; }
 
     /// Sets the font specifications for the labels on the contour lines.
     /// @param value The font specifications for the labels
-    auto labelFont(FontSpecs const& value) -> ContourSpecs& { obj.attr("labelFont")(value.pyspecs()); return *this; }
+    auto labelFont(FontSpecs const& value) -> ContourSpecs& { obj.set("contours_labelfont", value.options()); return *this; }
 
     /// Sets the contour label formatting rule using d3 formatting mini-languages which are very similar to those in Python. [Check these format string examples](https://github.com/d3/d3-format/tree/v1.4.5#d3-format).
     /// @param value The formatting rule (e.g., '.1f', '.2e')
-    auto labelFormat(std::string const& value) -> ContourSpecs& { obj.attr("labelFormat")(value); return *this; }
+    auto labelFormat(std::string const& value) -> ContourSpecs& { obj.set("contours_labelformat", value); return *this; }
 
     /// Sets the attributes of the lines in the contour plot.
     /// @param value The attributes of the contour lines.
-    auto line(LineSpecs const& value) -> ContourSpecs& { obj.attr("line")(value.pyspecs()); return *this; }
+    auto line(LineSpecs const& value) -> ContourSpecs& { obj.set("line", value.options()); return *this; }
+};
+
+/// Used to store a data column of a frame as the values that differ from the same column in an earlier frame (its
+/// keyframe) or in the figure, so that a frame changing a few cells of a large matrix stores only those cells.
+struct ColumnDelta
+{
+    /// The index of the trace in the frame whose data column is stored.
+    std::size_t trace = 0;
+
+    /// The attribute of the trace holding the data column (e.g., `z`).
+    std::string key;
+
+    /// The index of the frame holding the data column in full, or -1 if it is the trace in the figure.
+    std::ptrdiff_t keyframe = -1;
+
+    /// The ranges of changed values as pairs of positions `begin, end` in the column (in row-major order for a matrix).
+    std::vector<std::size_t> ranges;
+
+    /// The changed values, range after range.
+    std::vector<double> values;
+};
+
+/// Used to store a frame of an animated figure (a plotly frame), with only what changes from the figure.
+struct FrameSpecs
+{
+    /// The name of the frame (e.g., `t = 1.5 s`), shown in the slider of the animation.
+    std::string name;
+
+    /// The traces of the frame, the i-th one updating the i-th trace of the figure with the attributes that differ from it.
+    std::vector<Dict> traces;
+
+    /// The layout properties changed in the frame (e.g., `title_text`).
+    Dict layout;
+
+    /// The data columns of the traces of the frame stored as changes from a keyframe, instead of in @ref traces.
+    std::vector<ColumnDelta> deltas;
+};
+
+/// Used to store the specification of a figure (its layout, axes, and traces) independently of Python.
+struct FigureSpecs
+{
+    /// The layout properties of the figure keyed by plotly attribute names (e.g., `title_text`, `title_font_size`).
+    Dict layout;
+
+    /// The properties of the x-axis of the figure (e.g., `title_text`, `type`).
+    Dict xaxis;
+
+    /// The properties of the y-axis of the figure (e.g., `title_text`, `type`).
+    Dict yaxis;
+
+    /// The traces of the figure, each with a `type` key (e.g., `scatter`, `contour`) and data columns (e.g., `x`, `y`).
+    std::vector<Dict> traces;
+
+    /// The frames of the figure if animated, each with the traces and layout properties that change from the figure.
+    std::vector<FrameSpecs> frames;
 };
 
 } // namespace reaktplot
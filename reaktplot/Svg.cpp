@@ -0,0 +1,228 @@
+// reaktplot - a modern C++ scientific plotting library powered by plotly
+// https://github.com/reaktplot/reaktplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2022-2023 Allan Leal
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+// NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include "Svg.hpp"
+
+// C++ includes
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+
+// reaktplot includes
+#include <reaktplot/Renderer.hpp>
+
+namespace reaktplot {
+namespace {
+
+/// Return a coordinate formatted with at most two decimal places, without trailing zeros.
+auto num(double value) -> std::string
+{
+    char chars[32];
+    std::snprintf(chars, sizeof(chars), "%.2f", std::round(value * 100.0) / 100.0 + 0.0);
+    std::string str = chars;
+    str.erase(str.find_last_not_of('0') + 1);
+    if(str.back() == '.')
+        str.pop_back();
+    return str == "-0" ? "0" : str;
+}
+
+/// Return a color formatted as in the SVG files of plotly (e.g., `rgb(68, 68, 68)`).
+auto rgb(Color const& c) -> std::string
+{
+    return "rgb(" + std::to_string(c.r) + ", " + std::to_string(c.g) + ", " + std::to_string(c.b) + ")";
+}
+
+/// Return text escaped for use in an XML document.
+auto escaped(std::string const& str) -> std::string
+{
+    std::string res;
+    res.reserve(str.size());
+    for(auto c : str)
+    {
+        switch(c)
+        {
+        case '&': res += "&amp;"; break;
+        case '<': res += "&lt;"; break;
+        case '>': res += "&gt;"; break;
+        case '"': res += "&quot;"; break;
+        default: res += c;
+        }
+    }
+    return res;
+}
+
+/// Write the fill attributes of a shape.
+auto writeFill(std::ostream& out, Color const& fill) -> void
+{
+    if(fill.none())
+        out << " fill=\"none\"";
+    else
+    {
+        out << " fill=\"" << rgb(fill) << "\"";
+        if(fill.a < 1.0)
+            out << " fill-opacity=\"" << fill.a << "\"";
+    }
+}
+
+/// Write the stroke attributes of a shape.
+auto writeStroke(std::ostream& out, Stroke const& stroke) -> void
+{
+    if(stroke.none())
+        return;
+    out << " stroke=\"" << rgb(stroke.color) << "\" stroke-width=\"" << num(stroke.width) << "\"";
+    if(stroke.color.a < 1.0)
+        out << " stroke-opacity=\"" << stroke.color.a << "\"";
+    if(!stroke.dashes.empty())
+    {
+        out << " stroke-dasharray=\"";
+        for(std::size_t i = 0; i < stroke.dashes.size(); ++i)
+            out << (i ? "," : "") << num(stroke.dashes[i]);
+        out << "\"";
+    }
+}
+
+} // namespace ""
+
+SvgCanvas::SvgCanvas(std::ostream& out)
+: out(out)
+{}
+
+auto SvgCanvas::begin(int width, int height) -> void
+{
+    clips = 0;
+    clipped = false;
+    out << "<svg xmlns=\"http://www.w3.org/2000/svg\" xmlns:xlink=\"http://www.w3.org/1999/xlink\" width=\"" << width
+        << "\" height=\"" << height << "\" viewBox=\"0 0 " << width << " " << height << "\">\n";
+}
+
+auto SvgCanvas::end() -> void
+{
+    unclip();
+    out << "</svg>\n";
+}
+
+auto SvgCanvas::clip(Rect const& r) -> void
+{
+    unclip();
+    auto const id = "clip" + std::to_string(clips++);
+    out << "<defs><clipPath id=\"" << id << "\"><rect x=\"" << num(r.x) << "\" y=\"" << num(r.y) << "\" width=\""
+        << num(r.width) << "\" height=\"" << num(r.height) << "\"/></clipPath></defs>\n";
+    out << "<g clip-path=\"url(#" << id << ")\">\n";
+    clipped = true;
+}
+
+auto SvgCanvas::unclip() -> void
+{
+    if(clipped)
+        out << "</g>\n";
+    clipped = false;
+}
+
+auto SvgCanvas::rect(Rect const& r, Color const& fill, Stroke const& stroke) -> void
+{
+    if(fill.none() && stroke.none())
+        return;
+    out << "<rect x=\"" << num(r.x) << "\" y=\"" << num(r.y) << "\" width=\"" << num(r.width) << "\" height=\"" << num(r.height) << "\"";
+    writeFill(out, fill);
+    writeStroke(out, stroke);
+    out << "/>\n";
+}
+
+auto SvgCanvas::polyline(std::vector<Point> const& points, Stroke const& stroke) -> void
+{
+    if(points.size() < 2 || stroke.none())
+        return;
+    out << "<path d=\"";
+    for(std::size_t i = 0; i < points.size(); ++i)
+        out << (i ? "L" : "M") << num(points[i].x) << "," << num(points[i].y);
+    out << "\" fill=\"none\"";
+    writeStroke(out, stroke);
+    out << " stroke-linejoin=\"round\"/>\n";
+}
+
+auto SvgCanvas::segments(std::vector<Point> const& points, Stroke const& stroke) -> void
+{
+    if(points.size() < 2 || stroke.none())
+        return;
+    out << "<path d=\"";
+    for(std::size_t i = 0; i + 1 < points.size(); i += 2)
+        out << "M" << num(points[i].x) << "," << num(points[i].y) << "L" << num(points[i + 1].x) << "," << num(points[i + 1].y);
+    out << "\" fill=\"none\"";
+    writeStroke(out, stroke);
+    out << "/>\n";
+}
+
+auto SvgCanvas::polygons(std::vector<std::vector<Point>> const& polygons, Color const& fill, Stroke const& stroke) -> void
+{
+    if(polygons.empty() || (fill.none() && stroke.none()))
+        return;
+    out << "<path d=\"";
+    for(auto const& polygon : polygons)
+    {
+        for(std::size_t i = 0; i < polygon.size(); ++i)
+            out << (i ? "L" : "M") << num(polygon[i].x) << "," << num(polygon[i].y);
+        out << "Z";
+    }
+    out << "\"";
+    writeFill(out, fill);
+    writeStroke(out, stroke);
+    out << "/>\n";
+}
+
+auto SvgCanvas::circle(Point const& center, double radius, Color const& fill, Stroke const& stroke) -> void
+{
+    if(fill.none() && stroke.none())
+        return;
+    out << "<circle cx=\"" << num(center.x) << "\" cy=\"" << num(center.y) << "\" r=\"" << num(radius) << "\"";
+    writeFill(out, fill);
+    writeStroke(out, stroke);
+    out << "/>\n";
+}
+
+auto SvgCanvas::text(Point const& pos, std::string const& str, TextStyle const& style) -> void
+{
+    if(str.empty() || style.color.none())
+        return;
+    auto const anchor = style.anchor == Anchor::Start ? "start" : style.anchor == Anchor::Middle ? "middle" : "end";
+    out << "<text x=\"" << num(pos.x) << "\" y=\"" << num(pos.y) << "\" text-anchor=\"" << anchor << "\"";
+    if(style.angle != 0.0)
+        out << " transform=\"rotate(" << num(style.angle) << "," << num(pos.x) << "," << num(pos.y) << ")\"";
+    out << " style=\"font-family: " << escaped(style.family) << "; font-size: " << num(style.size) << "px; fill: " << rgb(style.color)
+        << "; fill-opacity: " << style.color.a << "; white-space: pre;\">" << escaped(str) << "</text>\n";
+}
+
+auto writeSvg(std::ostream& out, FigureSpecs const& specs, int width, int height) -> void
+{
+    SvgCanvas canvas(out);
+    render(canvas, specs, width, height);
+}
+
+auto saveSvg(std::string const& file, FigureSpecs const& specs, int width, int height) -> void
+{
+    std::ofstream out(file);
+    if(!out)
+        throw std::runtime_error("Could not open file " + file + " for writing.");
+    writeSvg(out, specs, width, height);
+}
+
+} // namespace reaktplot
@@ -0,0 +1,75 @@
+// reaktplot - a modern C++ scientific plotting library powered by plotly
+// https://github.com/reaktplot/reaktplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2022-2023 Allan Leal
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+// NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#pragma once
+
+// C++ includes
+#include <ostream>
+#include <string>
+
+// reaktplot includes
+#include <reaktplot/Canvas.hpp>
+#include <reaktplot/Macros.hpp>
+#include <reaktplot/Specs.hpp>
+
+namespace reaktplot {
+
+/// Used to draw figures in SVG format.
+class RKP_EXPORT SvgCanvas : public Canvas
+{
+public:
+    /// Construct a SvgCanvas object that writes to an output stream.
+    explicit SvgCanvas(std::ostream& out);
+
+    auto begin(int width, int height) -> void override;
+    auto end() -> void override;
+    auto clip(Rect const& rect) -> void override;
+    auto unclip() -> void override;
+    auto rect(Rect const& rect, Color const& fill, Stroke const& stroke = {}) -> void override;
+    auto polyline(std::vector<Point> const& points, Stroke const& stroke) -> void override;
+    auto segments(std::vector<Point> const& points, Stroke const& stroke) -> void override;
+    auto polygons(std::vector<std::vector<Point>> const& polygons, Color const& fill, Stroke const& stroke = {}) -> void override;
+    auto circle(Point const& center, double radius, Color const& fill, Stroke const& stroke = {}) -> void override;
+    auto text(Point const& pos, std::string const& str, TextStyle const& style) -> void override;
+
+private:
+    /// The output stream of the SVG document.
+    std::ostream& out;
+
+    /// The number of clip paths defined so far (used to name them).
+    int clips = 0;
+
+    /// Whether drawing is currently restricted to a clip path.
+    bool clipped = false;
+};
+
+/// Write a figure in SVG format, rendered natively in C++ (see @ref render).
+/// @param out The output stream.
+/// @param specs The specification of the figure.
+/// @param width The width of the figure (in px).
+/// @param height The height of the figure (in px).
+RKP_EXPORT auto writeSvg(std::ostream& out, FigureSpecs const& specs, int width, int height) -> void;
+
+/// Save a figure to an SVG file, rendered natively in C++ (see @ref writeSvg).
+RKP_EXPORT auto saveSvg(std::string const& file, FigureSpecs const& specs, int width, int height) -> void;
+
+} // namespace reaktplot
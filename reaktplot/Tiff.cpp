@@ -0,0 +1,220 @@
+// reaktplot - a modern C++ scientific plotting library powered by plotly
+// https://github.com/reaktplot/reaktplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2022-2023 Allan Leal
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+// NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include "Tiff.hpp"
+
+// C++ includes
+#include <algorithm>
+#include <stdexcept>
+#include <tuple>
+
+// zlib includes
+#ifdef REAKTPLOT_HAS_ZLIB
+#include <zlib.h>
+#endif
+
+namespace reaktplot {
+namespace {
+
+/// The types of the values of TIFF tags.
+const std::uint16_t SHORT = 3, LONG = 4;
+
+/// Append a little-endian 16-bit integer to a byte string.
+auto append16(std::string& bytes, std::uint16_t value) -> void
+{
+    bytes += static_cast<char>(value & 0xFF);
+    bytes += static_cast<char>(value >> 8);
+}
+
+/// Append a little-endian 32-bit integer to a byte string.
+auto append32(std::string& bytes, std::uint32_t value) -> void
+{
+    for(int shift = 0; shift < 32; shift += 8)
+        bytes += static_cast<char>(value >> shift & 0xFF);
+}
+
+} // namespace ""
+
+TiffWriter::TiffWriter(std::ostream& out, int width, int height, int tilesize)
+: out(out), width(width), height(height), tilesize(tilesize)
+{
+    if(width <= 0 || height <= 0)
+        throw std::invalid_argument("The size of the image must be positive.");
+    if(tilesize <= 0 || tilesize % 16 != 0)
+        throw std::invalid_argument("The size of the tiles of a TIFF image must be a positive multiple of 16.");
+
+    start = out.tellp();
+    if(start == std::streampos(-1))
+        throw std::runtime_error("Could not write a TIFF image to an output stream that does not support seeking.");
+
+    columns = (width + tilesize - 1) / tilesize;
+    rows = (height + tilesize - 1) / tilesize;
+
+    std::string header = "II"; // little-endian byte order
+    append16(header, 42);
+    append32(header, 0); // the position of the image file directory, written by close
+    append(header);
+}
+
+auto TiffWriter::encode(std::vector<unsigned char> const& rgba, int width, int height, int tilesize) -> std::string
+{
+    if(width > tilesize || height > tilesize || rgba.size() != static_cast<std::size_t>(width) * height * 4)
+        throw std::invalid_argument("The size of the tile does not match its number of pixels.");
+
+    // Tiles on the right and at the bottom of the image are padded to the size of the tiles
+    auto const rowsize = static_cast<std::size_t>(tilesize) * 4;
+    std::string raw(rowsize * tilesize, '\0');
+    for(int y = 0; y < height; ++y)
+    {
+        auto const* src = rgba.data() + static_cast<std::size_t>(y) * width * 4;
+        std::copy(src, src + static_cast<std::size_t>(width) * 4, raw.begin() + rowsize * y);
+    }
+
+#ifdef REAKTPLOT_HAS_ZLIB
+    // Each pixel is stored as its difference to the pixel on the left (TIFF predictor 2), which compresses the large
+    // areas of equal color in plots into runs of zeros, compressed with run-length matching only as in PNG images
+    for(int y = 0; y < tilesize; ++y)
+    {
+        auto* row = reinterpret_cast<unsigned char*>(&raw[rowsize * y]);
+        for(auto i = rowsize - 1; i >= 4; --i)
+            row[i] = static_cast<unsigned char>(row[i] - row[i - 4]);
+    }
+
+    z_stream stream{};
+    if(deflateInit2(&stream, Z_BEST_SPEED, Z_DEFLATED, 15, 8, Z_RLE) != Z_OK)
+        throw std::runtime_error("Could not compress the TIFF image data.");
+    std::string res(deflateBound(&stream, static_cast<uLong>(raw.size())), '\0');
+    stream.next_in = reinterpret_cast<Bytef*>(&raw[0]);
+    stream.avail_in = static_cast<uInt>(raw.size());
+    stream.next_out = reinterpret_cast<Bytef*>(&res[0]);
+    stream.avail_out = static_cast<uInt>(res.size());
+    auto const status = deflate(&stream, Z_FINISH);
+    res.resize(stream.total_out);
+    deflateEnd(&stream);
+    if(status != Z_STREAM_END)
+        throw std::runtime_error("Could not compress the TIFF image data.");
+    return res;
+#else
+    return raw;
+#endif
+}
+
+auto TiffWriter::append(std::string const& bytes) -> void
+{
+    out.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+    offset += bytes.size();
+}
+
+auto TiffWriter::write(std::string const& tile) -> void
+{
+    if(closed || offsets.size() == tiles())
+        throw std::runtime_error("Could not write more tiles than the TIFF image has.");
+    if(offset + tile.size() > UINT32_MAX)
+        throw std::runtime_error("Could not write a TIFF image larger than 4 GB.");
+    offsets.push_back(static_cast<std::uint32_t>(offset));
+    sizes.push_back(static_cast<std::uint32_t>(tile.size()));
+    append(tile);
+}
+
+auto TiffWriter::close() -> void
+{
+    if(closed)
+        return;
+    if(offsets.size() != tiles())
+        throw std::runtime_error("Could not finish the TIFF image because only " + std::to_string(offsets.size()) + " of its " + std::to_string(tiles()) + " tiles were written.");
+    closed = true;
+
+    if(offset % 2) // the image file directory starts at an even position
+        append(std::string(1, '\0'));
+
+#ifdef REAKTPLOT_HAS_ZLIB
+    std::uint32_t const compression = 8, predictor = 2; // deflate, with the difference to the pixel on the left
+#else
+    std::uint32_t const compression = 1, predictor = 1; // no compression, with the pixels unchanged
+#endif
+
+    // The tags of the image, in increasing order, with the values of those that do not fit in 4 bytes stored after them
+    std::vector<std::tuple<std::uint16_t, std::uint16_t, std::uint32_t, std::uint32_t>> tags = {
+        { 256, LONG, 1, static_cast<std::uint32_t>(width) },  // ImageWidth
+        { 257, LONG, 1, static_cast<std::uint32_t>(height) }, // ImageLength
+        { 258, SHORT, 4, 0 },           // BitsPerSample (8 for each channel)
+        { 259, SHORT, 1, compression }, // Compression
+        { 262, SHORT, 1, 2 },           // PhotometricInterpretation (RGB)
+        { 277, SHORT, 1, 4 },           // SamplesPerPixel
+        { 284, SHORT, 1, 1 },           // PlanarConfiguration (channels of each pixel stored together)
+        { 317, SHORT, 1, predictor },   // Predictor
+        { 322, LONG, 1, static_cast<std::uint32_t>(tilesize) }, // TileWidth
+        { 323, LONG, 1, static_cast<std::uint32_t>(tilesize) }, // TileLength
+        { 324, LONG, static_cast<std::uint32_t>(tiles()), offsets.front() }, // TileOffsets
+        { 325, LONG, static_cast<std::uint32_t>(tiles()), sizes.front() },   // TileByteCounts
+        { 338, SHORT, 1, 2 },           // ExtraSamples (opacity, not premultiplied)
+    };
+
+    auto const directory = offset;
+    auto extra = directory + 2 + 12 * tags.size() + 4;
+
+    std::string ifd, data;
+    append16(ifd, static_cast<std::uint16_t>(tags.size()));
+    for(auto const& [tag, type, count, value] : tags)
+    {
+        append16(ifd, tag);
+        append16(ifd, type);
+        append32(ifd, count);
+        if(tag == 258) // the values of BitsPerSample, TileOffsets, and TileByteCounts (if more than one tile) are stored after the tags
+        {
+            append32(ifd, static_cast<std::uint32_t>(extra + data.size()));
+            for(int i = 0; i < 4; ++i)
+                append16(data, 8);
+        }
+        else if((tag == 324 || tag == 325) && count > 1)
+        {
+            append32(ifd, static_cast<std::uint32_t>(extra + data.size()));
+            for(auto const v : tag == 324 ? offsets : sizes)
+                append32(data, v);
+        }
+        else if(type == SHORT)
+        {
+            append16(ifd, static_cast<std::uint16_t>(value));
+            append16(ifd, 0);
+        }
+        else append32(ifd, value);
+    }
+    append32(ifd, 0); // no further image file directory
+
+    if(extra + data.size() > UINT32_MAX)
+        throw std::runtime_error("Could not write a TIFF image larger than 4 GB.");
+
+    append(ifd);
+    append(data);
+
+    std::string position;
+    append32(position, static_cast<std::uint32_t>(directory));
+    out.seekp(start + std::streamoff(4));
+    out.write(position.data(), 4);
+    out.seekp(start + std::streamoff(offset));
+    out.flush();
+
+    if(!out)
+        throw std::runtime_error("Could not write the TIFF image.");
+}
+
+} // namespace reaktplot
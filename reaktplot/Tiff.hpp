@@ -0,0 +1,93 @@
+// reaktplot - a modern C++ scientific plotting library powered by plotly
+// https://github.com/reaktplot/reaktplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2022-2023 Allan Leal
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+// NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#pragma once
+
+// C++ includes
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+// reaktplot includes
+#include <reaktplot/Macros.hpp>
+
+namespace reaktplot {
+
+/// Used to write an image in tiled TIFF format one tile at a time, for images too large to be kept in memory at once.
+/// Tiles are square, with a size that is a multiple of 16 pixels, and each one is stored on its own (compressed with
+/// zlib if reaktplot was built with it, and uncompressed otherwise), so that tiles can be encoded in parallel with
+/// @ref encode and written as they are ready. The output stream must support seeking (e.g., a file stream), since the
+/// position of the tiles is written at the start of the file once they are all written. Images are limited to 4 GB.
+class RKP_EXPORT TiffWriter
+{
+public:
+    /// Construct a TiffWriter object that writes an image with given size (in pixels) to an output stream.
+    /// @param out The output stream.
+    /// @param width The width of the image (in pixels).
+    /// @param height The height of the image (in pixels).
+    /// @param tilesize The width and height of the tiles (in pixels, a multiple of 16).
+    TiffWriter(std::ostream& out, int width, int height, int tilesize);
+
+    /// Return the pixels of a tile encoded as stored in a TIFF file, which can be done in any thread.
+    /// @param rgba The pixels of the tile, row by row from the top, with 4 bytes each (red, green, blue, and opacity).
+    /// @param width The width of the tile (in pixels), which is less than the tile size only on the right of the image.
+    /// @param height The height of the tile (in pixels), which is less than the tile size only at the bottom of the image.
+    /// @param tilesize The width and height of the tiles of the image (in pixels).
+    static auto encode(std::vector<unsigned char> const& rgba, int width, int height, int tilesize) -> std::string;
+
+    /// Write the next tile of the image, encoded with @ref encode. Tiles are written row by row from the top left.
+    auto write(std::string const& tile) -> void;
+
+    /// Finish the image, throwing an error if not all of its tiles have been written.
+    auto close() -> void;
+
+    /// Return the number of tiles in the image.
+    auto tiles() const -> std::size_t { return static_cast<std::size_t>(columns) * rows; }
+
+private:
+    /// Write a string to the output stream and keep track of its size (used for the positions of the tiles).
+    auto append(std::string const& bytes) -> void;
+
+    /// The output stream of the TIFF image.
+    std::ostream& out;
+
+    /// The position of the start of the TIFF image in the output stream.
+    std::streampos start;
+
+    /// The number of bytes written to the output stream so far.
+    std::uint64_t offset = 0;
+
+    /// The width, height, and tile size of the image (in pixels).
+    int width = 0, height = 0, tilesize = 0;
+
+    /// The number of columns and rows of tiles in the image.
+    int columns = 0, rows = 0;
+
+    /// The position and size of each tile written so far.
+    std::vector<std::uint32_t> offsets, sizes;
+
+    /// Whether the image has been finished.
+    bool closed = false;
+};
+
+} // namespace reaktplot
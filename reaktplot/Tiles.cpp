@@ -0,0 +1,176 @@
+// reaktplot - a modern C++ scientific plotting library powered by plotly
+// https://github.com/reaktplot/reaktplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2022-2023 Allan Leal
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+// NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include "Tiles.hpp"
+
+// C++ includes
+#include <algorithm>
+#include <cmath>
+#include <deque>
+#include <fstream>
+#include <functional>
+#include <future>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+// reaktplot includes
+#include <reaktplot/Executor.hpp>
+#include <reaktplot/Png.hpp>
+#include <reaktplot/Renderer.hpp>
+#include <reaktplot/Tiff.hpp>
+
+namespace reaktplot {
+namespace {
+
+/// Used to represent a tile of an image.
+struct Tile
+{
+    /// The position of the tile in the image (in pixels).
+    int x = 0, y = 0;
+
+    /// The width and height of the tile (in pixels).
+    int width = 0, height = 0;
+
+    /// The pixels of the tile, row by row from the top, with 4 bytes each (red, green, blue, and opacity).
+    std::vector<unsigned char> rgba;
+
+    /// The tile encoded for the output format (e.g., compressed).
+    std::string data;
+};
+
+/// Return the size of the tiles with given options (a multiple of 16 pixels, as required by TIFF images).
+auto tileSize(TileOptions const& options) -> int
+{
+    return std::max(16, (options.size + 15) / 16 * 16);
+}
+
+/// Render the tiles of a figure in parallel and call a function with each tile in order, row by row from the top left.
+/// @param encode The function called with each tile in the thread that rendered it (e.g., to compress it), or null.
+/// @param consume The function called with each tile in the calling thread, in order.
+auto renderTiles(FigureSpecs const& specs, int width, int height, double scale, TileOptions const& options,
+    std::function<void(Tile&)> const& encode, std::function<void(Tile&)> const& consume) -> void
+{
+    auto const size = tileSize(options);
+    auto const imagewidth = std::max(1, static_cast<int>(std::lround(width * scale))); // as in PngCanvas::begin
+    auto const imageheight = std::max(1, static_cast<int>(std::lround(height * scale)));
+    auto const columns = (imagewidth + size - 1) / size;
+    auto const count = static_cast<std::size_t>(columns) * ((imageheight + size - 1) / size);
+    auto const numthreads = options.threads ? options.threads : std::max(1u, std::thread::hardware_concurrency());
+
+    Executor pool(numthreads);
+
+    // Tiles are rendered a few at a time ahead of the one being consumed, so that at most these are kept in memory
+    std::deque<std::future<Tile>> pending;
+    std::size_t next = 0;
+    auto const submit = [&]
+    {
+        Tile tile;
+        tile.x = static_cast<int>(next % columns) * size;
+        tile.y = static_cast<int>(next / columns) * size;
+        ++next;
+        pending.push_back(pool.submit([&, tile]() mutable
+        {
+            PngCanvas canvas(scale);
+            canvas.viewport(tile.x, tile.y, size, size);
+            render(canvas, specs, width, height);
+            tile.width = canvas.width();
+            tile.height = canvas.height();
+            tile.rgba = canvas.pixels();
+            if(encode)
+                encode(tile);
+            return tile;
+        }));
+    };
+
+    while(next < count && pending.size() < 2 * numthreads)
+        submit();
+
+    while(!pending.empty())
+    {
+        auto tile = pending.front().get();
+        pending.pop_front();
+        if(next < count)
+            submit();
+        consume(tile);
+    }
+}
+
+} // namespace ""
+
+auto writeTiledPng(std::ostream& out, FigureSpecs const& specs, int width, int height, double scale, TileOptions const& options) -> void
+{
+    auto const imagewidth = std::max(1, static_cast<int>(std::lround(width * scale)));
+    auto const imageheight = std::max(1, static_cast<int>(std::lround(height * scale)));
+
+    PngWriter writer(out, imagewidth, imageheight);
+
+    // The rows of pixels of the current row of tiles, written once its last tile is stitched
+    std::vector<unsigned char> band(static_cast<std::size_t>(imagewidth) * tileSize(options) * 4);
+
+    renderTiles(specs, width, height, scale, options, nullptr, [&](Tile& tile)
+    {
+        auto const rowsize = static_cast<std::size_t>(tile.width) * 4;
+        for(int y = 0; y < tile.height; ++y)
+            std::copy_n(tile.rgba.data() + rowsize * y, rowsize, band.data() + (static_cast<std::size_t>(y) * imagewidth + tile.x) * 4);
+        if(tile.x + tile.width == imagewidth)
+            writer.write(band.data(), tile.height);
+    });
+
+    writer.close();
+}
+
+auto writeTiledTiff(std::ostream& out, FigureSpecs const& specs, int width, int height, double scale, TileOptions const& options) -> void
+{
+    auto const size = tileSize(options);
+    auto const imagewidth = std::max(1, static_cast<int>(std::lround(width * scale)));
+    auto const imageheight = std::max(1, static_cast<int>(std::lround(height * scale)));
+
+    TiffWriter writer(out, imagewidth, imageheight, size);
+
+    auto const encode = [&](Tile& tile)
+    {
+        tile.data = TiffWriter::encode(tile.rgba, tile.width, tile.height, size);
+        tile.rgba = {}; // only the encoded tile waits to be written
+    };
+
+    renderTiles(specs, width, height, scale, options, encode, [&](Tile& tile) { writer.write(tile.data); });
+
+    writer.close();
+}
+
+auto saveTiled(std::string const& file, FigureSpecs const& specs, int width, int height, double scale, TileOptions const& options) -> void
+{
+    auto const ext = file.substr(file.find_last_of('.') + 1);
+    if(ext != "png" && ext != "tif" && ext != "tiff")
+        throw std::runtime_error("Could not save file " + file + " as tiles, which is only possible for PNG and TIFF files.");
+
+    std::ofstream out(file, std::ios::binary);
+    if(!out)
+        throw std::runtime_error("Could not open file " + file + " for writing.");
+
+    if(ext == "png")
+        writeTiledPng(out, specs, width, height, scale, options);
+    else writeTiledTiff(out, specs, width, height, scale, options);
+}
+
+} // namespace reaktplot
@@ -0,0 +1,68 @@
+// reaktplot - a modern C++ scientific plotting library powered by plotly
+// https://github.com/reaktplot/reaktplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2022-2023 Allan Leal
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+// NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#pragma once
+
+// C++ includes
+#include <cstddef>
+#include <ostream>
+#include <string>
+
+// reaktplot includes
+#include <reaktplot/Default.hpp>
+#include <reaktplot/Macros.hpp>
+#include <reaktplot/Specs.hpp>
+
+namespace reaktplot {
+
+/// The options of the images rendered as tiles (see @ref saveTiled).
+struct TileOptions
+{
+    /// The width and height of the tiles (in pixels, rounded up to a multiple of 16).
+    int size = DEFAULT_TILE_SIZE;
+
+    /// The number of threads rendering tiles in parallel (zero means the number of cores).
+    std::size_t threads = 0;
+};
+
+/// Write a figure in PNG format, rendered natively in C++ as tiles in parallel (see PngCanvas::viewport).
+/// Each tile is rendered independently with its own viewport, with exactly the pixels it has in the whole image, and
+/// the tiles are stitched one row of tiles at a time by a PngWriter, so that memory use is bounded by a row of tiles
+/// (instead of the whole image), which makes it possible to produce images of hundreds of megapixels (e.g., posters).
+/// @param out The output stream.
+/// @param specs The specification of the figure.
+/// @param width The width of the figure (in px).
+/// @param height The height of the figure (in px).
+/// @param scale The number of pixels in the image per px in the figure.
+/// @param options The size of the tiles and the number of threads rendering them.
+RKP_EXPORT auto writeTiledPng(std::ostream& out, FigureSpecs const& specs, int width, int height, double scale = 1.0, TileOptions const& options = {}) -> void;
+
+/// Write a figure in tiled TIFF format, rendered natively in C++ as tiles in parallel (see @ref writeTiledPng).
+/// The tiles are also compressed in parallel and written one at a time by a TiffWriter, so that memory use is bounded
+/// by the tiles being rendered. The output stream must support seeking (see TiffWriter).
+RKP_EXPORT auto writeTiledTiff(std::ostream& out, FigureSpecs const& specs, int width, int height, double scale = 1.0, TileOptions const& options = {}) -> void;
+
+/// Save a figure to a PNG or TIFF file (with extension `.png`, `.tif`, or `.tiff`), rendered natively in C++ as tiles
+/// in parallel (see @ref writeTiledPng and @ref writeTiledTiff).
+RKP_EXPORT auto saveTiled(std::string const& file, FigureSpecs const& specs, int width, int height, double scale = 1.0, TileOptions const& options = {}) -> void;
+
+} // namespace reaktplot
@@ -0,0 +1,327 @@
+// reaktplot - a modern C++ scientific plotting library powered by plotly
+// https://github.com/reaktplot/reaktplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2022-2023 Allan Leal
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+// NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#pragma once
+
+// C++ includes
+#include <initializer_list>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+// reaktplot includes
+#include <reaktplot/Column.hpp>
+
+namespace reaktplot {
+
+class Value;
+
+/// Used to represent a list of values (e.g., the range `[0, 1]` of an axis).
+using List = std::vector<Value>;
+
+/// Used to represent the properties of a figure component (e.g., its layout, an axis, or a trace) in insertion order.
+/// The keys are plotly attribute names, possibly with plotly's magic underscores (e.g., `title_font_size`).
+/// The entries are shared among copies of the dictionary until one of them is modified (copy-on-write), so that
+/// copying a figure (e.g., with Figure::clone) does not copy its layout and traces.
+class Dict
+{
+public:
+    /// The type of a key-value entry in the dictionary.
+    using Entry = std::pair<std::string, Value>;
+
+    /// Construct an empty Dict object.
+    Dict() = default;
+
+    /// Construct a Dict object with given entries.
+    Dict(std::initializer_list<Entry> entries);
+
+    /// Set the value of a key, keeping its position if it already exists.
+    auto set(std::string const& key, Value value) -> void;
+
+    /// Set the values of the keys in another dictionary.
+    auto update(Dict const& other) -> void;
+
+    /// Return the value of a key, or null if the key does not exist.
+    auto find(std::string const& key) const -> Value const*;
+
+    /// Remove a key from the dictionary, if it exists.
+    auto erase(std::string const& key) -> void;
+
+    /// Return the number of entries in the dictionary.
+    auto size() const -> std::size_t { return items().size(); }
+
+    /// Return true if the dictionary has no entries.
+    auto empty() const -> bool { return items().empty(); }
+
+    /// Return an iterator to the first entry in the dictionary.
+    auto begin() const { return items().begin(); }
+
+    /// Return an iterator past the last entry in the dictionary.
+    auto end() const { return items().end(); }
+
+    /// Return true if this and another dictionary share the same entries in memory.
+    auto shares(Dict const& other) const -> bool;
+
+    /// Return true if this dictionary has the same entries as another, in any order.
+    auto operator==(Dict const& other) const -> bool;
+
+    /// Return true if this dictionary differs from another.
+    auto operator!=(Dict const& other) const -> bool { return !(*this == other); }
+
+private:
+    /// The entries in the dictionary in insertion order, shared among copies (null if there are no entries yet).
+    std::shared_ptr<std::vector<Entry>> entries;
+
+    /// Return the entries in the dictionary.
+    auto items() const -> std::vector<Entry> const&;
+
+    /// Return the entries in the dictionary for modification, copying them first if shared with other dictionaries.
+    auto edit() -> std::vector<Entry>&;
+};
+
+/// Used to represent a value in the specification of a figure (e.g., a layout property or a trace attribute).
+class Value
+{
+public:
+    /// The type of the variant holding the value.
+    using Variant = std::variant<std::nullptr_t, bool, long long, double, std::string, Column, List, Dict>;
+
+    /// Construct a null Value object.
+    Value() : var(nullptr) {}
+
+    /// Construct a null Value object.
+    Value(std::nullptr_t) : var(nullptr) {}
+
+    /// Construct a Value object with a boolean.
+    Value(bool value) : var(value) {}
+
+    /// Construct a Value object with an integer number.
+    template<typename T, std::enable_if_t<std::is_integral_v<T> && !std::is_same_v<T, bool>, int> = 0>
+    Value(T value) : var(static_cast<long long>(value)) {}
+
+    /// Construct a Value object with a floating-point number.
+    template<typename T, std::enable_if_t<std::is_floating_point_v<T>, int> = 0>
+    Value(T value) : var(static_cast<double>(value)) {}
+
+    /// Construct a Value object with a string.
+    Value(std::string value) : var(std::move(value)) {}
+
+    /// Construct a Value object with a string.
+    Value(char const* value) : var(std::string(value)) {}
+
+    /// Construct a Value object with a list of strings.
+    Value(std::vector<std::string> const& values) : var(List(values.begin(), values.end())) {}
+
+    /// Construct a Value object with a data column.
+    Value(Column value) : var(std::move(value)) {}
+
+    /// Construct a Value object with a list of values.
+    Value(List value) : var(std::move(value)) {}
+
+    /// Construct a Value object with a dictionary of values.
+    Value(Dict value) : var(std::move(value)) {}
+
+    /// Return true if the value is of type @p T (e.g., `double`, `std::string`, `Dict`).
+    template<typename T>
+    auto is() const -> bool { return std::holds_alternative<T>(var); }
+
+    /// Return the value as type @p T, which must be the type of the value.
+    template<typename T>
+    auto as() const -> T const& { return std::get<T>(var); }
+
+    /// Return the variant holding the value.
+    auto variant() const -> Variant const& { return var; }
+
+    /// Return true if this value is equal to another.
+    auto operator==(Value const& other) const -> bool;
+
+    /// Return true if this value is different from another.
+    auto operator!=(Value const& other) const -> bool { return !(*this == other); }
+
+private:
+    /// The variant holding the value.
+    Variant var;
+};
+
+inline Dict::Dict(std::initializer_list<Entry> entries)
+{
+    for(auto const& [key, value] : entries)
+        set(key, value);
+}
+
+inline auto Dict::items() const -> std::vector<Entry> const&
+{
+    static std::vector<Entry> const none;
+    return entries ? *entries : none;
+}
+
+inline auto Dict::edit() -> std::vector<Entry>&
+{
+    if(!entries)
+        entries = std::make_shared<std::vector<Entry>>();
+    else if(entries.use_count() > 1)
+        entries = std::make_shared<std::vector<Entry>>(*entries);
+    return *entries;
+}
+
+inline auto Dict::shares(Dict const& other) const -> bool
+{
+    return entries != nullptr && entries.get() == other.entries.get();
+}
+
+inline auto Dict::set(std::string const& key, Value value) -> void
+{
+    for(auto& entry : edit())
+        if(entry.first == key)
+        {
+            entry.second = std::move(value);
+            return;
+        }
+    entries->emplace_back(key, std::move(value));
+}
+
+inline auto Dict::update(Dict const& other) -> void
+{
+    for(auto const& [key, value] : other)
+        set(key, value);
+}
+
+inline auto Dict::find(std::string const& key) const -> Value const*
+{
+    for(auto const& entry : items())
+        if(entry.first == key)
+            return &entry.second;
+    return nullptr;
+}
+
+inline auto Dict::erase(std::string const& key) -> void
+{
+    if(!find(key))
+        return;
+    auto& items = edit();
+    for(auto it = items.begin(); it != items.end(); ++it)
+        if(it->first == key)
+        {
+            items.erase(it);
+            return;
+        }
+}
+
+inline auto Dict::operator==(Dict const& other) const -> bool
+{
+    if(shares(other))
+        return true;
+    if(size() != other.size())
+        return false;
+    for(auto const& [key, value] : items())
+        if(auto const* found = other.find(key); !found || *found != value)
+            return false;
+    return true;
+}
+
+inline auto Value::operator==(Value const& other) const -> bool
+{
+    return var == other.var;
+}
+
+/// Return a dictionary with plotly's magic underscore keys expanded into nested dictionaries.
+/// For example, `{"title_text": "A", "title_font_size": 20}` becomes `{"title": {"text": "A", "font": {"size": 20}}}`.
+/// Later keys take precedence over earlier ones, with dictionaries being merged as in plotly's `update_layout`. As in
+/// plotly, a string title is the text of the title (e.g., `{"title": "A", "title_font_size": 20}` gives the same as above).
+/// The property names `paper_bgcolor` and `plot_bgcolor`, which contain an underscore, are not split.
+/// An exception is thrown if a key nests under a name with a value that is neither a dictionary nor a title.
+inline auto nested(Dict const& dict) -> Dict;
+
+namespace detail {
+
+/// Return a value given to a property, with a string title turned into a dictionary with the text of the title.
+inline auto expanded(std::string const& name, Value const& value) -> Value
+{
+    return name == "title" && value.is<std::string>() ? Value(Dict{{"text", value}}) : value;
+}
+
+/// Return the error thrown when a key nests under a name with a value that is not a dictionary.
+inline auto notDict(std::string const& key, std::string const& name) -> std::runtime_error
+{
+    return std::runtime_error("Could not set " + key + " because " + name + " has a value that is not a dictionary.");
+}
+
+/// Set an entry of a dictionary, merging dictionaries recursively with the one already there.
+inline auto merge(Dict& dict, std::string const& name, Value const& given, std::string const& key) -> void
+{
+    auto const value = expanded(name, given);
+    auto const* found = dict.find(name);
+    auto const current = found ? expanded(name, *found) : Value();
+    if(value.is<Dict>() && current.is<Dict>())
+    {
+        Dict child = current.as<Dict>();
+        for(auto const& [k, v] : value.as<Dict>())
+            merge(child, k, v, key);
+        dict.set(name, std::move(child));
+    }
+    else if(value.is<Dict>() && !current.is<std::nullptr_t>())
+        throw notDict(key, name);
+    else dict.set(name, value);
+}
+
+/// Assign a value to the entry at a given path in a dictionary, creating or merging nested dictionaries as needed.
+inline auto assign(Dict& dict, std::vector<std::string> const& path, std::size_t i, Value const& value, std::string const& key) -> void
+{
+    if(i + 1 < path.size())
+    {
+        auto const* found = dict.find(path[i]);
+        auto const current = found ? expanded(path[i], *found) : Value();
+        if(!current.is<Dict>() && !current.is<std::nullptr_t>())
+            throw notDict(key, path[i]);
+        Dict child = current.is<Dict>() ? current.as<Dict>() : Dict();
+        assign(child, path, i + 1, value, key);
+        dict.set(path[i], std::move(child));
+    }
+    else merge(dict, path[i], value.is<Dict>() ? Value(nested(value.as<Dict>())) : value, key);
+}
+
+} // namespace detail
+
+inline auto nested(Dict const& dict) -> Dict
+{
+    Dict result;
+    std::vector<std::string> path;
+    for(auto const& [key, value] : dict)
+    {
+        path.clear();
+        if(key == "paper_bgcolor" || key == "plot_bgcolor")
+            path.push_back(key);
+        else for(std::size_t begin = 0, end = 0; end != std::string::npos; begin = end + 1)
+        {
+            end = key.find('_', begin);
+            path.push_back(key.substr(begin, end == std::string::npos ? end : end - begin));
+        }
+        detail::assign(result, path, 0, value, key);
+    }
+    return result;
+}
+
+} // namespace reaktplot
@@ -0,0 +1,283 @@
+// reaktplot - a modern C++ scientific plotting library powered by plotly
+// https://github.com/reaktplot/reaktplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2022-2023 Allan Leal
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+// NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include "Video.hpp"
+
+// C++ includes
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <condition_variable>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <spawn.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include <unistd.h>
+extern char** environ;
+#endif
+
+// reaktplot includes
+#include <reaktplot/Png.hpp>
+#include <reaktplot/Renderer.hpp>
+
+namespace reaktplot {
+
+struct VideoWriter::Data
+{
+    /// The name of the video file.
+    std::string file;
+
+    /// The options of the writer.
+    VideoOptions options;
+
+    /// Whether frames are sent as raw RGBA pixels rasterized natively (otherwise as PNG images rendered by plotly).
+    bool raw = false;
+
+    /// The canvas on which frames are rasterized natively (reused for all frames).
+    std::unique_ptr<PngCanvas> canvas;
+
+#if !defined(_WIN32)
+    /// The id of the ffmpeg process.
+    pid_t pid = 0;
+#endif
+
+    /// The socket connected to the standard input of the ffmpeg process, or -1 if not started.
+    int fd = -1;
+
+    /// The thread sending the frames to the ffmpeg process.
+    std::thread thread;
+
+    /// The mutex protecting the members below.
+    std::mutex mutex;
+
+    /// The condition variable notified when a frame is queued or sent, or the writer is closing.
+    std::condition_variable changed;
+
+    /// The frames waiting to be sent to the ffmpeg process.
+    std::deque<std::string> frames;
+
+    /// The number of frames written so far.
+    std::size_t count = 0;
+
+    /// The flag indicating the thread should stop once all frames are sent.
+    bool closing = false;
+
+    /// The error that occurred while sending frames to the ffmpeg process, if any.
+    std::exception_ptr error;
+
+    /// Start the ffmpeg process for frames with given size (in pixels).
+    auto start(int width, int height) -> void
+    {
+#if defined(_WIN32)
+        throw std::runtime_error("Could not write video file " + file + ": ffmpeg processes are only supported on POSIX systems.");
+#else
+        auto ext = file.substr(file.find_last_of('.') + 1);
+        std::transform(ext.begin(), ext.end(), ext.begin(), [](unsigned char c) { return std::tolower(c); });
+
+        auto ffmpeg = options.ffmpeg;
+        if(ffmpeg.empty())
+            if(auto const env = std::getenv("REAKTPLOT_FFMPEG"))
+                ffmpeg = env;
+        if(ffmpeg.empty())
+            ffmpeg = "ffmpeg";
+
+        auto codec = options.codec;
+        if(codec.empty())
+            codec = ext == "mp4" ? "libx264" : ext == "webm" ? "libvpx-vp9" : "";
+
+        std::vector<std::string> command = { ffmpeg, "-y", "-loglevel", "error" };
+        if(raw)
+            command.insert(command.end(), { "-f", "rawvideo", "-pix_fmt", "rgba", "-s", std::to_string(width) + "x" + std::to_string(height) });
+        else command.insert(command.end(), { "-f", "image2pipe", "-c:v", "png" });
+        command.insert(command.end(), { "-framerate", std::to_string(options.fps), "-i", "-" });
+        if(ext == "mp4" || ext == "webm") // most players only support these with 4:2:0 chroma, which requires even sizes
+            command.insert(command.end(), { "-vf", "pad=ceil(iw/2)*2:ceil(ih/2)*2", "-pix_fmt", "yuv420p" });
+        if(!codec.empty())
+            command.insert(command.end(), { "-c:v", codec });
+        command.push_back(file);
+
+        int fds[2];
+        if(socketpair(AF_UNIX, SOCK_STREAM, 0, fds) != 0)
+            throw std::runtime_error("Could not create socket for ffmpeg: " + std::string(std::strerror(errno)));
+        fcntl(fds[0], F_SETFD, FD_CLOEXEC); // not inherited by other processes, which would keep the input of ffmpeg open
+        fcntl(fds[1], F_SETFD, FD_CLOEXEC);
+        std::vector<char*> argv;
+        for(auto const& arg : command)
+            argv.push_back(const_cast<char*>(arg.c_str()));
+        argv.push_back(nullptr);
+        posix_spawn_file_actions_t actions;
+        posix_spawn_file_actions_init(&actions);
+        posix_spawn_file_actions_adddup2(&actions, fds[1], 0);
+        posix_spawn_file_actions_addclose(&actions, fds[0]);
+        posix_spawn_file_actions_addclose(&actions, fds[1]);
+        auto const status = posix_spawnp(&pid, argv[0], &actions, nullptr, argv.data(), environ);
+        posix_spawn_file_actions_destroy(&actions);
+        ::close(fds[1]);
+        if(status != 0)
+        {
+            ::close(fds[0]);
+            throw std::runtime_error("Could not start " + ffmpeg + " to write video file " + file + ": " + std::strerror(status));
+        }
+        fd = fds[0];
+        thread = std::thread([this] { run(); });
+#endif
+    }
+
+    /// Send the queued frames to the ffmpeg process until the writer is closing.
+    auto run() -> void
+    {
+        while(true)
+        {
+            std::string frame;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                changed.wait(lock, [&] { return !frames.empty() || closing; });
+                if(frames.empty())
+                    return;
+                frame = std::move(frames.front());
+                frames.pop_front();
+            }
+            changed.notify_all();
+            if(!error && !send(frame))
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                error = std::make_exception_ptr(std::runtime_error("Could not write video file " + file + ": ffmpeg exited unexpectedly."));
+            }
+        }
+    }
+
+    /// Send a frame to the ffmpeg process and return false if the ffmpeg process exited.
+    auto send(std::string const& frame) -> bool
+    {
+#if !defined(_WIN32)
+        for(std::size_t sent = 0; sent < frame.size();)
+        {
+            auto const n = ::send(fd, frame.data() + sent, frame.size() - sent, MSG_NOSIGNAL);
+            if(n < 0 && errno == EINTR)
+                continue;
+            if(n <= 0)
+                return false;
+            sent += n;
+        }
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    /// Queue a frame to be sent to the ffmpeg process, blocking while the queue is at capacity.
+    auto push(std::string frame) -> void
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        changed.wait(lock, [&] { return frames.size() < std::max<std::size_t>(options.capacity, 1) || error; });
+        if(error)
+            std::rethrow_exception(error);
+        frames.push_back(std::move(frame));
+        ++count;
+        lock.unlock();
+        changed.notify_all();
+    }
+};
+
+VideoWriter::VideoWriter(std::string file, VideoOptions const& options)
+: data(new Data)
+{
+    data->file = std::move(file);
+    data->options = options;
+    data->raw = backend() == Backend::Native;
+    if(data->raw)
+        data->canvas = std::make_unique<PngCanvas>(options.scale);
+}
+
+VideoWriter::~VideoWriter()
+{
+    try { close(); } catch(...) {}
+}
+
+auto VideoWriter::write(Figure const& figure) -> void
+{
+    auto const& options = data->options;
+
+    std::string frame;
+    int width = 0, height = 0;
+
+    if(data->raw)
+    {
+        render(*data->canvas, figure.specs(), options.width, options.height);
+        auto const& pixels = data->canvas->pixels();
+        frame.assign(pixels.begin(), pixels.end());
+        width = data->canvas->width();
+        height = data->canvas->height();
+    }
+    else frame = figure.image("png", options.width, options.height, options.scale);
+
+    if(data->fd < 0)
+        data->start(width, height);
+
+    data->push(std::move(frame));
+}
+
+auto VideoWriter::writeFrames(Figure const& figure) -> void
+{
+    figure.eachFrame([&](Figure const& frame, std::size_t) { write(frame); });
+}
+
+auto VideoWriter::close() -> void
+{
+    if(data->fd < 0)
+        return;
+    {
+        std::lock_guard<std::mutex> lock(data->mutex);
+        data->closing = true;
+    }
+    data->changed.notify_all();
+    data->thread.join();
+#if !defined(_WIN32)
+    ::close(data->fd); // the end of the input, after which ffmpeg finishes the video file and exits
+    data->fd = -1;
+    int status = 0;
+    while(waitpid(data->pid, &status, 0) < 0 && errno == EINTR) {}
+    if(data->error)
+        std::rethrow_exception(std::exchange(data->error, nullptr));
+    if(!WIFEXITED(status) || WEXITSTATUS(status) != 0)
+        throw std::runtime_error("Could not write video file " + data->file + ": ffmpeg failed with exit status " + std::to_string(WEXITSTATUS(status)) + ".");
+#endif
+}
+
+auto VideoWriter::frames() const -> std::size_t
+{
+    std::lock_guard<std::mutex> lock(data->mutex);
+    return data->count;
+}
+
+} // namespace reaktplot
@@ -0,0 +1,96 @@
+// reaktplot - a modern C++ scientific plotting library powered by plotly
+// https://github.com/reaktplot/reaktplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2022-2023 Allan Leal
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+// NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#pragma once
+
+// C++ includes
+#include <cstddef>
+#include <memory>
+#include <string>
+
+// reaktplot includes
+#include <reaktplot/Default.hpp>
+#include <reaktplot/Figure.hpp>
+#include <reaktplot/Macros.hpp>
+
+namespace reaktplot {
+
+/// The options of a VideoWriter.
+struct VideoOptions
+{
+    /// The number of frames per second.
+    double fps = 10.0;
+
+    /// The width of the figure in each frame (in px).
+    int width = DEFAULT_FIGURE_WIDTH;
+
+    /// The height of the figure in each frame (in px).
+    int height = DEFAULT_FIGURE_HEIGHT;
+
+    /// The scaling factor applied to the figure in each frame.
+    double scale = DEFAULT_FIGURE_SCALE;
+
+    /// The video codec used by ffmpeg (empty means `libx264` for MP4 files, `libvpx-vp9` for WebM files, and the default of ffmpeg otherwise).
+    std::string codec;
+
+    /// The ffmpeg executable (empty means the environment variable `REAKTPLOT_FFMPEG`, or else `ffmpeg`).
+    std::string ffmpeg;
+
+    /// The number of rendered frames that can wait to be sent to ffmpeg before VideoWriter::write blocks.
+    std::size_t capacity = 4;
+};
+
+/// Used to produce a video file (e.g., MP4 or WebM) from figures rendered one by one, without any intermediate files.
+/// Each figure written is rendered as a frame and sent over a pipe to an ffmpeg process, which encodes the video as the
+/// frames arrive. Frames are sent by a background thread, so that rendering the next frame (or computing it, e.g., in a
+/// time-stepping loop) overlaps with encoding the previous ones. With Backend::Native (see @ref setBackend), frames are
+/// rasterized natively and sent as raw RGBA pixels; otherwise they are rendered by plotly and sent as PNG images.
+/// The ffmpeg process is started with the first frame. Only available on POSIX systems.
+class RKP_EXPORT VideoWriter
+{
+public:
+    /// Construct a VideoWriter object that writes a video file once frames are written.
+    explicit VideoWriter(std::string file, VideoOptions const& options = {});
+
+    /// Destroy this VideoWriter object after finishing the video file (see @ref close), ignoring any error.
+    ~VideoWriter();
+
+    /// Render a figure and add it as the next frame of the video, blocking if too many frames are waiting for ffmpeg.
+    auto write(Figure const& figure) -> void;
+
+    /// Add the frames of an animated figure to the video (see Figure::beginFrame).
+    auto writeFrames(Figure const& figure) -> void;
+
+    /// Wait until ffmpeg has encoded all frames and finished the video file, throwing an error if it failed.
+    auto close() -> void;
+
+    /// Return the number of frames written so far.
+    auto frames() const -> std::size_t;
+
+private:
+    struct Data;
+
+    /// The implementation details of the writer, shared with its thread.
+    std::unique_ptr<Data> data;
+};
+
+} // namespace reaktplot
@@ -23,9 +23,31 @@
 #pragma once
 
 // reaktplot includes
+#include <reaktplot/Animation.hpp>
 #include <reaktplot/Array.hpp>
+#include <reaktplot/Canvas.hpp>
+#include <reaktplot/Column.hpp>
+#include <reaktplot/Compression.hpp>
 #include <reaktplot/Constants.hpp>
 #include <reaktplot/Default.hpp>
+#include <reaktplot/DefaultTheme.hpp>
+#include <reaktplot/Executor.hpp>
 #include <reaktplot/Figure.hpp>
+#include <reaktplot/Font.hpp>
+#include <reaktplot/Html.hpp>
+#include <reaktplot/Json.hpp>
+#include <reaktplot/Pdf.hpp>
+#include <reaktplot/Png.hpp>
+#include <reaktplot/Pythonic.hpp>
+#include <reaktplot/Queue.hpp>
+#include <reaktplot/RenderCache.hpp>
+#include <reaktplot/RenderPool.hpp>
+#include <reaktplot/RenderSession.hpp>
+#include <reaktplot/Renderer.hpp>
 #include <reaktplot/Specs.hpp>
+#include <reaktplot/Svg.hpp>
+#include <reaktplot/Tiff.hpp>
+#include <reaktplot/Tiles.hpp>
 #include <reaktplot/Utils.hpp>
+#include <reaktplot/Value.hpp>
+#include <reaktplot/Video.hpp>
@@ -0,0 +1,145 @@
+// reaktplot - a modern C++ scientific plotting library powered by plotly
+// https://github.com/reaktplot/reaktplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2022-2023 Allan Leal
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+// NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+// Catch includes
+#include <catch2/catch.hpp>
+
+// C++ includes
+#include <cmath>
+#include <limits>
+#include <sstream>
+#include <vector>
+
+// reaktplot includes
+#include <reaktplot/Animation.hpp>
+#include <reaktplot/Figure.hpp>
+#include <reaktplot/Html.hpp>
+using namespace reaktplot;
+
+TEST_CASE("Testing encodeDelta and applyDelta", "[Animation]")
+{
+    auto const nan = std::numeric_limits<double>::quiet_NaN();
+
+    Column const before({ 1.0, 2.0, nan, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0, 10.0, 11.0, 12.0 }, 3, 4);
+    Column const after({ 1.0, 2.0, nan, 0.0, 0.0, 6.0, 7.0, 8.0, 9.0, 10.0, 11.0, -1.0 }, 3, 4);
+
+    auto const delta = encodeDelta(before, after, 0.75);
+    REQUIRE( delta );
+    CHECK( delta->ranges == std::vector<std::size_t>{ 3, 5, 11, 12 } );
+    CHECK( delta->values == std::vector<double>{ 0.0, 0.0, -1.0 } );
+
+    auto const column = applyDelta(before, *delta);
+    CHECK( column.rows() == 3 );
+    CHECK( column.cols() == 4 );
+    CHECK( std::isnan(column.numbers()[2]) );
+    CHECK( column.numbers()[3] == 0.0 );
+    CHECK( column.numbers()[11] == -1.0 );
+
+    CHECK_FALSE( encodeDelta(before, after, 0.5) ); // 4 range positions and 3 values take more than half of 12
+    CHECK_FALSE( encodeDelta(before, Column({ 1.0, 2.0 }), 1.0) );
+    CHECK_FALSE( encodeDelta(before, Column(std::vector<std::string>{ "a" }), 1.0) );
+}
+
+TEST_CASE("Testing frames stored as deltas", "[Animation]")
+{
+    std::vector<double> const x = { 0.0, 1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0 };
+    std::vector<std::vector<double>> z(10, std::vector<double>(10, 0.0));
+
+    Figure fig;
+    fig.drawContour(x, x, z);
+
+    for(int i = 0; i < 40; ++i)
+    {
+        z[i / 10][i % 10] = i + 1.0; // one more cell changes in each frame
+        fig.beginFrame();
+        fig.drawContour(x, x, z);
+        fig.endFrame();
+
+        auto const frame = fig.frame(i);
+        REQUIRE( *frame.traces[0].find("z") == Value(column(z)) );
+    }
+
+    auto const& frames = fig.specs().frames;
+
+    CHECK( frames[0].traces[0].find("z") == nullptr );
+    REQUIRE( frames[0].deltas.size() == 1 );
+    CHECK( frames[0].deltas[0].key == "z" );
+    CHECK( frames[0].deltas[0].keyframe == -1 );
+    CHECK( frames[0].deltas[0].values == std::vector<double>{ 1.0 } );
+
+    std::ptrdiff_t keyframe = -1; // the frames whose changes from their keyframe take more than a quarter of z store it in full
+    for(std::size_t i = 0; i < frames.size(); ++i)
+    {
+        if(frames[i].deltas.empty())
+        {
+            CHECK( frames[i].traces[0].find("z") != nullptr );
+            keyframe = i;
+        }
+        else CHECK( frames[i].deltas[0].keyframe == keyframe );
+    }
+    CHECK( keyframe > 0 );
+
+    auto const played = playbackFrames(fig.specs(), 0, frames.size());
+    REQUIRE( played.size() == frames.size() );
+    CHECK( played[7].deltas.empty() );
+    CHECK( *played[7].traces[0].find("z") == Value(fig.frame(7).traces[0].find("z")->as<Column>()) );
+
+    HtmlOptions options;
+    options.mode = HtmlMode::Fragment; // the plotly.js bundle is not needed
+
+    std::ostringstream html;
+    writeHtml(html, fig.specs(), 800, 500, options);
+    CHECK( html.str().find(frameDeltaScript()) != std::string::npos );
+    CHECK( html.str().find("\"keyframe\":") != std::string::npos );
+
+    fig.clearFrames();
+    fig.setFrameDeltas(0.0);
+    fig.beginFrame();
+    fig.drawContour(x, x, z);
+    fig.endFrame();
+    CHECK( fig.specs().frames[0].deltas.empty() );
+    CHECK( fig.specs().frames[0].traces[0].find("z") != nullptr );
+}
+
+TEST_CASE("Testing playbackFrames", "[Animation]")
+{
+    std::vector<double> const x = { 0.0, 1.0, 2.0 };
+
+    Figure fig;
+    fig.setFrameDeltas(0.0);
+    fig.drawLine(x, x, "line");
+
+    fig.beginFrame();
+    fig.drawLine(x, x, "line");
+    fig.endFrame();
+
+    fig.beginFrame();
+    fig.drawLine(x, std::vector<double>{ 2.0, 1.0, 0.0 }, "line");
+    fig.endFrame();
+
+    auto const frames = playbackFrames(fig.specs(), 0, 2);
+    REQUIRE( frames.size() == 2 );
+    CHECK( fig.specs().frames[0].traces[0].find("y") == nullptr );
+    CHECK( *frames[0].traces[0].find("y") == *fig.specs().traces[0].find("y") ); // y is changed by the other frame
+    CHECK( frames[0].traces[0].find("x") == nullptr );
+    CHECK( playbackFrames(fig.specs(), 1, 5).size() == 1 );
+}
@@ -0,0 +1,69 @@
+// reaktplot - a modern C++ scientific plotting library powered by plotly
+// https://github.com/reaktplot/reaktplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2022-2023 Allan Leal
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+// NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+// Catch includes
+#include <catch2/catch.hpp>
+
+// reaktplot includes
+#include <reaktplot/Canvas.hpp>
+using namespace reaktplot;
+
+TEST_CASE("Testing Canvas", "[Canvas]")
+{
+    SECTION("Parsing colors")
+    {
+        auto const c = color("#1f77b4");
+        CHECK( int(c.r) == 0x1f );
+        CHECK( int(c.g) == 0x77 );
+        CHECK( int(c.b) == 0xb4 );
+        CHECK( c.a == 1.0 );
+
+        CHECK( int(color("#fff").g) == 255 );
+        CHECK( int(color("rgb(10, 20, 30)").b) == 30 );
+        CHECK( color("rgba(10, 20, 30, 0.5)").a == Approx(0.5) );
+        CHECK( int(color("red").r) == 255 );
+        CHECK( color("transparent").none() );
+    }
+
+    SECTION("Mixing colors")
+    {
+        auto const c = mix(color("#000"), color("#fff"), 0.5);
+        CHECK( int(c.r) == Approx(128).margin(1) );
+        CHECK( int(mix(color("#000"), color("#fff"), 0.0).r) == 0 );
+    }
+
+    SECTION("Dashed lines")
+    {
+        CHECK( dashes("solid", 2.0).empty() );
+        CHECK( dashes("dot", 2.0) == std::vector<double>{3.0, 3.0} );
+        CHECK( dashes("5px,10px,2px", 2.0) == std::vector<double>{5.0, 10.0, 2.0} );
+
+        auto const pieces = dashed({{0.0, 0.0}, {10.0, 0.0}}, {3.0, 2.0});
+        REQUIRE( pieces.size() == 2 );
+        CHECK( pieces[0].front().x == 0.0 );
+        CHECK( pieces[0].back().x == 3.0 );
+        CHECK( pieces[1].front().x == 5.0 );
+        CHECK( pieces[1].back().x == 8.0 );
+
+        CHECK( dashed({{0.0, 0.0}, {10.0, 0.0}}, {}).size() == 1 );
+    }
+}
@@ -0,0 +1,65 @@
+// reaktplot - a modern C++ scientific plotting library powered by plotly
+// https://github.com/reaktplot/reaktplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2022-2023 Allan Leal
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+// NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+// Catch includes
+#include <catch2/catch.hpp>
+
+// C++ includes
+#include <cmath>
+
+// reaktplot includes
+#include <reaktplot/Array.hpp>
+#include <reaktplot/Column.hpp>
+using namespace reaktplot;
+
+TEST_CASE("Testing Column", "[Column]")
+{
+    Column a = column(std::vector<double>{1.0, 2.0, 3.0});
+
+    CHECK( a.size() == 3 );
+    CHECK( a.isMatrix() == false );
+    CHECK( a.isStrings() == false );
+    CHECK( a.numbers() == std::vector<double>{1.0, 2.0, 3.0} );
+
+    Column b = a; // copies share the data
+
+    CHECK( b.shares(a) );
+    CHECK( b == a );
+    CHECK( column(b).shared() == a.shared() ); // no copy when handing over a column
+
+    Array x = linspace(0.0, 1.0, 5);
+
+    CHECK( column(x).size() == 6 );
+    CHECK( column(x * x).numbers()[5] == 1.0 );
+
+    Column m = column(std::vector<std::vector<double>>{{1.0, 2.0}, {3.0}});
+
+    CHECK( m.isMatrix() );
+    CHECK( m.rows() == 2 );
+    CHECK( m.cols() == 2 );
+    CHECK( std::isnan(m.numbers()[3]) ); // shorter rows are padded
+
+    Column s = column(std::vector<std::string>{"a", "b"});
+
+    CHECK( s.isStrings() );
+    CHECK( s.strings() == std::vector<std::string>{"a", "b"} );
+}
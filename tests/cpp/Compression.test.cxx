@@ -0,0 +1,96 @@
+// reaktplot - a modern C++ scientific plotting library powered by plotly
+// https://github.com/reaktplot/reaktplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2022-2023 Allan Leal
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+// NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+// Catch includes
+#include <catch2/catch.hpp>
+
+// C++ includes
+#include <exception>
+#include <fstream>
+#include <iterator>
+#include <string>
+
+// reaktplot includes
+#include <reaktplot/Compression.hpp>
+using namespace reaktplot;
+
+TEST_CASE("Testing compression", "[Compression]")
+{
+    CHECK( compression("fig.json") == Compression::None );
+    CHECK( compression("fig.json.gz") == Compression::Gzip );
+    CHECK( compression("fig.json.zst") == Compression::Zstd );
+    CHECK( uncompressed("fig.json.zst") == "fig.json" );
+    CHECK( uncompressed("fig.json") == "fig.json" );
+}
+
+TEST_CASE("Testing CompressedOutput and CompressedInput", "[Compression]")
+{
+    std::string text;
+    for(int i = 0; i < 200000; ++i)
+        text += std::to_string(i * 0.5) + ",";
+
+    auto const roundtrip = [&](std::string const& file, CompressionOptions const& options)
+    {
+        {
+            CompressedOutput out(file, options);
+            out << text;
+            out.close();
+        }
+        CompressedInput in(file);
+        return std::string(std::istreambuf_iterator<char>(in), {});
+    };
+
+    auto const size = [](std::string const& file)
+    {
+        return static_cast<std::size_t>(std::ifstream(file, std::ios::binary | std::ios::ate).tellg());
+    };
+
+    CHECK( roundtrip("compressed.json", {}) == text );
+    CHECK( size("compressed.json") == text.size() );
+
+    CompressionOptions parallel;
+    parallel.threads = 4;
+    parallel.blocksize = 1 << 16; // many blocks compressed by several threads
+
+    auto const available = [](std::string const& file) // zlib and libzstd are optional dependencies
+    {
+        try { CompressedOutput out(file); return true; }
+        catch(std::exception const&) { return false; }
+    };
+
+    if(available("compressed.json.gz"))
+    {
+        CHECK( roundtrip("compressed.json.gz", {}) == text );
+        CHECK( size("compressed.json.gz") < text.size() / 2 );
+        CHECK( roundtrip("compressed-parallel.json.gz", parallel) == text );
+        CHECK( size("compressed-parallel.json.gz") < text.size() / 2 );
+    }
+
+    if(available("compressed.json.zst"))
+    {
+        CHECK( roundtrip("compressed.json.zst", {}) == text );
+        CHECK( size("compressed.json.zst") < text.size() / 2 );
+        CHECK( roundtrip("compressed-parallel.json.zst", parallel) == text );
+    }
+
+    CHECK_THROWS( CompressedInput("missing.json.gz") );
+}
@@ -0,0 +1,69 @@
+// reaktplot - a modern C++ scientific plotting library powered by plotly
+// https://github.com/reaktplot/reaktplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2022-2023 Allan Leal
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+// NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+// Catch includes
+#include <catch2/catch.hpp>
+
+// C++ includes
+#include <chrono>
+#include <stdexcept>
+#include <vector>
+
+// reaktplot includes
+#include <reaktplot/Executor.hpp>
+using namespace reaktplot;
+
+TEST_CASE("Testing Executor", "[Executor]")
+{
+    std::vector<int> order;
+
+    {
+        Executor executor;
+
+        CHECK( executor.numthreads() == 1 );
+
+        auto answer = executor.submit([] { return 42; });
+        auto failure = executor.submit([]() -> int { throw std::runtime_error("failure"); });
+
+        for(int i = 0; i < 100; ++i)
+            executor.post([&order, i] { order.push_back(i); });
+
+        CHECK( answer.get() == 42 );
+        CHECK_THROWS_AS( failure.get(), std::runtime_error );
+    } // all tasks are run before the executor is destroyed
+
+    REQUIRE( order.size() == 100 );
+    for(int i = 0; i < 100; ++i)
+        CHECK( order[i] == i );
+
+    SECTION("Stopping an executor")
+    {
+        Executor executor;
+        auto answer = executor.submit([] { return 42; });
+        executor.stop(); // runs the tasks submitted so far
+        CHECK( answer.wait_for(std::chrono::seconds(0)) == std::future_status::ready );
+        CHECK( answer.get() == 42 );
+        executor.stop(); // nothing happens once stopped
+    }
+
+    CHECK( executor().numthreads() == 1 );
+}
@@ -23,9 +23,17 @@
 // Catch includes
 #include <catch2/catch.hpp>
 
+// C++ includes
+#include <exception>
+#include <fstream>
+#include <iterator>
+#include <string>
+
 // reaktplot includes
 #include <reaktplot/Array.hpp>
 #include <reaktplot/Figure.hpp>
+#include <reaktplot/Json.hpp>
+#include <reaktplot/Renderer.hpp>
 using namespace reaktplot;
 
 TEST_CASE("Testing Figure", "[Figure]")
@@ -50,3 +58,166 @@ TEST_CASE("Testing Figure", "[Figure]")
 
     CHECK_NOTHROW( fig.save("fig.pdf") );
 }
+
+TEST_CASE("Testing Figure::clearTraces and Figure::reset", "[Figure]")
+{
+    Figure fig;
+
+    Array x = linspace(0.0, 1.0, 10);
+
+    fig.title("TITLE");
+    fig.drawLine(x, x, "u");
+
+    CHECK_NOTHROW( fig.save("fig-reuse-1.svg") );
+
+    fig.clearTraces();
+
+    CHECK( fig.specs().traces.empty() );
+    CHECK( fig.specs().layout.find("title_text") ); // layout is kept
+
+    fig.drawLine(x, x * x, "v");
+
+    CHECK( fig.specs().traces.size() == 1 );
+    CHECK_NOTHROW( fig.save("fig-reuse-2.svg") );
+
+    fig.reset();
+
+    CHECK( fig.specs().traces.empty() );
+    CHECK( fig.specs().layout.empty() );
+}
+
+TEST_CASE("Testing Figure::clone", "[Figure]")
+{
+    Figure fig;
+
+    Array x = linspace(0.0, 1.0, 10);
+
+    fig.title("TEMPLATE");
+    fig.xaxisTitle("x");
+    fig.drawLine(x, x, "reference");
+
+    Figure variant = fig.clone();
+
+    CHECK( variant.specs().layout.shares(fig.specs().layout) );
+    CHECK( variant.specs().traces[0].shares(fig.specs().traces[0]) );
+
+    variant.title("VARIANT");
+    variant.drawLine(x, x * x, "variant");
+
+    CHECK_FALSE( variant.specs().layout.shares(fig.specs().layout) );
+    CHECK( variant.specs().xaxis.shares(fig.specs().xaxis) ); // unmodified parts remain shared
+    CHECK( variant.specs().traces[0].shares(fig.specs().traces[0]) );
+    CHECK( fig.specs().layout.find("title_text")->as<std::string>() == "TEMPLATE" );
+    CHECK( fig.specs().traces.size() == 1 );
+
+    CHECK_NOTHROW( variant.save("fig-clone.svg") );
+}
+
+TEST_CASE("Testing Figure::saveAsync", "[Figure]")
+{
+    Figure fig;
+
+    Array x = linspace(0.0, 1.0, 10);
+
+    fig.drawLine(x, x, "first");
+
+    auto json = fig.saveAsync("fig-async.json"); // saved natively in the background
+    auto svg = fig.saveAsync("fig-async.svg"); // rendered by plotly in the background
+
+    fig.drawLine(x, x * x, "second"); // does not affect the files being saved
+
+    CHECK_NOTHROW( json.get() );
+    CHECK_NOTHROW( svg.get() );
+
+    std::ifstream file("fig-async.json");
+    std::string const text((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    CHECK( text.find("first") != std::string::npos );
+    CHECK( text.find("second") == std::string::npos );
+
+    CHECK_NOTHROW( fig.save("fig-async-after.svg") ); // waits for the background handover before its own
+
+    CHECK_THROWS( fig.saveAsync("missing-directory/fig-async.json").get() );
+}
+
+TEST_CASE("Testing Figure::saveAll", "[Figure]")
+{
+    Figure fig;
+
+    Array x = linspace(0.0, 1.0, 10);
+
+    fig.drawLine(x, x, "line");
+
+    CHECK_NOTHROW( fig.saveAll({ "fig-all.json", "fig-all.svg", "fig-all.pdf", { "fig-all-thumbnail.png", 160, 100 } }) );
+
+    for(auto const& file : { "fig-all.json", "fig-all.svg", "fig-all.pdf", "fig-all-thumbnail.png" })
+        CHECK( std::ifstream(file).good() );
+}
+
+TEST_CASE("Testing Figure::load", "[Figure]")
+{
+    Figure fig;
+    fig.title("TITLE");
+    fig.drawLine(std::vector<double>{0.0, 1.0}, std::vector<double>{1.0, 2.0}, "line");
+
+    for(auto const file : { "fig-load.json", "fig-load.json.gz", "fig-load.json.zst" })
+    {
+        try { fig.save(file); }
+        catch(std::exception const&) { continue; } // zlib and libzstd are optional dependencies
+
+        auto const loaded = Figure::load(file);
+        CHECK( toJson(loaded.specs()) == toJson(fig.specs()) );
+    }
+
+    CHECK_THROWS( Figure::load("fig-missing.json") );
+}
+
+TEST_CASE("Testing Figure frames", "[Figure]")
+{
+    Figure fig;
+
+    Array x = linspace(0.0, 1.0, 10);
+
+    fig.title("animation");
+    fig.drawLine(x, x, "line");
+
+    for(int i = 1; i <= 3; ++i)
+    {
+        fig.beginFrame();
+        fig.drawLine(x, x * double(i + 1), "line");
+        fig.endFrame();
+    }
+
+    fig.drawMarkers(x, x, "markers"); // added to the figure, not to a frame
+
+    REQUIRE( fig.specs().frames.size() == 3 );
+    CHECK( fig.specs().traces.size() == 2 );
+    CHECK( fig.specs().frames[1].name == "1" );
+
+    auto const& trace = fig.specs().frames[0].traces[0];
+    CHECK( trace.find("type") != nullptr );
+    CHECK( trace.find("y") != nullptr );
+    CHECK( trace.find("x") == nullptr ); // the same as in the figure, so not stored in the frame
+    CHECK( trace.find("name") == nullptr );
+
+    auto const frame = fig.frame(2);
+    CHECK( frame.traces.size() == 2 );
+    CHECK( *frame.traces[0].find("x") == *fig.specs().traces[0].find("x") );
+    CHECK( *frame.traces[0].find("y") == Value(column(x * 4.0)) );
+
+    auto const json = toJson(fig.specs());
+    CHECK( json.find("\"frames\":") != std::string::npos );
+    CHECK( json.find("\"sliders\":") != std::string::npos );
+
+    auto const previous = backend();
+    setBackend(Backend::Native);
+    auto const files = fig.saveFrames("fig-frames.svg");
+    setBackend(previous);
+
+    REQUIRE( files.size() == 3 );
+    CHECK( files[0] == "fig-frames-000.svg" );
+    CHECK( std::ifstream(files[2]).good() );
+
+    fig.clearFrames();
+    CHECK( fig.specs().frames.empty() );
+    CHECK( toJson(fig.specs()).find("\"frames\":") == std::string::npos );
+}
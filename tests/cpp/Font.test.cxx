@@ -0,0 +1,135 @@
+// reaktplot - a modern C++ scientific plotting library powered by plotly
+// https://github.com/reaktplot/reaktplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2022-2023 Allan Leal
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+// NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+// Catch includes
+#include <catch2/catch.hpp>
+
+// C++ includes
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <utility>
+
+// reaktplot includes
+#include <reaktplot/Font.hpp>
+using namespace reaktplot;
+
+TEST_CASE("Testing Font", "[Font]")
+{
+    SECTION("Decoding UTF-8 strings")
+    {
+        CHECK( decode("a1") == U"a1" );
+        CHECK( decode("−5") == U"−5" );
+        CHECK( decode("μ") == U"μ" );
+        CHECK( decode("\xff") == U"�" );
+    }
+
+    SECTION("Using the built-in font")
+    {
+        Font font;
+
+        CHECK( font.builtin() );
+        CHECK( font.index(U'A') != font.index(U'B') );
+        CHECK( font.index(U'−') == font.index(U'-') ); // the minus sign of tick labels
+        CHECK( font.index(U'中') == font.index(U'?') ); // characters not in the font
+
+        auto const& glyph = font.glyph(font.index(U'I'));
+        CHECK( glyph.advance > 0.0 );
+        CHECK( glyph.contours.size() == 7 + 2 + 2 ); // the squares of the 5x7 bitmap
+
+        CHECK( font.glyph(font.index(U' ')).contours.empty() );
+        CHECK( font.width("abc", 10.0) == Approx(3 * 10.0 * glyph.advance) );
+    }
+
+    SECTION("Loading a missing font file")
+    {
+        CHECK_THROWS( Font::load("missing-font-file.ttf") );
+    }
+
+    SECTION("Using the default font")
+    {
+        auto const& font = defaultFont();
+        auto const& glyph = font.glyph(font.index(U'O'));
+        CHECK( glyph.advance > 0.0 );
+        CHECK( glyph.contours.size() >= 2 ); // the outer and inner contours
+        CHECK( font.width("Hello", 12.0) > 0.0 );
+    }
+}
+
+TEST_CASE("Testing Font with malformed files", "[Font]")
+{
+    auto const be16 = [](std::string& bytes, unsigned value) { bytes += static_cast<char>(value >> 8 & 0xFF); bytes += static_cast<char>(value & 0xFF); };
+    auto const be32 = [&](std::string& bytes, std::uint32_t value) { be16(bytes, value >> 16); be16(bytes, value & 0xFFFF); };
+
+    // A font with two glyphs, the second a composite glyph cut right after the index of its component
+    std::string glyf;
+    be16(glyf, 0xFFFF); // -1 contours, i.e., a composite glyph
+    glyf += std::string(8, '\0'); // the bounding box
+    be16(glyf, 0x0002); // the arguments of the component are byte offsets, which are missing
+    be16(glyf, 0); // the index of the component
+
+    std::string head(54, '\0'), maxp, hhea(36, '\0'), hmtx, cmap, loca;
+    head[18] = 0x03; head[19] = static_cast<char>(0xE8); // 1000 units per em
+    head[51] = 1; // 32-bit offsets in the loca table
+    be32(maxp, 0x00005000);
+    be16(maxp, 2); // the number of glyphs
+    hhea[35] = 1; // the number of advances in the hmtx table
+    be32(hmtx, 500 << 16);
+    be32(cmap, 0); // no subtables
+    be32(loca, 0);
+    be32(loca, 0);
+    be32(loca, static_cast<std::uint32_t>(glyf.size()));
+
+    std::string bytes;
+    be32(bytes, 0x00010000);
+    be16(bytes, 7);
+    bytes += std::string(6, '\0');
+    auto offset = 12 + 7 * 16;
+    std::string data;
+    for(auto const& [tag, table] : { std::pair{"head", &head}, {"maxp", &maxp}, {"hhea", &hhea}, {"hmtx", &hmtx}, {"cmap", &cmap}, {"loca", &loca}, {"glyf", &glyf} })
+    {
+        bytes += tag;
+        be32(bytes, 0); // the checksum, which is not checked
+        be32(bytes, static_cast<std::uint32_t>(offset + data.size()));
+        be32(bytes, static_cast<std::uint32_t>(table->size()));
+        data += *table;
+    }
+    bytes += data; // the glyf table is the last one, so the glyph ends at the end of the file
+
+    auto const file = "reaktplot-test-malformed.ttf";
+    std::ofstream(file, std::ios::binary) << bytes;
+    auto const font = Font::load(file);
+    std::remove(file);
+
+    Glyph glyph;
+    CHECK_NOTHROW( glyph = font.glyph(1) );
+    CHECK( glyph.advance == 0.5 );
+    CHECK( glyph.contours.empty() );
+
+    // Truncated copies of the font are either rejected or parsed without reading past their end
+    for(auto const size : { std::size_t(20), bytes.size() - 3, bytes.size() - 1 })
+    {
+        std::ofstream(file, std::ios::binary) << bytes.substr(0, size);
+        try { Font::load(file).glyph(1); } catch(std::exception const&) {}
+        std::remove(file);
+    }
+}
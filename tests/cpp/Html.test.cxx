@@ -0,0 +1,116 @@
+// reaktplot - a modern C++ scientific plotting library powered by plotly
+// https://github.com/reaktplot/reaktplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2022-2023 Allan Leal
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+// NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+// Catch includes
+#include <catch2/catch.hpp>
+
+// C++ includes
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+// reaktplot includes
+#include <reaktplot/Figure.hpp>
+#include <reaktplot/Html.hpp>
+using namespace reaktplot;
+
+TEST_CASE("Testing writeHtml", "[Html]")
+{
+    std::ofstream("fake-plotly.min.js") << "/* plotly.js */";
+
+    HtmlOptions options;
+    options.plotlyjs = "fake-plotly.min.js";
+
+    CHECK( plotlyjs(options.plotlyjs) == "/* plotly.js */" );
+    CHECK_THROWS( plotlyjs("missing-plotly.min.js") );
+
+    Figure fig;
+
+    fig.title("</script>");
+    fig.drawLine(std::vector<double>{0.0, 1.0}, std::vector<double>{1.0, 2.0}, "u");
+
+    std::ostringstream out;
+    writeHtml(out, fig.specs(), 800, 500, options);
+
+    auto const html = out.str();
+
+    CHECK( html.find("<body>\n    <div>\n        <script") != std::string::npos );
+    CHECK( html.find("<script type=\"text/javascript\">/* plotly.js */</script>") != std::string::npos );
+    CHECK( html.find("style=\"height:500px; width:800px;\"") != std::string::npos );
+    CHECK( html.find("[{\"type\":\"scatter\",\"x\":[0,1],\"y\":[1,2]") != std::string::npos );
+    CHECK( html.find("\"title\":{\"text\":\"<\\/script>\"}") != std::string::npos );
+    CHECK( html.find("{\"responsive\": true});") != std::string::npos );
+}
+
+TEST_CASE("Testing HtmlMode", "[Html]")
+{
+    std::ofstream("fake-plotly.min.js") << "/* plotly.js */";
+
+    HtmlOptions options;
+    options.plotlyjs = "fake-plotly.min.js";
+
+    Figure fig;
+    fig.drawLine(std::vector<double>{0.0, 1.0}, std::vector<double>{1.0, 2.0}, "u");
+
+    auto const read = [](std::string const& file)
+    {
+        std::ostringstream ss;
+        ss << std::ifstream(file).rdbuf();
+        return ss.str();
+    };
+
+    SECTION("Using a shared plotly.js file")
+    {
+        options.mode = HtmlMode::Shared;
+
+        std::remove("plotly.min.js");
+
+        fig.save("fig-shared.html", options);
+
+        CHECK( read("plotly.min.js") == "/* plotly.js */" );
+        CHECK( read("fig-shared.html").find("<script src=\"plotly.min.js\"></script>") != std::string::npos );
+        CHECK( read("fig-shared.html").find("/* plotly.js */") == std::string::npos );
+
+        std::ofstream("other-plotly.min.js") << "/* plotly.JS */"; // another bundle with the same size
+
+        options.plotlyjs = "other-plotly.min.js";
+
+        fig.save("fig-shared-other.html", options);
+
+        CHECK( read("plotly.min.js") == "/* plotly.JS */" );
+    }
+
+    SECTION("Using fragments")
+    {
+        options.mode = HtmlMode::Fragment;
+
+        setHtmlOptions(options);
+
+        fig.save("fig-fragment.html");
+
+        setHtmlOptions({});
+
+        CHECK( htmlOptions().mode == HtmlMode::Standalone );
+        CHECK( read("fig-fragment.html").find("<html>") == std::string::npos );
+        CHECK( read("fig-fragment.html").find("Plotly.newPlot") != std::string::npos );
+    }
+}
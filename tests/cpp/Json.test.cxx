@@ -0,0 +1,200 @@
+// reaktplot - a modern C++ scientific plotting library powered by plotly
+// https://github.com/reaktplot/reaktplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2022-2023 Allan Leal
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+// NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+// Catch includes
+#include <catch2/catch.hpp>
+
+// C++ includes
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <sstream>
+
+// reaktplot includes
+#include <reaktplot/DefaultTheme.hpp>
+#include <reaktplot/Figure.hpp>
+#include <reaktplot/Json.hpp>
+using namespace reaktplot;
+
+TEST_CASE("Testing JsonWriter", "[Json]")
+{
+    auto const json = [](Value const& value, JsonOptions const& options = {})
+    {
+        std::ostringstream out;
+        JsonWriter(out, options).write(value);
+        return out.str();
+    };
+
+    CHECK( json(nullptr) == "null" );
+    CHECK( json(true) == "true" );
+    CHECK( json(42) == "42" );
+    CHECK( json(0.1) == "0.1" );
+    CHECK( json(1e300) == "1e+300" );
+    CHECK( json(std::numeric_limits<double>::quiet_NaN()) == "null" );
+    CHECK( json("a\"b\\c\n</script>") == R"("a\"b\\c\n<\/script>")" );
+    CHECK( json(List{1, "x"}) == R"([1,"x"])" );
+    CHECK( json(Dict{{"a", 1}, {"b", Dict{{"c", false}}}}) == R"({"a":1,"b":{"c":false}})" );
+    CHECK( json(column(std::vector<double>{1.0, 2.5})) == "[1,2.5]" );
+    CHECK( json(Column({1.0, 2.0, 3.0, 4.0}, 2, 2)) == "[[1,2],[3,4]]" );
+    CHECK( json(Column(std::vector<double>(), 0, 2)) == "[]" );
+    CHECK( json(column(std::vector<std::string>{"a", "b"})) == R"(["a","b"])" );
+
+    JsonOptions typed;
+    typed.typedarrays = true;
+
+    CHECK( json(column(std::vector<double>{1.0}), typed) == R"({"dtype":"f8","bdata":"AAAAAAAA8D8="})" );
+    CHECK( json(Column({1.0, 2.0}, 1, 2), typed) == R"({"dtype":"f8","bdata":"AAAAAAAA8D8AAAAAAAAAQA==","shape":"1, 2"})" );
+}
+
+TEST_CASE("Testing writeJson", "[Json]")
+{
+    Figure fig;
+
+    fig.title("TITLE");
+    fig.xaxisTitle("x");
+    fig.drawLine(std::vector<double>{0.0, 1.0}, std::vector<double>{1.0, 2.0}, "u");
+
+    Dict figure = plotlyFigure(fig.specs());
+
+    Dict const& layout = figure.find("layout")->as<Dict>();
+
+    CHECK( layout.find("title")->as<Dict>() == Dict{{"text", "TITLE"}} );
+    CHECK( layout.find("xaxis")->as<Dict>() == Dict{{"title", Dict{{"text", "x"}}}} );
+    CHECK( layout.find("template")->as<Dict>() == defaultTheme() );
+    CHECK( figure.find("data")->as<List>().size() == 1 );
+
+    JsonOptions options;
+    options.theme = false;
+
+    CHECK( toJson(fig.specs(), options) == R"({"data":[{"type":"scatter","x":[0,1],"y":[1,2],"name":"u","mode":"lines","line":{}}],"layout":{"title":{"text":"TITLE"},"xaxis":{"title":{"text":"x"}},"yaxis":{}}})" );
+
+    FigureSpecs specs = fig.specs();
+
+    specs.layout.set("template", "none");
+    CHECK( plotlyFigure(specs).find("layout")->as<Dict>().find("template") == nullptr );
+
+    specs.layout.set("template", "plotly_dark"); // only known to plotly in Python
+    CHECK_THROWS( plotlyFigure(specs) );
+
+    specs.layout.set("template", Dict{{"layout", Dict{{"font", Dict{{"size", 12}}}}}});
+    CHECK( plotlyFigure(specs).find("layout")->as<Dict>().find("template")->as<Dict>() == Dict{{"layout", Dict{{"font", Dict{{"size", 12}}}}}} );
+}
+
+TEST_CASE("Testing JsonReader", "[Json]")
+{
+    auto const read = [](std::string const& text)
+    {
+        std::istringstream in(text);
+        return JsonReader(in).read();
+    };
+
+    CHECK( read("null") == Value() );
+    CHECK( read(" true ") == Value(true) );
+    CHECK( read("-12") == Value(-12) );
+    CHECK( read("2.5e1") == Value(25.0) );
+    CHECK( read(R"("a\"bé\n")") == Value("a\"b\xc3\xa9\n") );
+    CHECK( read(R"({"a": {}, "b": [], "c": ["x", 1]})") == Value(Dict{{"a", Dict()}, {"b", List()}, {"c", List{"x", 1}}}) );
+
+    auto const numbers = read("[1, null, 2.5]");
+    REQUIRE( numbers.is<Column>() );
+    CHECK( numbers.as<Column>().size() == 3 );
+    CHECK( std::isnan(numbers.as<Column>().numbers()[1]) );
+
+    CHECK( read("[[1, 2], [3]]").as<Column>().isMatrix() );
+    CHECK( read("[[1, 2], [3]]").as<Column>().cols() == 2 );
+    CHECK( read(R"({"dtype":"f8","bdata":"AAAAAAAA8D8AAAAAAAAAQA==","shape":"1, 2"})") == Value(Column({1.0, 2.0}, 1, 2)) );
+    CHECK( read(R"({"dtype":"i2","bdata":"AQACAA=="})") == Value(Column({1.0, 2.0})) );
+
+    CHECK_THROWS( read("[1, 2") );
+    CHECK_THROWS( read("{\"a\" 1}") );
+    CHECK_THROWS( read("nul") );
+}
+
+TEST_CASE("Testing readJson", "[Json]")
+{
+    Figure fig;
+    fig.title("TITLE");
+    fig.drawContour(std::vector<double>{0.0, 1.0}, std::vector<double>{0.0, 1.0}, std::vector<std::vector<double>>{{1.0, 2.0}, {3.0, 4.0}});
+    fig.beginFrame("t = 1");
+    fig.drawContour(std::vector<double>{0.0, 1.0}, std::vector<double>{0.0, 1.0}, std::vector<std::vector<double>>{{5.0, 6.0}, {7.0, 8.0}});
+    fig.endFrame();
+
+    for(auto const typedarrays : { false, true })
+    {
+        JsonOptions options;
+        options.typedarrays = typedarrays;
+
+        auto const json = toJson(fig.specs(), options);
+
+        std::istringstream in(json);
+        auto const specs = readJson(in);
+
+        REQUIRE( specs.traces.size() == 1 );
+        CHECK( *specs.traces[0].find("z") == Value(Column({1.0, 2.0, 3.0, 4.0}, 2, 2)) );
+        REQUIRE( specs.frames.size() == 1 );
+        CHECK( specs.frames[0].name == "t = 1" );
+        CHECK( toJson(specs, options) == json );
+    }
+
+    // A matrix without rows keeps its shape (an empty list, as written by Python) when read back
+    FigureSpecs empty;
+    empty.traces.push_back(Dict{{"type", "contour"}, {"z", Column(std::vector<double>(), 0, 3)}});
+
+    auto const json = toJson(empty);
+    CHECK( json.find("\"z\":[]") != std::string::npos );
+
+    std::istringstream in(json);
+    CHECK( toJson(readJson(in)) == json );
+}
+
+TEST_CASE("Testing writeJson writes in blocks", "[Json]")
+{
+    /// An output stream buffer that counts the characters written to it and the largest block.
+    struct Sink : std::streambuf
+    {
+        std::size_t total = 0;
+        std::size_t largest = 0;
+        auto xsputn(char const*, std::streamsize count) -> std::streamsize override { total += count; largest = std::max<std::size_t>(largest, count); return count; }
+        auto overflow(int_type c) -> int_type override { ++total; return c; }
+    };
+
+    std::vector<double> x(200000);
+    for(std::size_t i = 0; i < x.size(); ++i)
+        x[i] = 0.5 * i;
+
+    Figure fig;
+    fig.drawLine(x, x, "line");
+    for(int i = 0; i < 3; ++i)
+    {
+        x[i] = -1.0;
+        fig.beginFrame();
+        fig.drawLine(x, x, "line");
+        fig.endFrame();
+    }
+
+    Sink sink;
+    std::ostream out(&sink);
+    writeJson(out, fig.specs());
+
+    CHECK( sink.total == toJson(fig.specs()).size() );
+    CHECK( sink.largest <= std::size_t(1) << 17 ); // the output reaches the stream in blocks, not as a whole
+}
@@ -0,0 +1,177 @@
+// reaktplot - a modern C++ scientific plotting library powered by plotly
+// https://github.com/reaktplot/reaktplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2022-2023 Allan Leal
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+// NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+// Catch includes
+#include <catch2/catch.hpp>
+
+// C++ includes
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+// reaktplot includes
+#include <reaktplot/Figure.hpp>
+#include <reaktplot/Pdf.hpp>
+#include <reaktplot/Renderer.hpp>
+using namespace reaktplot;
+
+namespace {
+
+/// Return the number of occurrences of a string in another.
+auto count(std::string const& str, std::string const& what) -> std::size_t
+{
+    std::size_t n = 0;
+    for(auto pos = str.find(what); pos != std::string::npos; pos = str.find(what, pos + 1))
+        ++n;
+    return n;
+}
+
+/// Check that every object in the cross-reference table of a PDF document starts at its recorded position.
+auto checkXref(std::string const& pdf) -> void
+{
+    auto const startxref = pdf.rfind("startxref\n");
+    REQUIRE( startxref != std::string::npos );
+    auto const xref = std::stoul(pdf.substr(startxref + 10));
+    REQUIRE( pdf.compare(xref, 5, "xref\n") == 0 );
+
+    std::istringstream in(pdf.substr(xref + 5));
+    std::size_t first = 0, size = 0;
+    in >> first >> size;
+    CHECK( first == 0 );
+    CHECK( pdf.find("/Size " + std::to_string(size) + " ") != std::string::npos );
+
+    std::string offset, generation, kind;
+    in >> offset >> generation >> kind; // the free entry of object 0
+    for(std::size_t id = 1; id < size; ++id)
+    {
+        in >> offset >> generation >> kind;
+        CHECK( kind == "n" );
+        CHECK( pdf.compare(std::stoul(offset), std::to_string(id).size() + 6, std::to_string(id) + " 0 obj") == 0 );
+    }
+}
+
+} // namespace
+
+TEST_CASE("Testing PdfCanvas", "[Pdf]")
+{
+    std::ostringstream out;
+    PdfCanvas canvas(out);
+
+    canvas.begin(800, 500);
+    canvas.rect({0, 0, 800, 500}, color("white"));
+    canvas.polyline({{10, 10}, {20, 20}, {30, 10}}, {color("rgba(255, 0, 0, 0.5)"), 2.0, {4.0, 2.0}});
+    canvas.circle({100, 100}, 5.0, color("blue"));
+    canvas.text({50, 50}, "x (−m)", {"Arial", 12.0, color("black"), Anchor::Middle, -90.0});
+    canvas.end();
+
+    canvas.begin(400, 300);
+    canvas.clip({10, 10, 100, 100});
+    canvas.text({50, 50}, "y", {"Courier New, monospace", 10.0, color("black")});
+    canvas.end();
+
+    CHECK( canvas.pages() == 2 );
+    canvas.close();
+    canvas.close(); // nothing happens once closed
+
+    auto const pdf = out.str();
+
+    CHECK( pdf.find("%PDF-1.4\n") == 0 );
+    CHECK( pdf.substr(pdf.size() - 6) == "%%EOF\n" );
+    CHECK( count(pdf, "/Type /Page ") == 2 );
+    CHECK( pdf.find("/Count 2") != std::string::npos );
+    CHECK( pdf.find("/MediaBox [0 0 600 375]") != std::string::npos ); // 800 x 500 px in pt
+    CHECK( pdf.find("/MediaBox [0 0 300 225]") != std::string::npos );
+
+    // The fonts and opacities are shared by all pages and written once
+    CHECK( count(pdf, "/BaseFont /Helvetica ") == 1 );
+    CHECK( count(pdf, "/BaseFont /Courier ") == 1 );
+    CHECK( count(pdf, "/Type /ExtGState /ca 1 /CA 0.5") == 1 );
+    CHECK( count(pdf, "/Resources 3 0 R") == 2 );
+
+    checkXref(pdf);
+
+    CHECK_THROWS( canvas.begin(800, 500) );
+
+    // Text is measured with the widths of the standard fonts, with the minus sign drawn as a hyphen
+    CHECK( canvas.textWidth("Hi", {"Arial", 10.0}) == Approx(9.44) ); // (722 + 222) / 1000 * 10
+    CHECK( canvas.textWidth("Hi", {"Times New Roman, serif", 10.0}) == Approx(10.0) ); // (722 + 278) / 1000 * 10
+    CHECK( canvas.textWidth("Hi", {"Courier New, monospace", 10.0}) == Approx(12.0) );
+    CHECK( canvas.textWidth("−1", {"Arial", 10.0}) == Approx(8.89) ); // (333 + 556) / 1000 * 10
+}
+
+TEST_CASE("Testing writePdf", "[Pdf]")
+{
+    Figure fig;
+    fig.title("Temperature");
+    fig.drawLine(std::vector<double>{0.0, 1.0, 2.0}, std::vector<double>{0.0, 1.0, 4.0}, "A");
+
+    std::ostringstream out;
+    writePdf(out, fig.specs(), 800, 500);
+    auto const pdf = out.str();
+
+    CHECK( pdf.find("%PDF-1.4\n") == 0 );
+    CHECK( count(pdf, "/Type /Page ") == 1 );
+    checkXref(pdf);
+
+    auto const previous = backend();
+    setBackend(Backend::Native);
+    CHECK( fig.image("pdf", 800, 500) == pdf );
+    setBackend(previous);
+}
+
+TEST_CASE("Testing PdfReport", "[Pdf]")
+{
+    auto const file = "reaktplot-test-report.pdf";
+
+    Figure fig;
+    fig.drawLine(std::vector<double>{0.0, 1.0, 2.0}, std::vector<double>{0.0, 1.0, 4.0}, "A");
+
+    Figure animated;
+    for(auto i = 0; i < 3; ++i)
+    {
+        animated.beginFrame();
+        animated.drawLine(std::vector<double>{0.0, 1.0}, std::vector<double>{0.0, 1.0 * i}, "B");
+        animated.endFrame();
+    }
+
+    {
+        PdfReport report(file);
+        report.add(fig);
+        report.add(fig, 400, 300);
+        report.addFrames(animated);
+        CHECK( report.pages() == 5 );
+        report.close();
+        CHECK_THROWS( report.add(fig) );
+    }
+
+    std::ifstream in(file, std::ios::binary);
+    std::string const pdf((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    in.close();
+    std::remove(file);
+
+    CHECK( count(pdf, "/Type /Page ") == 5 );
+    CHECK( pdf.find("/Count 5") != std::string::npos );
+    CHECK( count(pdf, "/BaseFont /Helvetica ") == 1 );
+    checkXref(pdf);
+
+    CHECK_THROWS( PdfReport("nonexistent-directory/report.pdf") );
+}
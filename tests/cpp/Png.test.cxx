@@ -0,0 +1,155 @@
+// reaktplot - a modern C++ scientific plotting library powered by plotly
+// https://github.com/reaktplot/reaktplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2022-2023 Allan Leal
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+// NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+// Catch includes
+#include <catch2/catch.hpp>
+
+// C++ includes
+#include <limits>
+#include <sstream>
+#include <vector>
+
+// reaktplot includes
+#include <reaktplot/Figure.hpp>
+#include <reaktplot/Png.hpp>
+#include <reaktplot/Renderer.hpp>
+using namespace reaktplot;
+
+TEST_CASE("Testing PngCanvas", "[Png]")
+{
+    auto const pixel = [](PngCanvas const& canvas, int x, int y)
+    {
+        auto const* p = canvas.pixels().data() + (y * canvas.width() + x) * 4;
+        return Color{ p[0], p[1], p[2], p[3] / 255.0 };
+    };
+
+    SECTION("Filling shapes with anti-aliasing")
+    {
+        PngCanvas canvas;
+        canvas.begin(20, 10);
+        canvas.rect({0.0, 0.0, 20.0, 10.0}, color("#fff"));
+        canvas.rect({2.0, 2.0, 4.5, 4.0}, color("#000"));
+
+        CHECK( canvas.width() == 20 );
+        CHECK( canvas.height() == 10 );
+        CHECK( int(pixel(canvas, 0, 0).r) == 255 );
+        CHECK( int(pixel(canvas, 3, 3).r) == 0 );
+        CHECK( int(pixel(canvas, 6, 3).r) == Approx(128).margin(1) ); // half of the pixel is covered
+        CHECK( int(pixel(canvas, 7, 3).r) == 255 );
+    }
+
+    SECTION("Filling adjacent polygons without seams")
+    {
+        PngCanvas canvas;
+        canvas.begin(10, 10);
+        canvas.rect({0.0, 0.0, 10.0, 10.0}, color("#fff"));
+        canvas.polygons({ { {0.0, 0.0}, {5.3, 0.0}, {5.3, 10.0}, {0.0, 10.0} }, { {5.3, 0.0}, {10.0, 0.0}, {10.0, 10.0}, {5.3, 10.0} } }, color("#000"));
+        CHECK( int(pixel(canvas, 5, 5).r) == 0 );
+    }
+
+    SECTION("Clipping")
+    {
+        PngCanvas canvas;
+        canvas.begin(10, 10);
+        canvas.clip({0.0, 0.0, 5.0, 10.0});
+        canvas.rect({0.0, 0.0, 10.0, 10.0}, color("#f00"));
+        canvas.unclip();
+        CHECK( int(pixel(canvas, 2, 2).r) == 255 );
+        CHECK( pixel(canvas, 7, 2).a == 0.0 );
+    }
+
+    SECTION("Scaling")
+    {
+        PngCanvas canvas(2.0);
+        canvas.begin(10, 5);
+        CHECK( canvas.width() == 20 );
+        CHECK( canvas.height() == 10 );
+    }
+
+    SECTION("Drawing text")
+    {
+        PngCanvas canvas(1.0, Font());
+        canvas.begin(40, 20);
+        TextStyle style;
+        style.color = color("#000");
+        canvas.text({2.0, 15.0}, "T", style);
+        auto covered = 0;
+        for(int y = 0; y < 20; ++y)
+            for(int x = 0; x < 40; ++x)
+                covered += pixel(canvas, x, y).a > 0.0;
+        CHECK( covered > 0 );
+        CHECK( canvas.textWidth("TT", style) == Approx(2 * 12.0 * Font().glyph(Font().index(U'T')).advance) );
+    }
+}
+
+TEST_CASE("Testing writePng", "[Png]")
+{
+    Figure fig;
+    fig.title("Figure");
+    fig.drawLine(std::vector<double>{0.0, 1.0, 2.0}, std::vector<double>{1.0, 3.0, 2.0}, "A");
+
+    std::ostringstream out;
+    writePng(out, fig.specs(), 400, 300, 2.0);
+    auto const png = out.str();
+
+    REQUIRE( png.size() > 33 );
+    CHECK( png.substr(0, 8) == "\x89PNG\r\n\x1a\n" );
+    CHECK( png.substr(12, 4) == "IHDR" );
+    CHECK( png.substr(16, 8) == std::string("\0\0\x03\x20\0\0\x02\x58", 8) ); // 800 x 600 pixels
+    CHECK( png.find("IDAT") != std::string::npos );
+    CHECK( png.substr(png.size() - 8, 4) == "IEND" );
+}
+
+TEST_CASE("Testing contours with missing data", "[Png]")
+{
+    auto const NaN = std::numeric_limits<double>::quiet_NaN();
+
+    // The data of example-contour-plot-missing-data.cpp
+    std::vector<double> const x = { 0.0, 1.0, 2.0, 3.0, 4.0, 5.0 };
+    std::vector<double> const y = { 0.0, 1.0, 2.0, 3.0, 4.0, 5.0 };
+    std::vector<std::vector<double>> const z = {
+        { 10.00, 10.625, 12.500, 15.625, 20.000 },
+        { 5.625,    NaN,    NaN, 11.250, 15.625 },
+        { 2.500,    NaN,    NaN,  8.125, 12.500 },
+        { 0.625,  1.250,  3.125,  6.250, 10.625 },
+        { 0.000,  0.625,  2.500,  5.625, 10.000 }
+    };
+
+    Figure fig;
+    fig.xaxisShowGrid(false);
+    fig.yaxisShowGrid(false);
+    fig.drawContour(x, y, z);
+
+    PngCanvas canvas;
+    render(canvas, fig.specs(), 800, 500);
+
+    auto const background = [&](double px, double py)
+    {
+        auto const* p = canvas.pixels().data() + (int(py) * canvas.width() + int(px)) * 4;
+        return p[0] == 0xf7 && p[1] == 0xf7 && p[2] == 0xf7;
+    };
+
+    // The plot area spans x and y from 0 to 4 inside the margins of 100 px, and the missing values are interpolated, as in plotly
+    for(auto const xv : { 0.25, 0.75, 1.25, 1.5, 1.75, 2.25, 2.75 })
+        for(auto const yv : { 0.25, 0.75, 1.25, 1.5, 1.75, 2.25, 2.75 })
+            CHECK_FALSE( background(100 + xv / 4 * 600, 400 - yv / 4 * 300) );
+}
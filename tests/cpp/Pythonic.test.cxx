@@ -0,0 +1,111 @@
+// reaktplot - a modern C++ scientific plotting library powered by plotly
+// https://github.com/reaktplot/reaktplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2022-2023 Allan Leal
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+// NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+// Catch includes
+#include <catch2/catch.hpp>
+
+// C++ includes
+#include <chrono>
+#include <future>
+#include <string>
+#include <thread>
+
+// pybind11 includes
+#include <pybind11/numpy.h>
+
+// reaktplot includes
+#include <reaktplot/Array.hpp>
+#include <reaktplot/Column.hpp>
+#include <reaktplot/DefaultTheme.hpp>
+#include <reaktplot/Figure.hpp>
+#include <reaktplot/Pythonic.hpp>
+using namespace reaktplot;
+
+TEST_CASE("Testing Pythonic", "[Pythonic]")
+{
+    REQUIRE_NOTHROW( warmup() );
+    REQUIRE_NOTHROW( warmup() ); // a second call while the first warm-up is still running does nothing
+
+    Figure fig; // built in C++ while plotly is being imported
+
+    Array x = linspace(0.0, 1.0, 10);
+
+    fig.drawLine(x, x * x, "u");
+
+    // The helper thread imports the plotly modules used by reaktplot (e.g., the lazily imported contour traces)
+    auto const warmed = [] { return Pythonic::execute([] { return py::module::import("sys").attr("modules").contains("plotly.graph_objs._contour"); }); };
+    auto const deadline = std::chrono::steady_clock::now() + std::chrono::seconds(60);
+    while(!warmed() && std::chrono::steady_clock::now() < deadline)
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    CHECK( warmed() );
+
+    CHECK_NOTHROW( fig.save("fig-warmup.svg") );
+}
+
+TEST_CASE("Testing Pythonic with staged figures", "[Pythonic]")
+{
+    Figure fig;
+
+    Array x = linspace(0.0, 1.0, 10);
+
+    fig.drawLine(x, x * x, "u");
+
+    // Staging does not need the GIL, so it runs while another thread holds it
+    std::promise<void> held, staged;
+    std::thread holder([&] { Pythonic::execute([&] { held.set_value(); staged.get_future().wait(); }); });
+    held.get_future().wait();
+    auto staging = std::async(std::launch::async, [&] { return fig.stage(); });
+    CHECK( staging.wait_for(std::chrono::seconds(10)) == std::future_status::ready );
+    staged.set_value();
+    holder.join();
+    auto const changes = staging.get();
+
+    REQUIRE( changes.traces.size() == 1 );
+
+    // The numbers are handed over to Python as read-only numpy arrays viewing the memory of the figure (if numpy is installed)
+    auto const& y = fig.specs().traces[0].find("y")->as<Column>().numbers();
+    Pythonic::execute([&] {
+        py::object numbers = fig.pyfigure(changes).attr("traces")[py::int_(0)][py::str("y")];
+        if(!py::isinstance<py::array>(numbers))
+            return;
+        auto const array = numbers.cast<py::array>();
+        CHECK( array.data() == static_cast<void const*>(y.data()) );
+        CHECK( array.size() == static_cast<py::ssize_t>(y.size()) );
+        CHECK_FALSE( array.writeable() );
+    });
+
+    // Once handed over, the changes are not staged again
+    CHECK( fig.stage().traces.empty() );
+}
+
+TEST_CASE("Testing the default theme against the Python one", "[Pythonic]")
+{
+    // The theme used by the native exporters (DefaultTheme.cpp) is a copy of the template of the Python package (DefaultTheme.py)
+    Pythonic::execute([] {
+        py::module::import("reaktplot.DefaultTheme");
+        auto const Template = py::module::import("plotly.graph_objects").attr("layout").attr("Template");
+        auto const expected = py::module::import("plotly.io").attr("templates")[py::str("reaktplot")].attr("to_plotly_json")();
+        auto const actual = Template(Pythonic::pyobject(defaultTheme())).attr("to_plotly_json")();
+        INFO( py::repr(actual).cast<std::string>() << "\n" << py::repr(expected).cast<std::string>() );
+        CHECK( actual.equal(expected) );
+    });
+}
@@ -0,0 +1,85 @@
+// reaktplot - a modern C++ scientific plotting library powered by plotly
+// https://github.com/reaktplot/reaktplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2022-2023 Allan Leal
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+// NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+// Catch includes
+#include <catch2/catch.hpp>
+
+// C++ includes
+#include <atomic>
+#include <thread>
+#include <vector>
+
+// reaktplot includes
+#include <reaktplot/Queue.hpp>
+using namespace reaktplot;
+
+TEST_CASE("Testing Queue", "[Queue]")
+{
+    Queue<int> queue(3);
+
+    CHECK( queue.capacity() == 4 );
+    CHECK( queue.empty() );
+
+    int item = 0;
+
+    for(int i = 0; i < 4; ++i)
+        CHECK( queue.push(item = i) );
+
+    CHECK_FALSE( queue.push(item = 4) );
+
+    for(int i = 0; i < 4; ++i)
+    {
+        CHECK( queue.pop(item) );
+        CHECK( item == i );
+    }
+
+    CHECK_FALSE( queue.pop(item) );
+
+    SECTION("Using multiple producers and consumers")
+    {
+        Queue<long> queue(64);
+        std::atomic<long> sum = 0;
+        std::atomic<int> remaining = 4;
+        std::vector<std::thread> threads;
+
+        for(int p = 0; p < 4; ++p)
+            threads.emplace_back([&] {
+                for(long i = 1; i <= 10000; ++i)
+                    while(!queue.push(i))
+                        std::this_thread::yield();
+                --remaining;
+            });
+
+        for(int c = 0; c < 3; ++c)
+            threads.emplace_back([&] {
+                long value = 0;
+                while(remaining > 0 || !queue.empty())
+                    if(queue.pop(value))
+                        sum += value;
+            });
+
+        for(auto& thread : threads)
+            thread.join();
+
+        CHECK( sum == 4 * 10000L * 10001L / 2 );
+    }
+}
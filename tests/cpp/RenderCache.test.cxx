@@ -0,0 +1,145 @@
+// reaktplot - a modern C++ scientific plotting library powered by plotly
+// https://github.com/reaktplot/reaktplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2022-2023 Allan Leal
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+// NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+// Catch includes
+#include <catch2/catch.hpp>
+
+// C++ includes
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+
+// reaktplot includes
+#include <reaktplot/Array.hpp>
+#include <reaktplot/Figure.hpp>
+#include <reaktplot/Html.hpp>
+#include <reaktplot/RenderCache.hpp>
+using namespace reaktplot;
+
+namespace {
+
+/// Return the contents of a file.
+auto contents(std::string const& file) -> std::string
+{
+    std::ifstream in(file, std::ios::binary);
+    return std::string(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+}
+
+} // namespace
+
+TEST_CASE("Testing RenderCache", "[RenderCache]")
+{
+    RenderCache cache("render-cache");
+    cache.clear();
+
+    Array x = linspace(0.0, 1.0, 10);
+
+    Figure fig;
+    fig.drawLine(x, x, "line");
+
+    CHECK( cache.key(fig.specs(), "fig.json", 800, 500, 1.0) == cache.key(fig.clone().specs(), "fig.json", 800, 500, 1.0) );
+    CHECK( cache.key(fig.specs(), "fig.json", 800, 500, 1.0) != cache.key(fig.specs(), "fig.json", 400, 500, 1.0) );
+    CHECK( cache.key(fig.specs(), "fig.json", 800, 500, 1.0) != cache.key(fig.specs(), "fig.html", 800, 500, 1.0) );
+
+    setRenderCache(&cache);
+
+    fig.save("fig-cache-1.json");
+    CHECK( cache.stats().hits == 0 );
+    CHECK( cache.stats().misses == 1 );
+
+    fig.save("fig-cache-2.json"); // copied from the cache
+    CHECK( cache.stats().hits == 1 );
+    CHECK( cache.stats().misses == 1 );
+    CHECK( contents("fig-cache-2.json") == contents("fig-cache-1.json") );
+
+    fig.title("changed");
+    fig.save("fig-cache-3.json"); // rendered anew, since the figure changed
+    CHECK( cache.stats().hits == 1 );
+    CHECK( cache.stats().misses == 2 );
+    CHECK( contents("fig-cache-3.json").find("changed") != std::string::npos );
+
+    fig.saveAsync("fig-cache-4.json").get(); // saved in the background, also copied from the cache
+    CHECK( cache.stats().hits == 2 );
+    CHECK( cache.stats().misses == 2 );
+    CHECK( contents("fig-cache-4.json") == contents("fig-cache-3.json") );
+
+    fig.title("changed again");
+    fig.saveAsync("fig-cache-5.json").get();
+    CHECK( cache.stats().hits == 2 );
+    CHECK( cache.stats().misses == 3 );
+
+    setRenderCache(nullptr);
+
+    CHECK( renderCache() == nullptr );
+}
+
+TEST_CASE("Testing RenderCache with HTML options", "[RenderCache]")
+{
+    RenderCache cache("render-cache");
+    cache.clear();
+
+    std::ofstream("fake-plotly.min.js") << "/* plotly.js */";
+
+    HtmlOptions options;
+    options.plotlyjs = "fake-plotly.min.js";
+    options.mode = HtmlMode::Shared;
+
+    Array x = linspace(0.0, 1.0, 10);
+
+    Figure fig;
+    fig.drawLine(x, x, "line");
+
+    HtmlOptions other = options;
+    other.json.typedarrays = !options.json.typedarrays;
+
+    CHECK( cache.key(fig.specs(), "fig.html", 800, 500, options) == cache.key(fig.clone().specs(), "fig.html", 800, 500, options) );
+    CHECK( cache.key(fig.specs(), "fig.html", 800, 500, options) != cache.key(fig.specs(), "fig.html", 800, 500, other) );
+
+    std::filesystem::remove_all("render-cache-html");
+    std::filesystem::create_directories("render-cache-html/saved");
+    std::filesystem::create_directories("render-cache-html/copied");
+
+    setRenderCache(&cache);
+
+    fig.save("render-cache-html/saved/fig-cache-1.html", options);
+    CHECK( cache.stats().hits == 0 );
+    CHECK( cache.stats().misses == 1 );
+
+    fig.save("render-cache-html/copied/fig-cache-2.html", options); // copied from the cache, with the shared plotly.js file
+    CHECK( cache.stats().hits == 1 );
+    CHECK( cache.stats().misses == 1 );
+    CHECK( contents("render-cache-html/copied/fig-cache-2.html") == contents("render-cache-html/saved/fig-cache-1.html") );
+    CHECK( contents("render-cache-html/copied/plotly.min.js") == "/* plotly.js */" );
+
+    fig.save("render-cache-html/saved/fig-cache-3.html", other); // written anew, since the options changed
+    CHECK( cache.stats().hits == 1 );
+    CHECK( cache.stats().misses == 2 );
+
+    fig.title("changed");
+    fig.save("render-cache-html/saved/fig-cache-4.html", options); // written anew, since the figure changed
+    CHECK( cache.stats().hits == 1 );
+    CHECK( cache.stats().misses == 3 );
+    CHECK( contents("render-cache-html/saved/fig-cache-4.html").find("changed") != std::string::npos );
+
+    setRenderCache(nullptr);
+}
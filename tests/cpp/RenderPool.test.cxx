@@ -0,0 +1,91 @@
+// reaktplot - a modern C++ scientific plotting library powered by plotly
+// https://github.com/reaktplot/reaktplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2022-2023 Allan Leal
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+// NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+// Catch includes
+#include <catch2/catch.hpp>
+
+// C++ includes
+#include <fstream>
+#include <string>
+#include <vector>
+
+// reaktplot includes
+#include <reaktplot/Array.hpp>
+#include <reaktplot/Figure.hpp>
+#include <reaktplot/RenderPool.hpp>
+using namespace reaktplot;
+
+TEST_CASE("Testing RenderPool", "[RenderPool]")
+{
+    RenderPoolOptions options;
+    options.workers = 2;
+    options.capacity = 3;
+
+    RenderPool pool(options);
+
+    CHECK( pool.workers() == 2 );
+    CHECK( pool.pending() == 0 );
+
+    Figure fig;
+    Array x = linspace(0.0, 1.0, 10);
+    fig.drawLine(x, x * x, "u");
+
+    SECTION("Testing ordered completion callbacks")
+    {
+        std::vector<std::string> files;
+        for(int i = 0; i < 6; ++i)
+            pool.save(fig, "fig-pool-" + std::to_string(i) + ".svg", 400, 300, 1.0, [&](std::string const& file, std::exception_ptr error) {
+                CHECK( !error );
+                files.push_back(file);
+            });
+        REQUIRE_NOTHROW( pool.wait() );
+        CHECK( pool.pending() == 0 );
+        REQUIRE( files.size() == 6 );
+        for(int i = 0; i < 6; ++i)
+        {
+            CHECK( files[i] == "fig-pool-" + std::to_string(i) + ".svg" );
+            CHECK( std::ifstream(files[i]).good() );
+        }
+    }
+
+    SECTION("Testing error propagation")
+    {
+        std::exception_ptr failure;
+        pool.save(fig, "fig-pool.unknown", 400, 300, 1.0, [&](std::string const& file, std::exception_ptr error) { failure = error; });
+        REQUIRE_NOTHROW( pool.wait() );
+        CHECK( failure );
+
+        pool.save(fig, "fig-pool.unknown"); // without a callback, the error is rethrown by wait
+        CHECK_THROWS( pool.wait() );
+        CHECK_NOTHROW( pool.wait() );
+    }
+
+    SECTION("Testing the pool used by Figure::save")
+    {
+        setRenderPool(&pool);
+        CHECK( renderPool() == &pool );
+        fig.save("fig-pool-figure.svg");
+        REQUIRE_NOTHROW( pool.wait() );
+        CHECK( std::ifstream("fig-pool-figure.svg").good() );
+        setRenderPool(nullptr);
+    }
+}
@@ -0,0 +1,75 @@
+// reaktplot - a modern C++ scientific plotting library powered by plotly
+// https://github.com/reaktplot/reaktplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2022-2023 Allan Leal
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+// NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+// Catch includes
+#include <catch2/catch.hpp>
+
+// reaktplot includes
+#include <reaktplot/Array.hpp>
+#include <reaktplot/Figure.hpp>
+#include <reaktplot/RenderSession.hpp>
+using namespace reaktplot;
+
+TEST_CASE("Testing RenderSession", "[RenderSession]")
+{
+    RenderSession session({ 2, 0.0 });
+
+    CHECK( session.options().maxRenders == 2 );
+    CHECK( session.options().maxMemory == 0.0 );
+    CHECK( session.running() == false );
+
+    REQUIRE_NOTHROW( session.warmup() );
+
+    CHECK( session.running() == true );
+    CHECK( session.renders() == 0 );
+
+    REQUIRE_NOTHROW( session.recycle() );
+
+    CHECK( session.running() == false );
+    CHECK( session.recycles() == 1 );
+    CHECK( session.memory() == 0.0 );
+
+    SECTION("Testing the session used by Figure::save")
+    {
+        renderSession().setOptions({ 2, 0.0 });
+
+        Figure fig;
+        Array x = linspace(0.0, 1.0, 10);
+        fig.drawLine(x, x * x, "u");
+
+        auto const recycles = renderSession().recycles();
+
+        fig.save("fig-session-1.pdf");
+        CHECK( renderSession().running() == true );
+        CHECK( renderSession().renders() == 1 );
+
+        fig.save("fig-session-2.pdf"); // the renderer is recycled after this second render
+        CHECK( renderSession().running() == false );
+        CHECK( renderSession().recycles() == recycles + 1 );
+
+        fig.save("fig-session-3.pdf"); // and started anew for this one
+        CHECK( renderSession().running() == true );
+        CHECK( renderSession().renders() == 1 );
+
+        renderSession().setOptions({});
+    }
+}
@@ -0,0 +1,167 @@
+// reaktplot - a modern C++ scientific plotting library powered by plotly
+// https://github.com/reaktplot/reaktplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2022-2023 Allan Leal
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+// NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+// Catch includes
+#include <catch2/catch.hpp>
+
+// C++ includes
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <regex>
+#include <set>
+#include <sstream>
+
+// reaktplot includes
+#include <reaktplot/Figure.hpp>
+#include <reaktplot/Renderer.hpp>
+#include <reaktplot/Svg.hpp>
+using namespace reaktplot;
+
+TEST_CASE("Testing writeSvg", "[Svg]")
+{
+    auto const count = [](std::string const& str, std::string const& what)
+    {
+        std::size_t n = 0;
+        for(auto pos = str.find(what); pos != std::string::npos; pos = str.find(what, pos + 1))
+            ++n;
+        return n;
+    };
+
+    SECTION("Lines with markers and a legend")
+    {
+        Figure fig;
+        fig.title("Temperature & Pressure");
+        fig.xaxisTitle("x");
+        fig.drawLine(std::vector<double>{0.0, 1.0, 2.0}, std::vector<double>{0.0, 10000.0, 20000.0}, "A");
+        fig.drawMarkers(std::vector<double>{0.0, 1.0, 2.0}, std::vector<double>{5000.0, 15000.0, 25000.0}, "B");
+
+        std::ostringstream out;
+        writeSvg(out, fig.specs(), 800, 500);
+        auto const svg = out.str();
+
+        CHECK( svg.find("<svg xmlns=\"http://www.w3.org/2000/svg\"") == 0 );
+        CHECK( svg.find("width=\"800\" height=\"500\"") != std::string::npos );
+        CHECK( svg.find("</svg>") != std::string::npos );
+        CHECK( svg.find(">Temperature &amp; Pressure</text>") != std::string::npos );
+        CHECK( svg.find(">20k</text>") != std::string::npos ); // SI tick labels, as in plotly
+        CHECK( svg.find(">1.5</text>") != std::string::npos );
+        CHECK( svg.find(">1.0</text>") == std::string::npos ); // no trailing zeros, as in plotly
+        CHECK( svg.find(">A</text>") != std::string::npos );   // legend entries
+        CHECK( svg.find(">B</text>") != std::string::npos );
+        CHECK( svg.find("rgb(76, 120, 168)") != std::string::npos );  // first color of the colorway of the theme
+        CHECK( count(svg, "<circle") == 3 + 1 );                       // markers and their legend symbol
+        CHECK( count(svg, "<g clip-path") == count(svg, "</g>") );
+    }
+
+    SECTION("Contours with a colorbar")
+    {
+        std::vector<double> x = {0.0, 1.0, 2.0, 3.0};
+        std::vector<double> y = {0.0, 1.0, 2.0};
+        std::vector<std::vector<double>> z = {{0.0, 1.0, 2.0, 3.0}, {1.0, 2.0, 3.0, 4.0}, {2.0, 3.0, 4.0, 5.0}};
+
+        Figure fig;
+        fig.drawContour(x, y, z);
+
+        std::ostringstream out;
+        writeSvg(out, fig.specs(), 600, 400);
+        auto const svg = out.str();
+
+        CHECK( svg.find("<path d=\"M") != std::string::npos );
+        CHECK( svg.find("fill=\"rgb(12, 51, 131)\"") != std::string::npos ); // first color of the default colorscale (Portland)
+        CHECK( count(svg, "<rect") > 10 ); // the bands of the colorbar
+    }
+}
+
+TEST_CASE("Testing Backend", "[Svg]")
+{
+    auto const previous = backend();
+    setBackend(Backend::Native);
+    CHECK( backend() == Backend::Native );
+    setBackend(Backend::Plotly);
+    CHECK( backend() == Backend::Plotly );
+    setBackend(previous);
+}
+
+// Hidden unless selected with `reaktplot-cpptests [kaleido]`, since exporting with kaleido needs Chromium and takes seconds
+TEST_CASE("Comparing writeSvg with kaleido", "[.][kaleido]")
+{
+    /// Return the texts in an SVG document (e.g., the titles, tick labels, and legend entries).
+    auto const texts = [](std::string const& svg)
+    {
+        std::regex const regex(">([^<>]+)</text>");
+        std::set<std::string> res;
+        for(auto it = std::sregex_iterator(svg.begin(), svg.end(), regex); it != std::sregex_iterator(); ++it)
+            res.insert((*it)[1]);
+        return res;
+    };
+
+    Figure fig;
+    fig.title("Temperature & Pressure");
+    fig.xaxisTitle("x");
+    fig.yaxisTitle("y");
+    fig.drawLine(std::vector<double>{0.0, 1.0, 2.0}, std::vector<double>{0.0, 10000.0, 20000.0}, "A");
+    fig.drawMarkers(std::vector<double>{0.0, 1.0, 2.0}, std::vector<double>{5000.0, 15000.0, 25000.0}, "B");
+
+    std::ostringstream out;
+    writeSvg(out, fig.specs(), 800, 500);
+    auto const native = out.str();
+
+    auto const previous = backend();
+    setBackend(Backend::Plotly);
+    std::string plotly;
+    try
+    {
+        std::remove("svg-kaleido.svg");
+        fig.save("svg-kaleido.svg", 800, 500);
+        std::ifstream in("svg-kaleido.svg");
+        plotly.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    }
+    catch(std::exception const& e)
+    {
+        WARN("Could not export the figure with kaleido: " << e.what());
+    }
+    setBackend(previous);
+
+    if(plotly.empty())
+    {
+        WARN("Skipped because kaleido or Chromium is not available.");
+        return;
+    }
+
+    CHECK( plotly.find("width=\"800\" height=\"500\"") != std::string::npos );
+    CHECK( native.find("width=\"800\" height=\"500\"") != std::string::npos );
+
+    // The same titles, tick labels, and legend entries are drawn
+    auto const expected = texts(plotly);
+    auto const actual = texts(native);
+    for(auto const& text : expected)
+    {
+        INFO("text drawn by plotly: " << text);
+        CHECK( actual.count(text) == 1 );
+    }
+    for(auto const& text : actual)
+    {
+        INFO("text drawn natively: " << text);
+        CHECK( expected.count(text) == 1 );
+    }
+}
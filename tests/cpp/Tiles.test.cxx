@@ -0,0 +1,169 @@
+// reaktplot - a modern C++ scientific plotting library powered by plotly
+// https://github.com/reaktplot/reaktplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2022-2023 Allan Leal
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+// NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+// Catch includes
+#include <catch2/catch.hpp>
+
+// C++ includes
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+// reaktplot includes
+#include <reaktplot/Figure.hpp>
+#include <reaktplot/Png.hpp>
+#include <reaktplot/Renderer.hpp>
+#include <reaktplot/Tiff.hpp>
+#include <reaktplot/Tiles.hpp>
+using namespace reaktplot;
+
+namespace {
+
+/// Return a figure with lines, markers, and rotated text crossing the borders of tiles.
+auto figure() -> Figure
+{
+    Figure fig;
+    fig.title("Poster");
+    fig.yaxisTitle("y");
+    fig.drawLine(std::vector<double>{0.0, 1.0, 2.0, 3.0}, std::vector<double>{1.0, 3.0, 2.0, 4.0}, "A");
+    fig.drawMarkers(std::vector<double>{0.5, 1.5, 2.5}, std::vector<double>{2.0, 2.5, 3.0}, "B");
+    return fig;
+}
+
+/// Return a little-endian integer in a string.
+auto read32(std::string const& bytes, std::size_t pos) -> std::uint32_t
+{
+    std::uint32_t res = 0;
+    for(int i = 3; i >= 0; --i)
+        res = res << 8 | static_cast<unsigned char>(bytes[pos + i]);
+    return res;
+}
+
+} // namespace
+
+TEST_CASE("Testing PngCanvas::viewport", "[Tiles]")
+{
+    auto const fig = figure();
+
+    PngCanvas whole(1.5);
+    render(whole, fig.specs(), 300, 200);
+    REQUIRE( whole.width() == 450 );
+    REQUIRE( whole.height() == 300 );
+
+    // Every tile has exactly the pixels it has in the whole image
+    auto differences = 0;
+    for(int ty = 0; ty < 300; ty += 128)
+        for(int tx = 0; tx < 450; tx += 128)
+        {
+            PngCanvas tile(1.5);
+            tile.viewport(tx, ty, 128, 128);
+            render(tile, fig.specs(), 300, 200);
+            CHECK( tile.width() == std::min(128, 450 - tx) );
+            CHECK( tile.height() == std::min(128, 300 - ty) );
+            for(int y = 0; y < tile.height(); ++y)
+                for(int x = 0; x < tile.width() * 4; ++x)
+                    differences += tile.pixels()[(y * tile.width()) * 4 + x] != whole.pixels()[((ty + y) * whole.width() + tx) * 4 + x];
+        }
+    CHECK( differences == 0 );
+
+    PngCanvas canvas;
+    canvas.viewport(10, 10, 20, 20);
+    canvas.viewport(0, 0, 0, 0); // the whole image again
+    canvas.begin(40, 30);
+    CHECK( canvas.width() == 40 );
+    CHECK( canvas.height() == 30 );
+}
+
+TEST_CASE("Testing PngWriter", "[Tiles]")
+{
+    std::vector<unsigned char> rows(4 * 3 * 2, 255);
+
+    std::ostringstream out;
+    PngWriter writer(out, 3, 4);
+    writer.write(rows.data(), 2);
+    CHECK_THROWS( writer.close() ); // only 2 of 4 rows written
+    writer.write(rows.data(), 2);
+    CHECK_THROWS( writer.write(rows.data(), 1) );
+    writer.close();
+
+    auto const png = out.str();
+    CHECK( png.substr(0, 8) == "\x89PNG\r\n\x1a\n" );
+    CHECK( png.substr(16, 10) == std::string("\0\0\0\x03\0\0\0\x04\x08\x06", 10) ); // 3 x 4 pixels in RGBA
+    CHECK( png.find("IDAT") != std::string::npos );
+    CHECK( png.substr(png.size() - 8, 4) == "IEND" );
+}
+
+TEST_CASE("Testing TiffWriter", "[Tiles]")
+{
+    std::stringstream out;
+    TiffWriter writer(out, 40, 20, 32);
+    REQUIRE( writer.tiles() == 2 );
+
+    std::vector<unsigned char> left(32 * 20 * 4, 255), right(8 * 20 * 4, 128);
+    writer.write(TiffWriter::encode(left, 32, 20, 32));
+    CHECK_THROWS( writer.close() ); // only 1 of 2 tiles written
+    writer.write(TiffWriter::encode(right, 8, 20, 32));
+    CHECK_THROWS( writer.write(TiffWriter::encode(right, 8, 20, 32)) );
+    writer.close();
+
+    auto const tiff = out.str();
+    CHECK( tiff.substr(0, 4) == std::string("II\x2A\0", 4) );
+
+    auto const ifd = read32(tiff, 4);
+    REQUIRE( ifd % 2 == 0 );
+    REQUIRE( ifd + 2 + 13 * 12 + 4 <= tiff.size() );
+    CHECK( tiff[ifd] == 13 ); // the number of tags
+    CHECK( read32(tiff, ifd + 2 + 8) == 40 ); // ImageWidth
+    CHECK( read32(tiff, ifd + 2 + 12 + 8) == 20 ); // ImageLength
+    CHECK( read32(tiff, ifd + 2 + 10 * 12 + 4) == 2 ); // the number of TileOffsets
+    CHECK( read32(tiff, read32(tiff, ifd + 2 + 10 * 12 + 8)) == 8 ); // the first tile follows the header
+
+    CHECK_THROWS( TiffWriter(out, 40, 20, 30) ); // not a multiple of 16
+    CHECK_THROWS( TiffWriter::encode(left, 32, 20, 16) );
+}
+
+TEST_CASE("Testing writeTiledPng and writeTiledTiff", "[Tiles]")
+{
+    auto const fig = figure();
+
+    // The images do not depend on the number of threads rendering the tiles
+    std::ostringstream png1, png4;
+    writeTiledPng(png1, fig.specs(), 300, 200, 1.5, { 64, 1 });
+    writeTiledPng(png4, fig.specs(), 300, 200, 1.5, { 64, 4 });
+    CHECK( png1.str() == png4.str() );
+    CHECK( png1.str().substr(16, 8) == std::string("\0\0\x01\xC2\0\0\x01\x2C", 8) ); // 450 x 300 pixels
+
+    std::stringstream tiff1, tiff4;
+    writeTiledTiff(tiff1, fig.specs(), 300, 200, 1.5, { 64, 1 });
+    writeTiledTiff(tiff4, fig.specs(), 300, 200, 1.5, { 64, 4 });
+    CHECK( tiff1.str() == tiff4.str() );
+
+    auto const file = "reaktplot-test-tiles.tiff";
+    fig.save(file, 300, 200, 1.5);
+    std::ifstream in(file, std::ios::binary);
+    std::string const saved((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    in.close();
+    std::remove(file);
+    CHECK( saved.substr(0, 4) == std::string("II\x2A\0", 4) );
+
+    CHECK_THROWS( saveTiled("reaktplot-test-tiles.svg", fig.specs(), 300, 200) );
+}
@@ -0,0 +1,99 @@
+// reaktplot - a modern C++ scientific plotting library powered by plotly
+// https://github.com/reaktplot/reaktplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2022-2023 Allan Leal
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+// NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+// Catch includes
+#include <catch2/catch.hpp>
+
+// reaktplot includes
+#include <reaktplot/Value.hpp>
+using namespace reaktplot;
+
+TEST_CASE("Testing Value", "[Value]")
+{
+    CHECK( Value().is<std::nullptr_t>() );
+    CHECK( Value(true).is<bool>() );
+    CHECK( Value(3).as<long long>() == 3 );
+    CHECK( Value(3.0).as<double>() == 3.0 );
+    CHECK( Value("abc").as<std::string>() == "abc" );
+    CHECK( Value(List{1, 2}).as<List>().size() == 2 );
+
+    Dict dict{{"a", 1}, {"b", "x"}};
+
+    CHECK( dict.size() == 2 );
+    CHECK( dict.find("a")->as<long long>() == 1 );
+    CHECK( dict.find("c") == nullptr );
+
+    dict.set("a", 2.0); // existing keys keep their position
+
+    CHECK( dict.begin()->first == "a" );
+    CHECK( dict.find("a")->as<double>() == 2.0 );
+
+    dict.update({{"c", Dict{{"d", false}}}});
+
+    CHECK( dict.size() == 3 );
+    CHECK( dict.find("c")->as<Dict>().find("d")->as<bool>() == false );
+
+    CHECK( dict == Dict{{"c", Dict{{"d", false}}}, {"b", "x"}, {"a", 2.0}} );
+
+    dict.erase("c");
+
+    CHECK( dict.size() == 2 );
+}
+
+TEST_CASE("Testing Dict copy-on-write", "[Value][Dict]")
+{
+    Dict a{{"x", 1}, {"y", 2}};
+    Dict b = a;
+
+    CHECK( b.shares(a) ); // copies share their entries
+
+    b.set("x", 3);
+
+    CHECK_FALSE( b.shares(a) ); // entries copied on first modification
+    CHECK( a.find("x")->as<long long>() == 1 );
+    CHECK( b.find("x")->as<long long>() == 3 );
+
+    Dict c = a;
+    c.erase("z"); // erasing a missing key does not copy
+
+    CHECK( c.shares(a) );
+}
+
+TEST_CASE("Testing nested", "[Value][nested]")
+{
+    Dict dict{{"title_text", "A"}, {"title_font_size", 20}, {"paper_bgcolor", "white"}, {"title_font", Dict{{"color", "red"}}}};
+
+    Dict expected{
+        {"title", Dict{{"text", "A"}, {"font", Dict{{"size", 20}, {"color", "red"}}}}},
+        {"paper_bgcolor", "white"}
+    };
+
+    CHECK( nested(dict) == expected );
+
+    // A string title is the text of the title, as in plotly (and in the Python nested)
+    CHECK( nested(Dict{{"title", "T"}, {"title_font_size", 12}}) == Dict{{"title", Dict{{"text", "T"}, {"font", Dict{{"size", 12}}}}}} );
+    CHECK( nested(Dict{{"title_font_size", 12}, {"title", "T"}}) == Dict{{"title", Dict{{"font", Dict{{"size", 12}}}, {"text", "T"}}}} );
+    CHECK( nested(Dict{{"xaxis", Dict{{"title", "x"}}}, {"xaxis_title_font_size", 3}}) == Dict{{"xaxis", Dict{{"title", Dict{{"text", "x"}, {"font", Dict{{"size", 3}}}}}}}} );
+    CHECK( nested(Dict{{"title_font", Dict{{"size", 1}}}, {"title", Dict{{"font", Dict{{"color", "red"}}}}}}) == Dict{{"title", Dict{{"font", Dict{{"size", 1}, {"color", "red"}}}}}} );
+
+    CHECK_THROWS( nested(Dict{{"width", 800}, {"width_x", 1}}) );
+}
@@ -0,0 +1,89 @@
+// reaktplot - a modern C++ scientific plotting library powered by plotly
+// https://github.com/reaktplot/reaktplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2022-2023 Allan Leal
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+// NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+// Catch includes
+#include <catch2/catch.hpp>
+
+// C++ includes
+#include <fstream>
+
+// reaktplot includes
+#include <reaktplot/Array.hpp>
+#include <reaktplot/Figure.hpp>
+#include <reaktplot/Renderer.hpp>
+#include <reaktplot/Video.hpp>
+using namespace reaktplot;
+
+TEST_CASE("Testing VideoWriter", "[Video]")
+{
+    auto const previous = backend();
+    setBackend(Backend::Native); // frames sent to ffmpeg as raw pixels
+
+    Array x = linspace(0.0, 1.0, 20);
+
+    VideoOptions options;
+    options.width = 320;
+    options.height = 200;
+
+    SECTION("Writing figures one by one")
+    {
+        VideoWriter video("video.mp4", options);
+
+        Figure fig;
+        for(int i = 1; i <= 10; ++i)
+        {
+            fig.clearTraces();
+            fig.drawLine(x, x * double(i), "line");
+            video.write(fig);
+        }
+
+        CHECK( video.frames() == 10 );
+        CHECK_NOTHROW( video.close() );
+        CHECK( std::ifstream("video.mp4", std::ios::ate).tellg() > 0 );
+    }
+
+    SECTION("Writing the frames of an animated figure")
+    {
+        Figure fig;
+        fig.drawLine(x, x, "line");
+        for(int i = 1; i <= 10; ++i)
+        {
+            fig.beginFrame();
+            fig.drawLine(x, x * double(i), "line");
+            fig.endFrame();
+        }
+
+        CHECK_NOTHROW( fig.save("video.webm", 320, 200) );
+        CHECK( std::ifstream("video.webm", std::ios::ate).tellg() > 0 );
+    }
+
+    SECTION("Writing with a missing ffmpeg")
+    {
+        options.ffmpeg = "missing-ffmpeg-executable";
+        VideoWriter video("video-missing.mp4", options);
+        Figure fig;
+        fig.drawLine(x, x, "line");
+        CHECK_THROWS( video.write(fig) );
+    }
+
+    setBackend(previous);
+}
@@ -0,0 +1,57 @@
+// reaktplot - a modern C++ scientific plotting library powered by plotly
+// https://github.com/reaktplot/reaktplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2022-2023 Allan Leal
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+// NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+// Catch includes
+#include <catch2/catch.hpp>
+
+// C++ includes
+#include <string>
+#include <thread>
+#include <vector>
+
+// reaktplot includes
+#include <reaktplot/Array.hpp>
+#include <reaktplot/Figure.hpp>
+#include <reaktplot/Pythonic.hpp>
+using namespace reaktplot;
+
+// In its own test executable, since the interpreter thread cannot be disabled once enabled
+TEST_CASE("Testing Pythonic with the interpreter thread", "[Pythonic]")
+{
+    REQUIRE_NOTHROW( useInterpreterThread() );
+
+    std::vector<std::thread> threads;
+
+    for(int i = 0; i < 4; ++i)
+        threads.emplace_back([i] {
+            Figure fig; // each thread builds its own figure without the GIL
+            Array x = linspace(0.0, 1.0, 10);
+            fig.drawLine(x, x * x, "u");
+            fig.title("Thread " + std::to_string(i));
+            fig.save("fig-thread-" + std::to_string(i) + ".svg");
+        });
+
+    for(auto& thread : threads)
+        thread.join();
+
+    CHECK( Pythonic::execute([] { return py::eval("1 + 1").cast<int>(); }) == 2 );
+}
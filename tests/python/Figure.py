@@ -51,3 +51,187 @@ def testFigure():
         try: fig.save(f"test_figure.{ext}")
         except RuntimeError as error:
             pytest.fail(f"'saving test_figure.{ext}' raised an exception {error}")
+
+
+def testFigureFastMode():
+
+    x = np.linspace(0.0, 1.0, 10)
+
+    fig = Figure(fast=True)
+
+    fig.title("TESTING TITLE")
+    fig.titleFontSize(30)
+    fig.xaxisTitleText("x")
+    fig.paperBackgroundColor("white")
+
+    fig.drawLine(x, x * x, "u")
+    fig.drawContour(x, x, np.outer(x, x), ContourSpecs().coloringModeFill().showLabels(True))
+
+    figdict = fig.todict()
+
+    assert figdict["layout"]["title"] == {"text": "TESTING TITLE", "font": {"size": 30}}
+    assert figdict["layout"]["xaxis"]["title"]["text"] == "x"
+    assert figdict["layout"]["paper_bgcolor"] == "white"
+    assert figdict["layout"]["template"] is not None
+    assert figdict["data"][0]["type"] == "scatter"
+    assert figdict["data"][1]["contours"] == {"showlabels": True, "coloring": "fill"}
+
+    for ext in ["png", "svg"]:
+        try: fig.save(f"test_figure_fast.{ext}")
+        except RuntimeError as error:
+            pytest.fail(f"'saving test_figure_fast.{ext}' raised an exception {error}")
+
+
+def testFigureCommit():
+
+    x = np.linspace(0.0, 1.0, 10)
+
+    fig = Figure()
+
+    for i in range(100):
+        fig.drawLine(x, x * i, f"line-{i}")
+
+    assert len(fig.fig.data) == 0  # traces are buffered until committed
+    assert len(fig.traces) == 100
+
+    fig.commit()
+
+    assert len(fig.fig.data) == 100
+    assert len(fig.traces) == 0
+
+    fig.drawMarkers(x, x, "markers")
+    fig.save("test_figure_commit.svg")  # saving commits the remaining buffered traces
+
+    assert len(fig.fig.data) == 101
+
+
+def testNested():
+
+    from reaktplot.Figure import nested
+
+    assert nested(dict(title="T", title_font_size=12)) == dict(title=dict(text="T", font=dict(size=12)))
+    assert nested(dict(title_font_size=12, title="T")) == dict(title=dict(text="T", font=dict(size=12)))
+    assert nested(dict(xaxis=dict(title="x"), xaxis_title_font_size=3)) == dict(xaxis=dict(title=dict(text="x", font=dict(size=3))))
+    assert nested(dict(title_font=dict(size=1), title=dict(font=dict(color="red")))) == dict(title=dict(font=dict(size=1, color="red")))
+
+    with pytest.raises(ValueError):
+        nested(dict(width=800, width_x=1))
+
+
+def testFigureLayoutChanges():
+
+    fig = Figure()
+
+    fig.title("TESTING TITLE")
+    fig.xaxisTitleText("x")
+    fig.titleFontSize(30)
+    fig.title("ANOTHER TITLE")
+
+    assert fig.layout.dirty()
+    assert list(fig.layout.changed) == ["title_font_size", "title_text"]  # in order of last assignment
+
+    fig.drawLine([0.0, 1.0], [1.0, 2.0], "u")
+
+    fig.flush()
+
+    assert not fig.layout.dirty()
+
+    assert fig.fig.layout.title.text == "ANOTHER TITLE"
+    assert fig.fig.layout.xaxis.title.text == "x"
+    assert not fig.xaxis.dirty()
+
+    fig.layout.pop("title_font_size")
+    fig.layout.setdefault("showlegend", False)
+    fig.layout.setdefault("title_text", "IGNORED")  # already set, so unchanged
+
+    assert list(fig.layout.changed) == ["title_font_size", "showlegend"]
+
+    fig.flush()
+
+    assert fig.fig.layout.title.font.size is None  # removed keys are reset in plotly
+    assert fig.fig.layout.showlegend is False
+    assert fig.fig.layout.title.text == "ANOTHER TITLE"
+
+    fastfig = Figure(fast=True)
+    fastfig.title("TESTING TITLE")
+
+    built = fastfig.todict()
+    assert fastfig.todict() is built  # unchanged figure is not rebuilt
+
+    fastfig.title("ANOTHER TITLE")
+    assert fastfig.todict() is not built
+
+
+def testFigureClearTracesAndReset():
+
+    x = np.linspace(0.0, 1.0, 10)
+
+    for fast in [False, True]:
+        fig = Figure(fast=fast)
+
+        fig.title("TESTING TITLE")
+        fig.drawLine(x, x, "u")
+        fig.flush()
+
+        fig.clearTraces()
+        fig.drawLine(x, x * x, "v")
+
+        figdict = fig.todict()
+
+        assert [trace["name"] for trace in figdict["data"]] == ["v"]
+        assert figdict["layout"]["title"]["text"] == "TESTING TITLE"  # layout kept
+
+        fig.reset()
+        fig.drawLine(x, x, "w")
+
+        figdict = fig.todict()
+
+        assert [trace["name"] for trace in figdict["data"]] == ["w"]
+        assert "title" not in figdict["layout"]
+        assert figdict["layout"]["template"] is not None  # template kept
+
+
+def testFigureHtmlModes(tmp_path):
+
+    x = np.linspace(0.0, 1.0, 10)
+
+    fig = Figure()
+    fig.drawLine(x, x, "u")
+
+    fig.save(str(tmp_path / "standalone.html"))
+    fig.save(str(tmp_path / "shared.html"), html="shared")
+
+    assert (tmp_path / "standalone.html").stat().st_size > (tmp_path / "shared.html").stat().st_size
+    assert (tmp_path / "plotly.min.js").exists()  # written once next to the HTML files
+
+    setHtmlMode("fragment")
+    fig.save(str(tmp_path / "fragment.html"))
+    setHtmlMode("standalone")
+
+    assert "<html>" not in (tmp_path / "fragment.html").read_text()
+
+    with pytest.raises(ValueError):
+        setHtmlMode("unknown")
+
+
+def testFigureFrames():
+
+    x = np.linspace(0.0, 1.0, 10)
+
+    for fast in [True, False]:
+        fig = Figure(fast=fast)
+
+        fig.drawLine(x, x, "u")
+
+        for i in range(3):
+            fig.addFrame(dict(name=f"{i}", data=[dict(y=x * i)], layout=dict(title_text=f"frame {i}")))
+
+        figdict = fig.todict()
+
+        assert len(figdict["frames"]) == 3
+        assert figdict["frames"][2]["name"] == "2"
+        assert figdict["frames"][2]["layout"]["title"]["text"] == "frame 2"
+
+        fig.clearFrames()
+
+        assert "frames" not in fig.todict() or len(fig.todict()["frames"]) == 0
@@ -0,0 +1,97 @@
+# reaktplot - a modern C++ scientific plotting library powered by plotly
+# https://github.com/reaktplot/reaktplot
+#
+# Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+#
+# Copyright (c) 2022-2023 Allan Leal
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+# associated documentation files (the "Software"), to deal in the Software without restriction,
+# including without limitation the rights to use, copy, modify, merge, publish, distribute,
+# sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in all copies or
+# substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+# NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+# NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+# DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+from reaktplot import *
+
+import gzip
+import io
+import json
+
+import numpy as np
+import plotly.graph_objects as pgo
+
+
+def testWriteJson():
+
+    x = np.linspace(0.0, 1.0, 10)
+    z = np.outer(x, x)
+    z[0, 0] = np.nan
+
+    figure = dict(
+        data=[dict(type="contour", x=x, y=x, z=z, name="c", visible=True)],
+        layout=dict(title=dict(text="T"), xaxis=dict(range=[0, float("inf")])),
+    )
+
+    out = io.StringIO()
+    writeJson(figure, out, chunksize=3)  # many chunks per data array
+
+    result = json.loads(out.getvalue())
+
+    assert result["data"][0]["x"] == x.tolist()
+    assert result["data"][0]["z"][0][0] is None
+    assert result["data"][0]["z"][1] == z[1].tolist()
+    assert result["data"][0]["visible"] is True
+    assert result["layout"] == {"title": {"text": "T"}, "xaxis": {"range": [0, None]}}
+
+
+def testWriteJsonPlotlyObjects():
+
+    x = np.linspace(0.0, 1.0, 10)
+
+    fig = pgo.Figure(
+        data=[pgo.Scatter(x=x, y=x, name="u")],
+        layout=dict(title_text="T"),
+        frames=[pgo.Frame(name="0", data=[pgo.Scatter(y=2 * x)])],
+    )
+
+    out = io.StringIO()
+    writeJson(dict(data=fig.data, layout=fig.layout, frames=fig.frames), out)  # the plotly objects are converted as written
+
+    result = json.loads(out.getvalue())
+
+    assert result["data"][0]["type"] == "scatter"
+    assert result["data"][0]["name"] == "u"
+    assert np.allclose(result["data"][0]["y"], x)
+    assert result["layout"]["title"]["text"] == "T"
+    assert result["frames"][0]["name"] == "0"
+    assert np.allclose(result["frames"][0]["data"][0]["y"], 2 * x)
+
+
+def testFigureSaveJson():
+
+    x = np.linspace(0.0, 1.0, 100)
+
+    for fast in [False, True]:
+        fig = Figure(fast=fast)
+        fig.title("TESTING TITLE")
+        fig.drawLine(x, x * x, "u")
+
+        fig.save("test_figure_json.json")
+        fig.save("test_figure_json.json.gz")
+
+        with open("test_figure_json.json") as file:
+            result = json.load(file)
+        with gzip.open("test_figure_json.json.gz", "rt") as file:
+            assert json.load(file) == result
+
+        assert result["layout"]["title"]["text"] == "TESTING TITLE"
+        assert np.allclose(result["data"][0]["y"], x * x)
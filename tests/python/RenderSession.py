@@ -0,0 +1,83 @@
+# reaktplot - a modern C++ scientific plotting library powered by plotly
+# https://github.com/reaktplot/reaktplot
+#
+# Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+#
+# Copyright (c) 2022-2023 Allan Leal
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+# associated documentation files (the "Software"), to deal in the Software without restriction,
+# including without limitation the rights to use, copy, modify, merge, publish, distribute,
+# sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in all copies or
+# substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+# NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+# NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+# DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+from reaktplot import *
+
+
+def testRenderSession():
+
+    session = RenderSession(maxrenders=2)
+
+    assert not session.running
+
+    session.warmup()
+
+    assert session.running
+    assert session.renders == 0
+    assert session.memory() >= 0.0
+
+    fig = Figure()
+    fig.drawLine([0.0, 1.0], [1.0, 2.0], "u")
+
+    session.save(fig, "test_session_1.pdf")
+    assert session.running
+    assert session.renders == 1
+
+    session.save(fig, "test_session_2.pdf")  # the renderer is recycled after this second render
+    assert not session.running
+    assert session.recycles == 1
+
+    session.save(fig, "test_session_3.pdf")  # and started anew for this one
+    assert session.running
+    assert session.renders == 1
+
+    session.stop()
+    assert not session.running
+
+
+def testRenderSessionSaveAll():
+
+    session = RenderSession(maxrenders=3)
+
+    fig = Figure(fast=True)
+    fig.drawLine([0.0, 1.0], [1.0, 2.0], "u")
+
+    session.saveAll(fig, [("test_session_all.png", 800, 500, 1.0), ("test_session_all.svg", 800, 500, 1.0)])
+    assert session.running
+    assert session.renders == 2
+
+    session.saveAll(fig, [("test_session_all_thumbnail.png", 160, 100, 1.0)])  # the renderer is recycled after this third render
+    assert not session.running
+    assert session.recycles == 1
+
+
+def testRenderSessionImage():
+
+    session = RenderSession()
+
+    fig = Figure(fast=True)
+    fig.drawLine([0.0, 1.0], [1.0, 2.0], "u")
+
+    image = session.image(fig, "png", 160, 100)
+
+    assert image.startswith(b"\x89PNG")
+    assert session.renders == 1
@@ -0,0 +1,46 @@
+# reaktplot - a modern C++ scientific plotting library powered by plotly
+# https://github.com/reaktplot/reaktplot
+#
+# Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+#
+# Copyright (c) 2022-2023 Allan Leal
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+# associated documentation files (the "Software"), to deal in the Software without restriction,
+# including without limitation the rights to use, copy, modify, merge, publish, distribute,
+# sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in all copies or
+# substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+# NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+# NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+# DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+import json
+import subprocess
+import sys
+
+
+def testRenderWorker():
+
+    figure = dict(data=[dict(type="scatter", x=[0.0, 1.0], y=[1.0, 2.0])], layout=dict())
+
+    jobs = [
+        dict(figure=figure, file="test_worker.svg", width=400, height=300, scale=1.0),
+        dict(figure=figure, file="test_worker.unknown", width=400, height=300, scale=1.0),
+    ]
+
+    lines = "".join(json.dumps(job) + "\n" for job in jobs)
+
+    result = subprocess.run([sys.executable, "-m", "reaktplot.RenderWorker"], input=lines, capture_output=True, text=True)
+
+    replies = result.stdout.splitlines()
+
+    assert result.returncode == 0
+    assert len(replies) == 2
+    assert replies[0] == "ok"
+    assert replies[1].startswith("error ")